@@ -0,0 +1,25 @@
+/*
+    Lazy OpenGL loader, see src/glad_lazy.c and tools/gen_glad_lazy.py
+*/
+
+#ifndef __glad_lazy_h_
+#define __glad_lazy_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Loads GL like gladLoadGLLoader(), but only resolves glGetString up front
+    Every other function is resolved by the loader on its first call
+    Returns 0 if there is no usable context
+*/
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef BLOCK_COMPRESSION_H
+#define BLOCK_COMPRESSION_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <vector>
+
+class ThreadPool;
+
+// Not in the core profile, but exposed by every desktop driver through EXT_texture_compression_s3tc and EXT_texture_sRGB
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+// The block compressed formats the encoder can write, each stores 4x4 pixel blocks that the GPU samples directly
+enum class BlockFormat
+{
+  BC1, // RGB in 8 bytes per block, 4 bits per pixel
+  BC3, // RGBA in 16 bytes per block, BC1 color with a BC4 alpha block
+  BC4, // One channel in 8 bytes per block, for masks and height maps
+  BC5, // Two channels in 16 bytes per block, for normal maps
+  BC7  // RGBA in 16 bytes per block, higher quality than BC1 and BC3
+};
+
+// One block compressed mip level
+struct CompressedLevel
+{
+  int width = 0;                     // The width, in pixels
+  int height = 0;                    // The height, in pixels
+  std::vector<unsigned char> blocks; // The blocks, rows of blocks tightly packed in the same order as the pixel rows
+};
+
+// Encodes 8 bit images to BC formats on the CPU, so textures take 4 to 8 times less memory and bandwidth on the GPU
+// Endpoints are found from each block's bounds, computed with vector min/max, then refined with a least squares fit
+// sRGB images are encoded as is, the GPU decodes the blocks before converting them to linear
+class BlockCompressor
+{
+public:
+  /**
+   * Encodes an image
+   * Blocks on the right and bottom edges are padded by repeating the last column and row
+   *
+   * @param pixels:   The pixels, 8 bits per channel with rows tightly packed
+   * @param width:    The width, in pixels
+   * @param height:   The height, in pixels
+   * @param channels: The channels per pixel, 1 to 4, missing ones read as 0 and alpha as 255
+   * @param format:   The format to encode to
+   * @param pool:     Splits the rows of blocks across the pool, or nullptr to do it all on the calling thread
+   *                  Must be nullptr when called from one of the pool's tasks
+   *
+   * @returns: The encoded level
+   */
+  static CompressedLevel compress(const unsigned char* pixels, int width, int height, int channels, BlockFormat format,
+                                  ThreadPool* pool = nullptr);
+
+  /**
+   * Picks a format for a number of channels
+   * 1 channel is BC4, 2 are BC5, 3 are BC1 and 4 are BC3, or BC7 for 3 and 4 when quality matters more than encode time
+   *
+   * @param channels:    The channels per pixel, 1 to 4
+   * @param highQuality: Use BC7 for color images
+   */
+  static BlockFormat formatFor(int channels, bool highQuality = false);
+
+  /**
+   * Gets the sized internal format to allocate a texture with
+   *
+   * @param format: The block format
+   * @param srgb:   Decode the color channels as sRGB, ignored for BC4 and BC5
+   */
+  static GLenum internalFormatFor(BlockFormat format, bool srgb);
+
+  /**
+   * Gets the size of one 4x4 block
+   *
+   * @param format: The block format
+   *
+   * @returns: 8 or 16 bytes
+   */
+  static int blockBytes(BlockFormat format);
+
+  /**
+   * Gets the size of an encoded level
+   *
+   * @param format: The block format
+   * @param width:  The width, in pixels
+   * @param height: The height, in pixels
+   */
+  static size_t compressedSize(BlockFormat format, int width, int height);
+
+  /**
+   * Gets the instruction set the bounds search was compiled for
+   *
+   * @returns: "SSE2", "NEON" or "scalar"
+   */
+  static const char* getSimdName();
+};
+
+#endif // !BLOCK_COMPRESSION_H
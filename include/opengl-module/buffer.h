@@ -0,0 +1,89 @@
+#ifndef BUFFER_H
+#define BUFFER_H
+
+#include <glad/glad.h>
+
+// Wrapper for an immutable buffer object in OpenGL
+// Binds go through the StateCache, so redundant binds are skipped
+class Buffer
+{
+  GLuint _id = 0;         // The buffer ID
+  GLsizeiptr _size = 0;   // The size of the buffer, in bytes
+  int _memoryTag = 0;     // The MemoryTracker tag the storage is counted under
+  bool _init = false;     // Track if the buffer has been initialized
+
+public:
+  /**
+   * Buffer Default Constructor
+   * DOES NOT INITIALIZE
+   * After constructing a Buffer, you must call Buffer::init()
+   */
+  Buffer() = default;
+
+  /**
+   * Buffer Constructor
+   *
+   * @param size:  The size of the buffer, in bytes
+   * @param data:  The initial contents, or nullptr to leave it uninitialized
+   * @param flags: The storage flags passed to glNamedBufferStorage
+   */
+  Buffer(GLsizeiptr size, const void* data = nullptr, GLbitfield flags = GL_DYNAMIC_STORAGE_BIT);
+
+  /**
+   * Initializes the buffer
+   * Allocates immutable storage of the given size
+   *
+   * @param size:  The size of the buffer, in bytes
+   * @param data:  The initial contents, or nullptr to leave it uninitialized
+   * @param flags: The storage flags passed to glNamedBufferStorage
+   */
+  void init(GLsizeiptr size, const void* data = nullptr, GLbitfield flags = GL_DYNAMIC_STORAGE_BIT);
+
+  /**
+   * Deletes the buffer
+   */
+  void destroy();
+
+  /**
+   * Replaces part of the buffer's contents
+   * The buffer must have been created with GL_DYNAMIC_STORAGE_BIT
+   *
+   * @param offset: The offset to write at, in bytes
+   * @param size:   The number of bytes to write
+   * @param data:   The data to write
+   */
+  void setData(GLintptr offset, GLsizeiptr size, const void* data);
+
+  /**
+   * Binds the buffer to a target
+   *
+   * @param target: The target to bind to
+   */
+  void bind(GLenum target) const;
+
+  /**
+   * Binds the buffer to an indexed uniform or shader storage binding point
+   *
+   * @param target: GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+   * @param index:  The binding index
+   */
+  void bindBase(GLenum target, GLuint index) const;
+
+  /**
+   * Gets the id of the buffer
+   *
+   * @returns: The id of the buffer
+   */
+  GLuint getID() const
+  {
+    return _id;
+  }
+
+  // Gets the size of the buffer, in bytes
+  GLsizeiptr getSize() const
+  {
+    return _size;
+  }
+};
+
+#endif // !BUFFER_H
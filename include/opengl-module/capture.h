@@ -0,0 +1,116 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+// Identifies the first bytes of a capture file
+const char CAPTURE_MAGIC[8] = { 'G', 'L', 'C', 'A', 'P', 'T', 'R', '1' };
+
+// The calls recorded in a capture
+// Every record is: uint16 op, uint16 argument count, uint32 payload size,
+// then the arguments as uint32s, then the payload bytes. Floats are stored by their bits
+// The arguments of each op are listed next to it, objects are referred to by their name at capture time
+enum class CaptureOp : uint16_t
+{
+  FrameEnd = 1,                // ()
+  CreateProgram,               // (program, vertex source size), payload: vertex source then fragment source
+  Uniform1i,                   // (program, value), payload: uniform name
+  Uniform1f,                   // (program, value bits), payload: uniform name
+  UseProgram,                  // (program)
+  CreateBuffer,                // (buffer, size, flags), payload: initial contents, if any
+  BufferSubData,               // (buffer, offset), payload: data
+  DeleteBuffer,                // (buffer)
+  BindBuffer,                  // (target, buffer)
+  BindBufferBase,              // (target, index, buffer)
+  CreateVertexArray,           // (vertex array)
+  DeleteVertexArray,           // (vertex array)
+  VertexArrayVertexBuffer,     // (vertex array, binding index, buffer, offset, stride)
+  VertexArrayElementBuffer,    // (vertex array, buffer)
+  VertexArrayAttribute,        // (vertex array, attribute, size, type, normalized, relative offset, binding index)
+  BindVertexArray,             // (vertex array)
+  CreateTexture2D,             // (texture, levels, internal format, width, height)
+  TextureSubImage2D,           // (texture, level, x, y, width, height, format, type), payload: pixels, tightly packed
+  GenerateMipmap,              // (texture)
+  DeleteTexture,               // (texture)
+  BindTexture,                 // (unit, texture)
+  BindSampler,                 // (unit, sampler)
+  CreateRenderTarget,          // (framebuffer, color texture, depth renderbuffer, width, height, color format, depth format)
+  DeleteRenderTarget,          // (framebuffer, color texture, depth renderbuffer)
+  BindFramebuffer,             // (target, framebuffer)
+  Enable,                      // (capability)
+  Disable,                     // (capability)
+  BlendFunc,                   // (source, destination)
+  DepthFunc,                   // (func)
+  DepthMask,                   // (write)
+  CullFace,                    // (mode)
+  Viewport,                    // (x, y, width, height)
+  DrawArrays,                  // (mode, first, count, instances, base instance)
+  DrawElements,                // (mode, count, type, offset, instances, base vertex, base instance)
+  TextureParameter,            // (texture, parameter, value)
+  CompressedTextureSubImage2D, // (texture, level, x, y, width, height, internal format), payload: blocks
+  CreateTexture,               // (texture, target, levels, internal format, width, height, layers)
+  TextureSubImage3D,           // (texture, level, x, y, layer, width, height, layers, format, type), payload: pixels, tightly packed
+  CompressedTextureSubImage3D, // (texture, level, x, y, layer, width, height, layers, internal format), payload: blocks
+  Count
+};
+
+// Records every call made through the wrappers into a compact binary file,
+// so a session can be replayed later by the gl_replay tool without the app
+// Calls made directly to GL, and writes through mapped buffers, are not recorded
+class Capture
+{
+  static std::atomic<bool> _active; // Tracks if calls are being recorded
+
+public:
+  /**
+   * Checks if calls are being recorded
+   * Wrappers check this before building a record, so capturing costs nothing when it's off
+   */
+  static bool isActive()
+  {
+    return _active.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Starts recording to a file
+   * Objects created before this are not in the capture, so GL starts it before the init callback
+   *
+   * @param path:   The file to write
+   * @param frames: The number of frames to record before stopping
+   *
+   * @returns: True if the file could be opened
+   */
+  static bool begin(const std::string& path, int frames);
+
+  /**
+   * Stops recording and closes the file
+   */
+  static void end();
+
+  /**
+   * Records the end of a frame
+   * Stops recording once the requested number of frames has been captured
+   */
+  static void endFrame();
+
+  /**
+   * Records a call
+   * Safe to call from any thread
+   *
+   * @param op:          The call
+   * @param args:        The call's arguments, see CaptureOp
+   * @param payload:     Data the call reads, or nullptr
+   * @param payloadSize: The size of the payload, in bytes
+   */
+  static void record(CaptureOp op, std::initializer_list<uint32_t> args, const void* payload = nullptr, uint32_t payloadSize = 0);
+
+  /**
+   * Stores a float in a capture argument
+   */
+  static uint32_t floatBits(float value);
+};
+
+#endif // !CAPTURE_H
@@ -0,0 +1,150 @@
+#ifndef COMMAND_BUCKET_H
+#define COMMAND_BUCKET_H
+
+#include <glad/glad.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class StateCache;
+
+// Number of texture units a DrawCommand can bind
+const int DRAW_COMMAND_TEXTURES = 4;
+
+// A single draw, kept small and fixed size so buckets can sort and copy them cheaply
+struct DrawCommand
+{
+  GLuint program = 0;                         // The shader program to draw with
+  GLuint vertexArray = 0;                     // The vertex array to draw from
+  GLuint textures[DRAW_COMMAND_TEXTURES] = {}; // Textures bound to units 0 and up, 0 leaves a unit alone
+  GLenum mode = GL_TRIANGLES;                 // The primitive type
+  GLenum indexType = 0;                       // The index type, or 0 to draw without indices
+  GLuint first = 0;                           // The first vertex, or the byte offset of the first index
+  GLsizei count = 0;                          // The number of vertices or indices
+  GLsizei instances = 1;                      // The number of instances
+  GLint baseVertex = 0;                       // Added to every index
+  GLuint baseInstance = 0;                    // Offset for instanced attributes, usable as a per-draw index
+};
+
+// Called by CommandBucket::submit() before the first draw of each pass
+typedef void (*PassCallback)(unsigned pass);
+
+/**
+ * Builds a sort key for a draw
+ * Draws are submitted in increasing key order, so the fields are packed from most to least significant
+ *
+ * @param pass:     The render pass, only the low 4 bits are used
+ * @param program:  The shader program, only the low 12 bits are used
+ * @param material: An id for the textures and other material state, only the low 16 bits are used
+ * @param depth:    The depth bits, see depthKey()
+ *
+ * @returns: The sort key
+ */
+inline uint64_t makeSortKey(unsigned pass, unsigned program, unsigned material, uint32_t depth)
+{
+  return ((uint64_t)(pass & 0xF) << 60) | ((uint64_t)(program & 0xFFF) << 48) | ((uint64_t)(material & 0xFFFF) << 32) | depth;
+}
+
+/**
+ * Converts a view depth to key bits that sort in the same order
+ *
+ * @param depth:       The distance from the camera, must not be negative
+ * @param backToFront: True to sort the farthest draws first, for transparent passes
+ *
+ * @returns: The depth bits for makeSortKey()
+ */
+uint32_t depthKey(float depth, bool backToFront = false);
+
+// Collects draws from any number of threads, sorts them by key and submits them in order
+// Sorting by state means draws sharing a program and material are submitted together,
+// and the state cache skips the binds between them
+class CommandBucket
+{
+  std::vector<uint64_t> _keys;        // Sort key of each command
+  std::vector<DrawCommand> _commands; // Commands in the order they were added
+  std::vector<uint32_t> _order;       // Command indices in sorted order
+  std::vector<uint64_t> _sortKeys;    // Keys being sorted
+  std::vector<uint64_t> _scratchKeys; // Ping pong buffer for the radix sort
+  std::vector<uint32_t> _scratch;     // Ping pong buffer for the radix sort
+  std::atomic<uint32_t> _count;       // Number of slots claimed, may pass the capacity
+  uint32_t _sortedCount = 0;          // Commands _order was sorted for, commands added since make it stale
+
+  PassCallback _passCallback = nullptr; // Called when the pass changes during submission
+
+  unsigned long _dropped = 0; // Commands dropped because the bucket was full
+
+public:
+  /**
+   * CommandBucket Constructor
+   *
+   * @param capacity: The maximum number of commands per frame
+   */
+  explicit CommandBucket(uint32_t capacity = 4096);
+
+  // Delete copy ctor and assignment operator, the count is atomic
+  CommandBucket(const CommandBucket&) = delete;
+  CommandBucket& operator=(const CommandBucket&) = delete;
+
+  /**
+   * Adds a draw to the bucket
+   * Safe to call from any number of threads at once, but not while sorting or submitting
+   *
+   * @param key:     The sort key, see makeSortKey()
+   * @param command: The draw
+   *
+   * @returns: False if the bucket is full and the draw was dropped
+   */
+  bool add(uint64_t key, const DrawCommand& command);
+
+  /**
+   * Sorts the commands by key
+   * Called by submit() if commands were added since it was last called
+   */
+  void sort();
+
+  /**
+   * Submits every command in key order
+   * Must be called on the render thread, after all threads have finished adding
+   *
+   * @param stateCache: The cache of the current context
+   */
+  void submit(StateCache& stateCache);
+
+  /**
+   * Submits every command in key order using the current context's cache
+   */
+  void submit();
+
+  /**
+   * Removes all of the commands, ready for the next frame
+   */
+  void clear();
+
+  /**
+   * Sets a function called before the first draw of each pass
+   * Can be used to change blend or depth state between passes
+   *
+   * @param passCallback: The function to call, or nullptr
+   */
+  void setPassCallback(PassCallback passCallback)
+  {
+    _passCallback = passCallback;
+  }
+
+  // Gets the number of commands in the bucket
+  uint32_t size() const;
+
+  // Gets the maximum number of commands
+  uint32_t capacity() const
+  {
+    return (uint32_t)_commands.size();
+  }
+
+  // Gets the number of commands dropped because the bucket was full
+  unsigned long getDroppedCount() const
+  {
+    return _dropped;
+  }
+};
+
+#endif // !COMMAND_BUCKET_H
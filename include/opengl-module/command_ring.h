@@ -0,0 +1,128 @@
+#ifndef COMMAND_RING_H
+#define COMMAND_RING_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// A single producer, single consumer ring of marshalled function calls
+// Each command is a small trivially copyable function object copied into a fixed size slot,
+// so recording a call never allocates and never takes a lock
+class CommandRing
+{
+public:
+  static const size_t SLOT_SIZE = 64;                        // Size of one slot, one cache line
+  static const size_t PAYLOAD_SIZE = SLOT_SIZE - sizeof(void*); // Bytes available for a command's captures
+
+private:
+  // A recorded command
+  struct Slot
+  {
+    void (*execute)(void* payload);                      // Runs the command stored in payload
+    alignas(void*) unsigned char payload[PAYLOAD_SIZE]; // The command's captures
+  };
+
+  std::vector<Slot> _slots; // The ring, its size is a power of two
+  size_t _mask;             // _slots.size() - 1
+
+  alignas(64) std::atomic<uint64_t> _head; // Next slot the producer writes, only written by the producer
+  alignas(64) std::atomic<uint64_t> _tail; // Next slot the consumer runs, only written by the consumer
+
+  std::atomic<bool> _consumerSleeping; // Set while the consumer is blocked waiting for work
+  std::atomic<bool> _producerSleeping; // Set while the producer is blocked waiting for commands to run
+  std::mutex _mutex;                   // Guards sleeping and waking both threads
+  std::condition_variable _wake;       // Wakes the consumer
+  std::condition_variable _progress;   // Wakes the producer
+
+public:
+  /**
+   * CommandRing Constructor
+   *
+   * @param slots: The number of commands the ring can hold, rounded up to a power of two
+   */
+  explicit CommandRing(size_t slots = 4096);
+
+  // Delete copy ctor and assignment operator, the ring is shared between threads
+  CommandRing(const CommandRing&) = delete;
+  CommandRing& operator=(const CommandRing&) = delete;
+
+  /**
+   * Records a command
+   * Blocks if the ring is full until the consumer frees a slot
+   * Only call from the producer thread
+   *
+   * @param command: A function object taking no arguments, its captures must fit in a slot
+   */
+  template <typename F>
+  void push(const F& command)
+  {
+    static_assert(sizeof(F) <= PAYLOAD_SIZE, "Command captures too much to fit in a CommandRing slot");
+    static_assert(alignof(F) <= alignof(void*), "Command captures are over-aligned for a CommandRing slot");
+    static_assert(std::is_trivially_copyable<F>::value, "Commands must be trivially copyable, capture pointers instead of objects");
+
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    waitForSpace(head);
+
+    Slot& slot = _slots[head & _mask];
+    slot.execute = &invoke<F>;
+    new (slot.payload) F(command);
+
+    _head.store(head + 1, std::memory_order_release);
+    wakeConsumer();
+  }
+
+  /**
+   * Runs every recorded command, blocking while the ring is empty
+   * Only call from the consumer thread
+   *
+   * @param stop: Returns once this is set and the ring is empty
+   */
+  void consume(const std::atomic<bool>& stop);
+
+  /**
+   * Wakes the consumer so it can notice a stop request
+   */
+  void wakeConsumer();
+
+  /**
+   * Blocks until a number of commands have run, sleeping rather than spinning once a short spin fails
+   * Only call from the producer thread
+   *
+   * @param count: The number of commands, compared with getExecuted()
+   */
+  void waitForExecuted(uint64_t count);
+
+  // Gets the number of commands recorded so far
+  uint64_t getRecorded() const
+  {
+    return _head.load(std::memory_order_acquire);
+  }
+
+  // Gets the number of commands run so far
+  uint64_t getExecuted() const
+  {
+    return _tail.load(std::memory_order_acquire);
+  }
+
+private:
+  // Runs a command of type F stored in a slot
+  template <typename F>
+  static void invoke(void* payload)
+  {
+    (*reinterpret_cast<F*>(payload))();
+  }
+
+  /**
+   * Blocks until the slot at head is free
+   *
+   * @param head: The slot the producer wants to write
+   */
+  void waitForSpace(uint64_t head);
+};
+
+#endif // !COMMAND_RING_H
@@ -0,0 +1,86 @@
+#ifndef DEBUG_MESSAGES_H
+#define DEBUG_MESSAGES_H
+
+#include <glad/glad.h>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// A debug message from the driver and how many times it was reported
+struct DebugMessageCount
+{
+  GLenum source = 0;       // Where the message came from, like GL_DEBUG_SOURCE_API
+  GLenum type = 0;         // The kind of message, like GL_DEBUG_TYPE_PERFORMANCE
+  GLuint id = 0;           // The driver's id for the message
+  GLenum severity = 0;     // How severe the driver considers it
+  std::string message;     // The text of the first report
+  unsigned long count = 0; // Number of times it was reported
+};
+
+// Collects messages reported through glDebugMessageCallback
+// Errors are printed the first time they are seen, performance messages
+// (buffer migrations, shader recompiles, stalls) are only counted, so they can be
+// reported once instead of flooding the output every frame
+class DebugMessages
+{
+  // Identifies a message, the driver reuses the id for every report of the same message
+  struct Key
+  {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+
+    bool operator<(const Key& other) const
+    {
+      if (source != other.source)
+        return source < other.source;
+      if (type != other.type)
+        return type < other.type;
+      return id < other.id;
+    }
+  };
+
+  std::map<Key, DebugMessageCount> _messages; // Every distinct message seen
+  mutable std::mutex _mutex;                  // The driver may report from its own threads
+
+public:
+  /**
+   * Installs the callback on the current context
+   * Does nothing if the context wasn't created with the debug flag
+   *
+   * @returns: True if the callback was installed
+   */
+  bool install();
+
+  /**
+   * Records a message
+   * Called by the debug callback
+   */
+  void record(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message);
+
+  /**
+   * Gets the performance messages, most frequent first
+   */
+  std::vector<DebugMessageCount> getPerformanceMessages() const;
+
+  /**
+   * Gets the total number of messages of a type
+   *
+   * @param type: The message type, like GL_DEBUG_TYPE_ERROR
+   */
+  unsigned long getCount(GLenum type) const;
+
+  /**
+   * Prints the performance messages and how many times each was reported
+   *
+   * @param out: The stream to print to
+   */
+  void printReport(std::ostream& out) const;
+
+  // Forgets every message recorded so far
+  void clear();
+};
+
+#endif // !DEBUG_MESSAGES_H
@@ -0,0 +1,99 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Keeps tracing on and writes the last few frames of zones to a file when a frame takes too long
+// Zones live in the fixed size trace rings, so memory stays constant no matter how long it runs,
+// and the file is written on a background thread so a dump doesn't cause another spike
+class FlightRecorder
+{
+  // Frames recorded after the spike before dumping, so its GPU zones have been read back
+  static const int FRAMES_AFTER_SPIKE = 3;
+
+  std::string _path;             // The file to write, a number is added before the extension
+  double _thresholdMs = 0.0;     // Frames longer than this trigger a dump, in milliseconds
+  int _frames = 0;               // The number of frames before the spike to include
+  bool _traceWasEnabled = false; // Tracks if tracing was on before start(), stop() restores it
+
+  std::vector<uint64_t> _frameStarts; // Start times of the most recent frames, a ring
+  uint64_t _frameCount = 0;           // Frames ended since the recorder started
+  int _framesUntilDump = -1;          // Frames left before dumping a spike, -1 if none is pending
+  uint64_t _dumpSince = 0;            // Start of the earliest frame in the pending dump
+
+  std::thread _thread;           // Writes dumps
+  std::mutex _mutex;             // Guards the dump request and _stop
+  std::condition_variable _wake; // Signaled when a dump is requested or the recorder is stopped
+  bool _dumpRequested = false;   // Tells the thread to write a dump
+  uint64_t _requestedSince = 0;  // Start of the earliest frame the thread should write
+  bool _writing = false;         // Set while the thread is writing, spikes are ignored meanwhile
+  int _dumpCount = 0;            // Dumps written so far
+  bool _stop = false;            // Tells the thread to exit
+
+public:
+  FlightRecorder() = default;
+
+  // Delete copy ctor and assignment operator, the recorder owns a thread
+  FlightRecorder(const FlightRecorder&) = delete;
+  FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+  // Stops the writer thread
+  ~FlightRecorder();
+
+  /**
+   * Enables tracing and starts the writer thread
+   *
+   * @param path:        The file to write, dumps are numbered, so trace.json becomes trace-1.json, trace-2.json...
+   * @param thresholdMs: Frames longer than this trigger a dump, in milliseconds
+   * @param frames:      The number of frames before the spike to include
+   */
+  void start(const std::string& path, double thresholdMs, int frames);
+
+  /**
+   * Waits for a dump in progress, then stops the writer thread
+   * Turns tracing back off if it was off when start() was called
+   */
+  void stop();
+
+  /**
+   * Checks if the recorder is running
+   */
+  bool isRunning() const
+  {
+    return _thread.joinable();
+  }
+
+  /**
+   * Records the end of a frame, and requests a dump if it took too long
+   * Only call from the thread running the frame loop
+   *
+   * @param start: When the frame started, from Trace::now()
+   * @param end:   When the frame ended, from Trace::now()
+   */
+  void endFrame(uint64_t start, uint64_t end);
+
+  /**
+   * Gets the number of dumps written so far
+   */
+  int getDumpCount();
+
+private:
+  /**
+   * Waits for dump requests and writes them
+   */
+  void threadMain();
+
+  /**
+   * Gets the path of a numbered dump
+   *
+   * @param index: The dump's number
+   */
+  std::string dumpPath(int index) const;
+};
+
+#endif // !FLIGHT_RECORDER_H
@@ -3,7 +3,21 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <opengl-module/debug_messages.h>
+#include <opengl-module/flight_recorder.h>
+#include <opengl-module/latency.h>
+#include <opengl-module/render_targets.h>
+#include <opengl-module/resource_loader.h>
+#include <opengl-module/state_cache.h>
+#include <opengl-module/submission_thread.h>
+#include <opengl-module/texture_loader.h>
+#include <opengl-module/texture_stream.h>
+#include <opengl-module/thread_pool.h>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 // Define a function pointer for event callback
 typedef void (*Callback)();
@@ -13,12 +27,91 @@ typedef void (*Callback)();
 const int WINDOW_WIDTH = 800;  // Default window width, in pixels
 const int WINDOW_HEIGHT = 600; // Default window height, in pixels
 
+// How the context should handle error checking
+enum class ContextMode
+{
+  Default, // Whatever the driver does by default
+  Debug,   // Request a debug context and collect its messages
+  NoError  // Request a context that skips error checking entirely
+};
+
+// CPU time spent in each phase of a frame of GL::run(), in milliseconds
+// With the submission thread, render is the time spent recording and present includes waiting for it
+struct FrameTiming
+{
+  double poll = 0.0;    // Input callbacks and glfwPollEvents()
+  double update = 0.0;  // The update callback
+  double render = 0.0;  // Render targets, the render callback, the late latch callback and other windows
+  double present = 0.0; // Swapping the main window's buffers
+};
+
+// Wall time spent in each step of starting up, in milliseconds
+struct StartupTiming
+{
+  double glfwInit = 0.0;     // glfwInit()
+  double createWindow = 0.0; // Creating the window and its context
+  double loadGL = 0.0;       // Loading the GL functions with glad
+  double setup = 0.0;        // The rest of GL's setup, like the viewport and the loader thread
+  double prepareWait = 0.0;  // Waiting for prepare tasks that were still running once GL was set up
+  double initCallback = 0.0; // The init callback
+  double firstFrame = 0.0;   // The first frame, up to its buffers being swapped
+  double total = 0.0;        // From GL::run() being called to the first frame being swapped
+};
+
 // Handles window creation and render loop for OpenGL
 // Uses a singleton to possibility of multiple windows
 class GL
 {
-  GLFWwindow* _window = nullptr; // Stores a pointer to the window
-  bool _init = false;            // Tracks if glfw and glad have been initialized
+  // A window opened with GL::addWindow()
+  struct SecondaryWindow
+  {
+    GLFWwindow* window;                     // The window, its context shares objects with the main window
+    Callback renderCallback;                // Called every frame with this window's context current
+    std::shared_ptr<StateCache> stateCache; // Shadows the state of this window's context
+  };
+
+  GLFWwindow* _window = nullptr;        // Stores a pointer to the window
+  GLFWwindow* _currentWindow = nullptr; // The window whose context is current
+  bool _init = false;                   // Tracks if glfw and glad have been initialized
+  StateCache _stateCache;               // Shadows the state of the main window's context
+
+  std::vector<SecondaryWindow> _secondaryWindows; // Windows rendered after the main window
+  int _swapInterval = 0;                          // Swap interval for the main window
+  bool _swapIntervalSet = false;                  // Tracks if the swap interval should be applied
+  ContextMode _contextMode = ContextMode::Default; // The kind of context to request
+  DebugMessages _debugMessages;                   // Messages from the driver in debug mode
+
+  Callback _lateLatchCallback = nullptr; // Called after rendering, right before the buffers are swapped
+  bool _trackLatency = false;            // Tracks if input to present latency should be measured
+  LatencyTracker _latency;               // Measures input to present latency
+  RenderTargets _renderTargets;          // Offscreen targets that follow the framebuffer size
+  bool _useLoaderThread = false;         // Tracks if the background upload thread should be started
+  ResourceLoader _loader;                // Runs uploads on a background thread with a shared context
+  double _inputTime = 0.0;               // When input was last sampled, from glfwGetTime()
+
+  bool _useSubmissionThread = false;      // Tracks if GL work should be replayed on a submission thread
+  SubmissionThread _submission;           // Owns the main context when the submission thread is enabled
+  uint64_t _previousSwap = 0;             // Commands recorded up to and including the last frame's swap
+
+  bool _windowVisible = true; // Tracks if the main window should be shown
+  FrameTiming _frameTiming;   // Phase timings of the last frame
+
+  std::string _flightRecorderPath;     // Where the flight recorder writes dumps, empty if it's off
+  double _flightRecorderThreshold = 0; // Frame time that triggers a dump, in milliseconds
+  int _flightRecorderFrames = 0;       // Frames before a spike to include in a dump
+  FlightRecorder _flightRecorder;      // Dumps the last frames of traces when a frame spikes
+
+  ThreadPool _threadPool;                           // Workers for CPU work, like prepare tasks
+  std::vector<std::function<void()>> _prepareTasks; // Run on the workers while the window is created
+  StartupTiming _startupTiming;                     // How long each step of starting up took
+  TextureLoader _textureLoader;                     // Decodes textures on the pool and uploads them under a budget
+
+  size_t _textureStreamSlice = 0; // Bytes per frame of the texture stream, 0 if it's off
+  int _textureStreamSlices = 0;   // Frames the texture stream can have in flight
+  TextureStream _textureStream;   // Persistently mapped ring for per frame texture updates
+
+  std::string _capturePath; // Where to write a capture of the first frames, empty to not capture
+  int _captureFrames = 0;   // The number of frames to capture
 
   // Default Constructor
   // Private for singleton
@@ -56,6 +149,283 @@ public:
     return _window;
   }
 
+  /**
+   * Gets the window currently being rendered
+   * Render callbacks of secondary windows can use this to tell which window they are drawing
+   */
+  GLFWwindow* getCurrentWindow() const
+  {
+    return _currentWindow;
+  }
+
+  /**
+   * Sets whether the main window is shown
+   * A hidden window still renders, which is useful for benchmarks and offscreen work
+   * Must be set before GL::run() is called
+   *
+   * @param visible: False to keep the window hidden
+   */
+  void setWindowVisible(bool visible)
+  {
+    _windowVisible = visible;
+  }
+
+  // Gets the CPU time spent in each phase of the last frame
+  const FrameTiming& getFrameTiming() const
+  {
+    return _frameTiming;
+  }
+
+  /**
+   * Sets the swap interval of the main window
+   * Can be called before or during GL::run()
+   *
+   * @param interval: The number of screen updates to wait before swapping, 0 disables vsync
+   */
+  void setSwapInterval(int interval);
+
+  /**
+   * Opens another window rendered by the same loop as the main window
+   * Its context shares textures, buffers, shader programs and other objects with the main window,
+   * so they only have to be created once. Container objects like vertex arrays and
+   * framebuffers are not shared between contexts and must be created per window
+   *
+   * Must be called while GL is running, e.g. from the init callback
+   * The window is destroyed when it is closed, the loop keeps running until the main window closes
+   *
+   * Every window waits for its own vsync when swapping, so usually only
+   * one window should be given a non-zero swap interval
+   *
+   * @param windowName:     The name to give the window
+   * @param renderCallback: A function called every frame with this window's context current
+   * @param windowWidth:    The width of the window, in pixels
+   * @param windowHeight:   The height of the window, in pixels
+   * @param swapInterval:   The number of screen updates to wait before swapping this window
+   *
+   * @returns: The new window, or nullptr if it could not be created
+   */
+  GLFWwindow* addWindow(std::string windowName, Callback renderCallback, int windowWidth = WINDOW_WIDTH, int windowHeight = WINDOW_HEIGHT, int swapInterval = 0);
+
+  // Gets the number of open secondary windows
+  int getSecondaryWindowCount() const
+  {
+    return (int)_secondaryWindows.size();
+  }
+
+  /**
+   * Sets the kind of context to request
+   * Debug installs a debug callback and counts every message, use it in development
+   * to find driver slow paths. NoError requests GLFW_CONTEXT_NO_ERROR, where the
+   * driver skips validation, use it in release builds together with the
+   * OPENGL_MODULE_NO_ERROR_CHECKS CMake option
+   * Must be set before GL::run() is called
+   *
+   * @param mode: The kind of context
+   */
+  void setContextMode(ContextMode mode)
+  {
+    _contextMode = mode;
+  }
+
+  // Gets the messages reported by the driver, only collected in ContextMode::Debug
+  const DebugMessages& getDebugMessages() const
+  {
+    return _debugMessages;
+  }
+
+  /**
+   * Sets a function called after the render callback, right before the buffers are swapped
+   * Input is polled again just before it is called, so anything it writes is
+   * based on input that is a full update and render younger than the update callback saw
+   *
+   * The draws have already been submitted when this is called, so it should only write to
+   * memory the GPU reads when it executes them, like a persistently mapped coherent uniform buffer
+   * Must be set before GL::run() is called
+   *
+   * @param lateLatchCallback: The function to call, or nullptr to disable late latching
+   */
+  void setLateLatchCallback(Callback lateLatchCallback)
+  {
+    _lateLatchCallback = lateLatchCallback;
+  }
+
+  /**
+   * Enables measuring the latency from input sampling to presentation
+   * Must be set before GL::run() is called
+   *
+   * @param enabled: True to measure latency every frame
+   */
+  void setLatencyTracking(bool enabled)
+  {
+    _trackLatency = enabled;
+  }
+
+  // Gets the latency measurements, only updated if latency tracking is enabled
+  const LatencyTracker& getLatency() const
+  {
+    return _latency;
+  }
+
+  /**
+   * Gets the state cache of the main window's context
+   * Use StateCache::current() to get the cache of whichever context is current
+   */
+  StateCache& getStateCache()
+  {
+    return _stateCache;
+  }
+
+  /**
+   * Gets the offscreen render targets
+   * Targets added in the init callback are allocated before the first frame
+   * and reallocated once a window resize has settled
+   * With the submission thread running they are resized and reallocated on it, so read them from work enqueued there
+   */
+  RenderTargets& getRenderTargets()
+  {
+    return _renderTargets;
+  }
+
+  /**
+   * Enables the background upload thread
+   * When enabled, GL::init() creates a hidden context sharing objects with the main window
+   * and starts a thread that runs upload jobs submitted to getLoader()
+   * Must be set before GL::run() is called
+   *
+   * @param enabled: True to start the loader thread
+   */
+  void setLoaderThread(bool enabled)
+  {
+    _useLoaderThread = enabled;
+  }
+
+  /**
+   * Gets the background upload thread
+   * Jobs can only be submitted if it was enabled with setLoaderThread()
+   */
+  ResourceLoader& getLoader()
+  {
+    return _loader;
+  }
+
+  /**
+   * Enables the submission thread
+   * When enabled, the main window's context is moved to a dedicated thread after the init callback,
+   * and GL::run() keeps polling input and calling the update and render callbacks on its own thread.
+   * From then on the render and late latch callbacks must not call GL directly, they record
+   * their work with getSubmissionThread().enqueue() and read results back with call() or finish()
+   * This includes the wrappers (Shader, Buffer, VertexArray, Texture2D, StateCache, CommandBucket::submit() ...),
+   * which only report the missing context in debug builds, so call them inside enqueued commands
+   * The loop lets the recording thread get at most one frame ahead of the submission thread
+   * Secondary windows are not supported in this mode
+   * Must be set before GL::run() is called
+   *
+   * @param enabled: True to replay GL work on a submission thread
+   */
+  void setSubmissionThread(bool enabled)
+  {
+    _useSubmissionThread = enabled;
+  }
+
+  // Gets the submission thread, only running if it was enabled with setSubmissionThread()
+  SubmissionThread& getSubmissionThread()
+  {
+    return _submission;
+  }
+
+  /**
+   * Records the calls made through the wrappers for the first frames, for the gl_replay tool
+   * Recording starts before the init callback, so objects it creates are captured
+   * Must be set before GL::run() is called
+   *
+   * @param path:   The file to write the capture to
+   * @param frames: The number of frames to capture
+   */
+  void setCapture(const std::string& path, int frames)
+  {
+    _capturePath = path;
+    _captureFrames = frames;
+  }
+
+  /**
+   * Keeps tracing on, and writes the last few frames of zones to a trace file whenever a frame
+   * takes longer than a threshold. Memory use is fixed and files are written on a background thread
+   * Must be set before GL::run() is called
+   *
+   * @param path:        The file to write, dumps are numbered, so hitch.json becomes hitch-1.json, hitch-2.json...
+   * @param thresholdMs: Frames longer than this trigger a dump, in milliseconds
+   * @param frames:      The number of frames before the spike to include
+   */
+  void setFlightRecorder(const std::string& path, double thresholdMs, int frames = 60)
+  {
+    _flightRecorderPath = path;
+    _flightRecorderThreshold = thresholdMs;
+    _flightRecorderFrames = frames;
+  }
+
+  // Gets the flight recorder, only running if it was enabled with setFlightRecorder()
+  FlightRecorder& getFlightRecorder()
+  {
+    return _flightRecorder;
+  }
+
+  /**
+   * Adds CPU work to run on the thread pool while the window and context are being created,
+   * like reading files, decoding images or preprocessing shader source
+   * Every task finishes before the init callback is called, so it can upload the results
+   * Tasks run without a context, so they must not make GL calls
+   * Must be added before GL::run() is called
+   *
+   * @param task: The work to run
+   */
+  void addPrepareTask(std::function<void()> task)
+  {
+    _prepareTasks.push_back(std::move(task));
+  }
+
+  // Gets the pool that runs prepare tasks, which can be used for any CPU work
+  ThreadPool& getThreadPool()
+  {
+    return _threadPool;
+  }
+
+  /**
+   * Gets the loader that streams textures in
+   * Images are decoded on the thread pool, and GL::run() uploads them every frame under the loader's budget
+   * Textures can be loaded from the init callback on
+   */
+  TextureLoader& getTextureLoader()
+  {
+    return _textureLoader;
+  }
+
+  /**
+   * Creates a persistently mapped pixel unpack ring for per frame texture updates, like video
+   * Uploads through getTextureStream() are copied by the GPU instead of by the driver before the call returns
+   * GL::run() fences each frame's slice, and waits for a slice only when the GPU falls that far behind
+   * Must be set before GL::run() is called
+   *
+   * @param bytesPerFrame: The bytes that can be uploaded through the ring per frame
+   * @param slices:        The number of frames that can be in flight
+   */
+  void setTextureStream(size_t bytesPerFrame, int slices = 3)
+  {
+    _textureStreamSlice = bytesPerFrame;
+    _textureStreamSlices = slices;
+  }
+
+  // Gets the texture stream, only created if it was enabled with setTextureStream()
+  TextureStream& getTextureStream()
+  {
+    return _textureStream;
+  }
+
+  // Gets how long each step of starting up took, complete once the first frame has been swapped
+  const StartupTiming& getStartupTiming() const
+  {
+    return _startupTiming;
+  }
+
   /**
    * Initializes class and runs the render loop
    *
@@ -87,6 +457,30 @@ private:
    */
   bool init(std::string windowName, int windowWidth, int windowHeight);
 
+  /**
+   * Stores how long a step of starting up took, and records it as a trace zone
+   *
+   * @param name:     The zone's name
+   * @param start:    When the step started, from Trace::now()
+   * @param end:      When the step ended, from Trace::now()
+   * @param duration: Set to the step's length, in milliseconds
+   */
+  void recordStartupStep(const char* name, uint64_t start, uint64_t end, double& duration);
+
+  /**
+   * Swaps the main window's buffers and ends the frame
+   * With the submission thread, the swap is recorded and this waits
+   * until the previous frame has been swapped
+   */
+  void present();
+
+  /**
+   * Renders each secondary window and swaps its buffers
+   * Destroys any that have been closed
+   * The main window's context is current again afterwards
+   */
+  void renderSecondaryWindows();
+
   /**
    * Destroys the window and terminates OpenGL
    * Uninitializes glfw and glad
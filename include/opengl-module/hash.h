@@ -0,0 +1,44 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Fast non cryptographic 64 bit hashing, XXH64, for keying caches by content
+// Reads 32 bytes per step, so hashing a decoded image costs far less than decoding it
+class Hash
+{
+public:
+  /**
+   * Hashes a block of memory
+   *
+   * @param data: The bytes to hash
+   * @param size: The number of bytes
+   * @param seed: Gives a different hash for the same bytes, to chain hashes or separate uses
+   *
+   * @returns: The hash
+   */
+  static uint64_t compute(const void* data, size_t size, uint64_t seed = 0);
+
+  /**
+   * Mixes a value into a hash, for keys made of several fields
+   *
+   * @param hash:  The hash so far
+   * @param value: The value to mix in
+   *
+   * @returns: The new hash
+   */
+  static uint64_t combine(uint64_t hash, uint64_t value);
+
+  /**
+   * Formats a hash as 16 hex digits, for file names
+   *
+   * @param hash: The hash
+   *
+   * @returns: The hex digits
+   */
+  static std::string toHex(uint64_t hash);
+};
+
+#endif // !HASH_H
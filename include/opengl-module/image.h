@@ -0,0 +1,113 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <opengl-module/mapped_file.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Pixels decoded by stb_image, 8 bits per channel
+// Decoding doesn't touch GL, so images can be loaded on any thread
+class Image
+{
+  const unsigned char* _pixels = nullptr; // The decoded pixels, owned by stb_image or in the mapping
+  int _width = 0;                         // The width, in pixels
+  int _height = 0;                        // The height, in pixels
+  int _channels = 0;                      // The channels per pixel, 1 to 4
+  std::unique_ptr<MappedFile> _mapping;   // The file holding the pixels when they were mapped rather than decoded
+
+public:
+  Image() = default;
+
+  // Delete copy ctor and assignment operator, the image owns its pixels
+  Image(const Image&) = delete;
+  Image& operator=(const Image&) = delete;
+
+  // Takes the other image's pixels
+  Image(Image&& other);
+  Image& operator=(Image&& other);
+
+  // Frees the pixels
+  ~Image();
+
+  /**
+   * Decodes an image file
+   * Any format stb_image supports can be loaded
+   *
+   * @param path:     The path to the file
+   * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+   * @param channels: The channels to convert to, or 0 to keep the file's
+   *
+   * @returns: True if the image was decoded
+   */
+  bool load(const std::string& path, bool flip = true, int channels = 0);
+
+  /**
+   * Decodes an image already in memory
+   *
+   * @param data:     The encoded file
+   * @param size:     The size of the file, in bytes
+   * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+   * @param channels: The channels to convert to, or 0 to keep the file's
+   *
+   * @returns: True if the image was decoded
+   */
+  bool loadFromMemory(const unsigned char* data, size_t size, bool flip = true, int channels = 0);
+
+  /**
+   * Uses pixels already decoded into a mapped file, like ImageCache's, without copying them
+   * The file stays mapped until the image is freed
+   *
+   * @param mapping:  The mapped file
+   * @param offset:   Where the pixels start in the file, rows tightly packed
+   * @param width:    The width, in pixels
+   * @param height:   The height, in pixels
+   * @param channels: The channels per pixel, 1 to 4
+   *
+   * @returns: True if the file holds that many pixels past the offset
+   */
+  bool loadFromMapping(std::unique_ptr<MappedFile> mapping, size_t offset, int width, int height, int channels);
+
+  /**
+   * Frees the pixels
+   */
+  void free();
+
+  // Checks if the image holds pixels
+  bool isLoaded() const
+  {
+    return _pixels != nullptr;
+  }
+
+  // Gets the decoded pixels, rows are tightly packed
+  const unsigned char* getPixels() const
+  {
+    return _pixels;
+  }
+
+  // Gets the width, in pixels
+  int getWidth() const
+  {
+    return _width;
+  }
+
+  // Gets the height, in pixels
+  int getHeight() const
+  {
+    return _height;
+  }
+
+  // Gets the channels per pixel
+  int getChannels() const
+  {
+    return _channels;
+  }
+
+  // Gets the size of the pixels, in bytes
+  size_t getSize() const
+  {
+    return (size_t)_width * _height * _channels;
+  }
+};
+
+#endif // !IMAGE_H
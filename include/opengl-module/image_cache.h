@@ -0,0 +1,129 @@
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class Image;
+
+// Caches decoded images on disk, so later runs map the pixels instead of decoding PNG and JPEG files again
+// Entries are keyed by a hash of the source file's bytes and the decode options, so an edited file is decoded again
+// An index of the entries' sizes and last use is kept in the directory, and the least recently used ones are deleted
+// when the cache grows past its limit. Safe to use from several threads at once
+class ImageCache
+{
+  // Bump when the cache file layout changes, so stale files are ignored
+  static const uint32_t VERSION = 1;
+
+  // What the index knows about a cache file
+  struct Entry
+  {
+    uint64_t size;     // The size of the file, in bytes
+    uint64_t lastUsed; // The clock when the file was last read or written
+  };
+
+  std::string _directory;                       // Where the cache files are stored, empty to not cache images
+  size_t _maxBytes = 0;                         // The size the cache is trimmed to
+  std::mutex _mutex;                            // Guards the index
+  std::unordered_map<uint64_t, Entry> _entries; // The cache files, by key
+  uint64_t _totalBytes = 0;                     // The size of every cache file in the index
+  uint64_t _clock = 0;                          // Counts uses, orders the entries from least to most recently used
+  bool _dirty = false;                          // The index changed since it was saved
+  std::atomic<uint64_t> _hits;                  // Images mapped from the cache
+  std::atomic<uint64_t> _misses;                // Images decoded because they weren't in the cache
+
+public:
+  ImageCache() : _hits(0), _misses(0) {}
+
+  // Saves the index
+  ~ImageCache();
+
+  // Delete copy ctor and assignment operator, the index is shared by the threads loading
+  ImageCache(const ImageCache&) = delete;
+  ImageCache& operator=(const ImageCache&) = delete;
+
+  /**
+   * Sets where decoded images are cached and reads the index stored there
+   *
+   * @param directory: An existing directory to store decoded images in, or empty to not cache them
+   * @param maxBytes:  The size the cache is trimmed to, least recently used images first
+   */
+  void init(const std::string& directory, size_t maxBytes = (size_t)1 << 30);
+
+  /**
+   * Loads an image, mapping its pixels from the cache if it was decoded before
+   * Behaves like Image::load() when caching is off
+   *
+   * @param path:     The image file to load
+   * @param image:    Filled with the pixels
+   * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+   * @param channels: The channels to convert to, or 0 to keep the file's
+   *
+   * @returns: True if the image was mapped or decoded
+   */
+  bool load(const std::string& path, Image& image, bool flip = true, int channels = 0);
+
+  /**
+   * Writes the index, if it changed
+   * Called when the cache is destroyed, call it sooner to keep the index if the process may not exit cleanly
+   */
+  void save();
+
+  // Gets the number of images mapped from the cache
+  uint64_t getHits() const
+  {
+    return _hits.load(std::memory_order_relaxed);
+  }
+
+  // Gets the number of images decoded because they weren't in the cache
+  uint64_t getMisses() const
+  {
+    return _misses.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Gets the size of the cache
+   *
+   * @returns: The size of every cache file in the index, in bytes
+   */
+  uint64_t getSize();
+
+private:
+  /**
+   * Gets the cache file for a key
+   *
+   * @param key: The key
+   */
+  std::string cachePath(uint64_t key) const;
+
+  /**
+   * Maps a cached image
+   *
+   * @param key:   The key it was stored under
+   * @param image: Filled with the pixels
+   *
+   * @returns: True if the file existed and was complete
+   */
+  bool read(uint64_t key, Image& image);
+
+  /**
+   * Stores a decoded image and trims the cache
+   * Written to a temporary file first, so other threads and processes never read a partial one
+   *
+   * @param key:   The key to store it under
+   * @param image: The decoded image
+   */
+  void write(uint64_t key, const Image& image);
+
+  /**
+   * Deletes the least recently used files until the cache fits its limit
+   * The mutex must be held
+   */
+  void trim();
+};
+
+#endif // !IMAGE_CACHE_H
@@ -0,0 +1,114 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <glad/glad.h>
+
+// Measures the latency between sampling input and presenting a frame
+// A GPU timestamp and a fence are inserted after each swap, and read back
+// a few frames later once the fence has signaled, so measuring never stalls
+class LatencyTracker
+{
+  // Number of frames that can be waiting on the GPU before a slot is reused
+  static const int FRAMES_IN_FLIGHT = 4;
+
+  // Number of frames between recalibrations of the GPU clock against the CPU clock
+  static const int CALIBRATION_INTERVAL = 120;
+
+  // Weight given to the newest sample in the running averages
+  static constexpr double AVERAGE_WEIGHT = 0.1;
+
+  // Timing data for a single frame that has not been resolved yet
+  struct Frame
+  {
+    double inputTime = 0.0; // CPU time input was sampled, in seconds
+    double swapTime = 0.0;  // CPU time glfwSwapBuffers returned, in seconds
+    GLuint query = 0;       // GL_TIMESTAMP query issued after the swap
+    GLsync fence = nullptr; // Fence signaled once the frame has finished on the GPU
+  };
+
+  Frame _frames[FRAMES_IN_FLIGHT]; // Ring of frames in flight
+  int _current = 0;                // Index of the frame being recorded
+  int _framesSinceCalibration = 0; // Frames since the clocks were last calibrated
+  double _gpuToCpuOffset = 0.0;    // Add to a GPU time (seconds) to get CPU time
+  bool _init = false;              // Tracks if the queries have been created
+
+  double _inputToSwap = 0.0;    // Latest input to swap return latency, in seconds
+  double _inputToGpu = 0.0;     // Latest input to GPU completion latency, in seconds
+  double _avgInputToSwap = 0.0; // Running average of input to swap latency
+  double _avgInputToGpu = 0.0;  // Running average of input to GPU completion latency
+  double _maxInputToGpu = 0.0;  // Worst input to GPU completion latency seen
+  unsigned long _samples = 0;   // Number of resolved frames
+
+public:
+  /**
+   * Creates the timestamp queries and calibrates the GPU clock
+   * Must be called with a current context
+   */
+  void init();
+
+  /**
+   * Deletes the queries and any fences still pending
+   * Must be called with a current context
+   */
+  void destroy();
+
+  /**
+   * Records the end of the current frame
+   * Should be called right after glfwSwapBuffers returns
+   * Resolves any older frames whose fence has signaled
+   *
+   * @param inputTime: The glfwGetTime() when input was last sampled for this frame
+   */
+  void endFrame(double inputTime);
+
+  // Gets the latest input to swap return latency, in milliseconds
+  double getInputToSwapMs() const
+  {
+    return _inputToSwap * 1000.0;
+  }
+
+  // Gets the latest input to GPU completion latency, in milliseconds
+  double getInputToGpuMs() const
+  {
+    return _inputToGpu * 1000.0;
+  }
+
+  // Gets the running average of the input to swap return latency, in milliseconds
+  double getAverageInputToSwapMs() const
+  {
+    return _avgInputToSwap * 1000.0;
+  }
+
+  // Gets the running average of the input to GPU completion latency, in milliseconds
+  double getAverageInputToGpuMs() const
+  {
+    return _avgInputToGpu * 1000.0;
+  }
+
+  // Gets the worst input to GPU completion latency seen, in milliseconds
+  double getMaxInputToGpuMs() const
+  {
+    return _maxInputToGpu * 1000.0;
+  }
+
+  // Gets the number of frames that have been measured
+  unsigned long getSampleCount() const
+  {
+    return _samples;
+  }
+
+private:
+  /**
+   * Reads back a frame's GPU timestamp and updates the statistics
+   *
+   * @param frame: The frame to resolve, its fence must have signaled
+   */
+  void resolve(Frame& frame);
+
+  /**
+   * Measures the offset between the GPU and CPU clocks
+   */
+  void calibrate();
+};
+
+#endif // !LATENCY_H
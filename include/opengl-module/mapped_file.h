@@ -0,0 +1,62 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// A read only file mapped into memory
+// Pages are read from disk when first touched, and can be handed straight to GL uploads without copying the file into a buffer first
+class MappedFile
+{
+  const unsigned char* _data = nullptr; // The start of the mapping
+  size_t _size = 0;                     // The size of the file, in bytes
+#ifdef _WIN32
+  void* _file = nullptr;    // The file handle
+  void* _mapping = nullptr; // The file mapping handle
+#endif
+
+public:
+  MappedFile() = default;
+
+  // Unmaps the file
+  ~MappedFile();
+
+  // Delete copy ctor and assignment operator, the mapping can only be released once
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Maps a file, unmapping the one mapped before
+   *
+   * @param path: The file to map
+   *
+   * @returns: True if the file was mapped
+   */
+  bool open(const std::string& path);
+
+  /**
+   * Unmaps the file
+   * Pointers into the mapping are invalid afterwards
+   */
+  void close();
+
+  // Checks if a file is mapped
+  bool isOpen() const
+  {
+    return _data != nullptr;
+  }
+
+  // Gets the start of the mapping
+  const unsigned char* getData() const
+  {
+    return _data;
+  }
+
+  // Gets the size of the file, in bytes
+  size_t getSize() const
+  {
+    return _size;
+  }
+};
+
+#endif // !MAPPED_FILE_H
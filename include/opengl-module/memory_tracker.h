@@ -0,0 +1,164 @@
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// The kinds of GL objects whose memory is tracked
+enum class MemoryKind
+{
+  Buffer,       // Buffer storage
+  Texture,      // Texture storage, including every mip level
+  Renderbuffer, // Renderbuffer storage
+  Program,      // Linked program binaries
+  Count
+};
+
+// The memory used by one tag
+struct MemoryUsage
+{
+  std::string tag;                              // The tag's name
+  int64_t bytes[(int)MemoryKind::Count] = {};   // Bytes currently allocated, per kind
+  int64_t total = 0;                            // Bytes currently allocated, all kinds
+  int64_t highWater = 0;                        // The most bytes allocated at once
+  int64_t frameDelta = 0;                       // Change in bytes over the last frame
+  int64_t budget = 0;                           // The budget in bytes, 0 if there is none
+};
+
+// Counts the bytes the wrappers allocate for GL objects, grouped by tags the app chooses
+// Objects are tagged with the calling thread's current tag when they are created, see MemoryTag
+// Sizes are computed from the sizes and formats requested, drivers may pad or compress them
+// Objects created with raw GL calls are not counted
+class MemoryTracker
+{
+public:
+  /**
+   * Gets the id of a tag, creating it the first time
+   * Tag 0 is "untagged", used when no tag has been set
+   *
+   * @param name: The tag's name
+   */
+  static int getTag(const std::string& name);
+
+  /**
+   * Gets the calling thread's current tag
+   */
+  static int getCurrentTag();
+
+  /**
+   * Sets the calling thread's current tag
+   * Objects created on this thread are counted under it
+   *
+   * @param tag: The tag's id, from getTag()
+   */
+  static void setCurrentTag(int tag);
+
+  /**
+   * Counts an allocation
+   * Safe to call from any thread
+   *
+   * @param kind:  The kind of object
+   * @param tag:   The tag to count it under
+   * @param bytes: The size of the allocation
+   */
+  static void allocate(MemoryKind kind, int tag, int64_t bytes);
+
+  /**
+   * Counts a release
+   * Safe to call from any thread
+   *
+   * @param kind:  The kind of object
+   * @param tag:   The tag it was counted under
+   * @param bytes: The size of the allocation
+   */
+  static void release(MemoryKind kind, int tag, int64_t bytes);
+
+  /**
+   * Sets a budget for a tag
+   * An error is printed the first time the tag goes over it, and again if it drops back under and goes over again
+   *
+   * @param name:  The tag's name
+   * @param bytes: The budget, 0 for none
+   */
+  static void setBudget(const std::string& name, int64_t bytes);
+
+  /**
+   * Ends the frame for the per frame deltas
+   * Called by GL every frame
+   */
+  static void endFrame();
+
+  /**
+   * Gets the memory used by every tag
+   */
+  static std::vector<MemoryUsage> getUsage();
+
+  /**
+   * Gets the bytes currently allocated under every tag
+   */
+  static int64_t getTotal();
+
+  /**
+   * Gets the most bytes allocated at once under every tag
+   */
+  static int64_t getHighWater();
+
+  /**
+   * Prints the memory used by every tag
+   *
+   * @param out: The stream to print to
+   */
+  static void printReport(std::ostream& out);
+
+  /**
+   * Computes the size of a texture's storage
+   *
+   * @param internalFormat: The sized internal format
+   * @param width:          The width of the base level, in pixels
+   * @param height:         The height of the base level, in pixels
+   * @param levels:         The number of mip levels
+   * @param layers:         The number of array layers or cube faces
+   *
+   * @returns: The size, in bytes
+   */
+  static int64_t textureBytes(GLenum internalFormat, int width, int height, int levels = 1, int layers = 1);
+
+  /**
+   * Gets the size of a linked program's binary, as an estimate of the memory it uses
+   * Must be called with a current context
+   *
+   * @param program: The program
+   */
+  static int64_t programBytes(GLuint program);
+};
+
+// Sets the calling thread's current tag for the scope it lives in
+class MemoryTag
+{
+  int _previous; // The tag to restore
+
+public:
+  /**
+   * MemoryTag Constructor
+   *
+   * @param name: The tag to count objects created in this scope under
+   */
+  explicit MemoryTag(const std::string& name) : _previous(MemoryTracker::getCurrentTag())
+  {
+    MemoryTracker::setCurrentTag(MemoryTracker::getTag(name));
+  }
+
+  // MemoryTag Destructor
+  ~MemoryTag()
+  {
+    MemoryTracker::setCurrentTag(_previous);
+  }
+
+  MemoryTag(const MemoryTag&) = delete;
+  MemoryTag& operator=(const MemoryTag&) = delete;
+};
+
+#endif // !MEMORY_TRACKER_H
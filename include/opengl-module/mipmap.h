@@ -0,0 +1,68 @@
+#ifndef MIPMAP_H
+#define MIPMAP_H
+
+#include <vector>
+
+class Image;
+class ThreadPool;
+
+// The filters a mip chain can be built with
+enum class MipFilter
+{
+  Box,   // Averages each 2x2 block, the fastest, vectorized for 4 channel images
+  Kaiser // A Kaiser windowed sinc, sharper mips with less aliasing
+};
+
+// One level of a mip chain, 8 bits per channel with rows tightly packed
+struct MipLevel
+{
+  int width = 0;                     // The width, in pixels
+  int height = 0;                    // The height, in pixels
+  std::vector<unsigned char> pixels; // The pixels
+};
+
+// Builds mip chains on the CPU, so the work is off the GPU timeline and the results can be cached
+// sRGB images are filtered in linear space, their alpha channel is left linear
+class MipGenerator
+{
+public:
+  /**
+   * Builds every level below the top one, down to 1x1
+   * Each level is half the size of the one above it, rounded down
+   *
+   * @param pixels:   The top level, 8 bits per channel with rows tightly packed
+   * @param width:    The width of the top level, in pixels
+   * @param height:   The height of the top level, in pixels
+   * @param channels: The channels per pixel, 1 to 4
+   * @param srgb:     Filter the color channels in linear space, for sRGB images with 3 or 4 channels
+   * @param filter:   The filter to use
+   * @param pool:     Splits each level's rows across the pool, or nullptr to do it all on the calling thread
+   *                  Must be nullptr when called from one of the pool's tasks
+   *
+   * @returns: The levels, from the largest to 1x1
+   */
+  static std::vector<MipLevel> generate(const unsigned char* pixels, int width, int height, int channels, bool srgb,
+                                        MipFilter filter = MipFilter::Box, ThreadPool* pool = nullptr);
+
+  /**
+   * Builds every level below an image, down to 1x1
+   *
+   * @param image:  The top level
+   * @param srgb:   Filter the color channels in linear space, for sRGB images with 3 or 4 channels
+   * @param filter: The filter to use
+   * @param pool:   Splits each level's rows across the pool, or nullptr to do it all on the calling thread
+   *                Must be nullptr when called from one of the pool's tasks
+   *
+   * @returns: The levels, from the largest to 1x1
+   */
+  static std::vector<MipLevel> generate(const Image& image, bool srgb, MipFilter filter = MipFilter::Box, ThreadPool* pool = nullptr);
+
+  /**
+   * Gets the instruction set the box filter was compiled for
+   *
+   * @returns: "AVX2", "SSE2", "NEON" or "scalar"
+   */
+  static const char* getSimdName();
+};
+
+#endif // !MIPMAP_H
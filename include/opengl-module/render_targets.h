@@ -0,0 +1,142 @@
+#ifndef RENDER_TARGETS_H
+#define RENDER_TARGETS_H
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+// Describes how an offscreen render target should be allocated
+struct RenderTargetDesc
+{
+  GLenum colorFormat = GL_RGBA8;             // Sized format of the color texture, 0 for none
+  GLenum depthFormat = GL_DEPTH24_STENCIL8;  // Sized format of the depth renderbuffer, 0 for none
+  float scale = 1.0f;                        // Size relative to the framebuffer
+};
+
+// An allocated offscreen render target
+struct RenderTarget
+{
+  GLuint framebuffer = 0; // The framebuffer object
+  GLuint color = 0;       // The color texture, 0 if there is none
+  GLuint depth = 0;       // The depth renderbuffer, 0 if there is none
+  int width = 0;          // The width of the attachments, in pixels
+  int height = 0;         // The height of the attachments, in pixels
+};
+
+// Manages a set of offscreen render targets that follow the framebuffer size
+// Reallocation is deferred until the size has stopped changing for a few frames,
+// so interactively resizing a window doesn't reallocate every target every frame
+class RenderTargets
+{
+  // A render target and the description it is allocated from
+  struct Entry
+  {
+    std::string name;
+    RenderTargetDesc desc;
+    RenderTarget target;
+    int memoryTag; // The MemoryTracker tag the attachments are counted under
+  };
+
+  std::vector<Entry> _entries; // All of the managed targets
+
+  int _width = 0;         // The framebuffer width the targets are allocated for
+  int _height = 0;        // The framebuffer height the targets are allocated for
+  int _pendingWidth = 0;  // The latest framebuffer width
+  int _pendingHeight = 0; // The latest framebuffer height
+  int _stableFrames = 0;  // Frames the pending size has stayed the same
+  int _settleFrames = 3;  // Frames the size must be stable before reallocating
+
+  unsigned long _reallocations = 0; // Number of times the targets were reallocated
+
+public:
+  // Delete copy ctor and assignment operator, the targets own GL objects
+  RenderTargets() = default;
+  RenderTargets(const RenderTargets&) = delete;
+  RenderTargets& operator=(const RenderTargets&) = delete;
+
+  /**
+   * Adds a render target
+   * It is allocated on the next call to update(), and its memory is counted under the calling thread's MemoryTracker tag
+   *
+   * @param name: The name to look the target up by
+   * @param desc: How to allocate the target
+   *
+   * @returns: A handle that can be passed to get()
+   */
+  int add(const std::string& name, const RenderTargetDesc& desc = RenderTargetDesc());
+
+  /**
+   * Gets a render target by handle
+   *
+   * @param handle: The handle returned by add()
+   *
+   * @returns: The render target
+   */
+  const RenderTarget& get(int handle) const
+  {
+    return _entries[handle].target;
+  }
+
+  /**
+   * Gets a render target by name
+   *
+   * @param name: The name given to add()
+   *
+   * @returns: The render target, or nullptr if there is none with that name
+   */
+  const RenderTarget* get(const std::string& name) const;
+
+  /**
+   * Records a new framebuffer size
+   * The targets are not reallocated until the size has settled
+   *
+   * @param width:  The new framebuffer width, in pixels
+   * @param height: The new framebuffer height, in pixels
+   */
+  void resize(int width, int height);
+
+  /**
+   * Allocates new targets and reallocates existing ones once a resize has settled
+   * Called by GL every frame before the render callback
+   */
+  void update();
+
+  /**
+   * Sets how many frames the framebuffer size must stay the same before reallocating
+   *
+   * @param frames: The number of frames, 0 reallocates immediately
+   */
+  void setSettleFrames(int frames)
+  {
+    _settleFrames = frames;
+  }
+
+  // Gets the number of times the targets have been reallocated
+  unsigned long getReallocationCount() const
+  {
+    return _reallocations;
+  }
+
+  /**
+   * Deletes all of the targets
+   * Must be called with a current context
+   */
+  void destroy();
+
+private:
+  /**
+   * Allocates the GL objects for a target at the current size
+   *
+   * @param entry: The target to allocate, any existing objects are deleted first
+   */
+  void allocate(Entry& entry);
+
+  /**
+   * Deletes the GL objects for a target
+   *
+   * @param entry: The target to release
+   */
+  static void release(Entry& entry);
+};
+
+#endif // !RENDER_TARGETS_H
@@ -0,0 +1,167 @@
+#ifndef RESOURCE_LOADER_H
+#define RESOURCE_LOADER_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A job run on the loader thread
+// Creates and fills a GL object and returns its name
+typedef std::function<GLuint()> UploadJob;
+
+// Tracks a job submitted to the ResourceLoader
+// The object it created may only be used once isReady() returns true
+class Upload
+{
+  friend class ResourceLoader;
+
+  std::atomic<bool> _submitted; // Set by the loader thread once the fence has been inserted
+  GLsync _fence = nullptr;      // Signaled once the GPU has finished the upload
+  GLuint _object = 0;           // The object created by the job
+  bool _ready = false;          // Cached once the fence has been seen signaled
+  bool _failed = false;         // Set if the job was never queued, because the loader wasn't running
+
+public:
+  Upload() : _submitted(false) {}
+
+  // Delete copy ctor and assignment operator, the loader thread holds a reference
+  Upload(const Upload&) = delete;
+  Upload& operator=(const Upload&) = delete;
+
+  // Deletes the fence if it was never waited on
+  ~Upload();
+
+  /**
+   * Checks if the upload has finished, without blocking
+   * Must be called on a thread with a context that shares objects with the loader
+   *
+   * @returns: True once the object can be used
+   */
+  bool isReady();
+
+  /**
+   * Blocks until the upload has finished, returns straight away if it failed
+   * Must be called on a thread with a context that shares objects with the loader
+   */
+  void wait();
+
+  // Checks if the job was rejected because the loader wasn't running, the object is never created
+  bool isFailed() const
+  {
+    return _failed;
+  }
+
+  /**
+   * Gets the object created by the job
+   * Only valid once isReady() has returned true
+   */
+  GLuint getObject() const
+  {
+    return _object;
+  }
+};
+
+// Runs GL uploads on a background thread
+// The thread owns a hidden context sharing objects with the main window,
+// so buffers and textures can be created and filled without stalling the render loop
+class ResourceLoader
+{
+  // A job waiting to be run
+  struct Job
+  {
+    UploadJob job;
+    std::shared_ptr<Upload> upload;
+  };
+
+  GLFWwindow* _context = nullptr; // The hidden window owning the loader's context
+  std::thread _thread;            // The loader thread
+  std::mutex _mutex;              // Guards the job queue
+  std::condition_variable _wake;  // Signaled when a job is queued or the loader is stopped
+  std::deque<Job> _jobs;          // Jobs waiting to be run
+  bool _stop = false;             // Tells the loader thread to exit
+
+public:
+  ResourceLoader() = default;
+
+  // Delete copy ctor and assignment operator, the loader owns a thread
+  ResourceLoader(const ResourceLoader&) = delete;
+  ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+  // Stops the loader thread
+  ~ResourceLoader();
+
+  /**
+   * Creates the hidden shared context and starts the loader thread
+   * Must be called on the main thread, because GLFW can only create windows there
+   *
+   * @param shareWindow:   The window whose context objects should be shared with
+   * @param windowVisible: The GLFW_VISIBLE hint to restore afterwards, so later windows are shown or hidden like the main one
+   *
+   * @returns: True if the loader started
+   */
+  bool start(GLFWwindow* shareWindow, bool windowVisible = true);
+
+  /**
+   * Finishes the queued jobs, stops the loader thread and destroys its context
+   * Must be called on the main thread
+   */
+  void stop();
+
+  // Checks if the loader thread is running
+  bool isRunning() const
+  {
+    return _context != nullptr;
+  }
+
+  /**
+   * Queues a job to run on the loader thread
+   * Fails if the loader isn't running, since nothing would ever run the job
+   * The job's GL calls are not recorded by Capture, unlike uploadBuffer() and uploadTexture2D()
+   *
+   * @param job: A function that creates and fills a GL object, returning its name
+   *
+   * @returns: A handle to check when the object is ready to be used, marked failed if the loader isn't running
+   */
+  std::shared_ptr<Upload> submit(UploadJob job);
+
+  /**
+   * Queues the creation of an immutable buffer
+   * Its memory is counted under the calling thread's MemoryTracker tag, and stays counted because the caller deletes it
+   *
+   * @param data:  The contents of the buffer
+   * @param flags: The storage flags passed to glNamedBufferStorage
+   *
+   * @returns: A handle to the buffer
+   */
+  std::shared_ptr<Upload> uploadBuffer(std::vector<unsigned char> data, GLbitfield flags = 0);
+
+  /**
+   * Queues the creation of a 2D texture with a full mip chain
+   * Its memory is counted under the calling thread's MemoryTracker tag, and stays counted because the caller deletes it
+   *
+   * @param width:          The width of the texture, in pixels
+   * @param height:         The height of the texture, in pixels
+   * @param internalFormat: The sized internal format
+   * @param format:         The format of the pixel data
+   * @param type:           The type of the pixel data
+   * @param pixels:         The pixel data for the top level
+   *
+   * @returns: A handle to the texture
+   */
+  std::shared_ptr<Upload> uploadTexture2D(int width, int height, GLenum internalFormat, GLenum format, GLenum type, std::vector<unsigned char> pixels);
+
+private:
+  /**
+   * Runs jobs on the loader thread until the loader is stopped
+   */
+  void threadMain();
+};
+
+#endif // !RESOURCE_LOADER_H
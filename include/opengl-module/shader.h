@@ -7,11 +7,16 @@
 // Wrapper for a shader program in OpenGL
 class Shader
 {
-  GLuint _id; // the program ID
+  GLuint _id = 0; // the program ID, 0 until initialized so use() binds no program
 
   bool _init = false;             // Track if the shader has been initialized
   bool _initErrorPrinted = false; // Track if an error message about the init status has been printed
 
+#ifdef OPENGL_MODULE_NO_ERROR_CHECKS
+  int _memoryTag = 0;         // The MemoryTracker tag the program is counted under when it is first used
+  bool _memoryCounted = true; // Track if the program's size has been counted
+#endif
+
 public:
   /**
    * Shader Default Constructor
@@ -39,6 +44,16 @@ public:
    */
   void init(const char* vertexPath, const char* fragmentPath);
 
+  /**
+   * Initializes the shader from source code instead of files
+   * Compile the vertex and fragment shaders
+   * Attaches them to a shader program and links it
+   *
+   * @param vertexCode:   The source of the vertex shader
+   * @param fragmentCode: The source of the fragment shader
+   */
+  void initFromSource(const std::string& vertexCode, const std::string& fragmentCode);
+
   /**
    * Instructs OpenGL to use this shader for rendering
    */
@@ -0,0 +1,258 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+#include <glad/glad.h>
+
+// Shadows the GL state of one context and skips calls that wouldn't change it
+// Every context has its own state, so GL keeps one cache per context and makes it
+// current on the thread along with the context. Code that changes state with raw GL calls
+// must call invalidate() afterwards, or the cache may skip a call that was needed
+class StateCache
+{
+public:
+  static const int MAX_TEXTURE_UNITS = 32;   // Texture and sampler units tracked
+  static const int MAX_BUFFER_BINDINGS = 16; // Indexed uniform and storage buffer bindings tracked
+
+private:
+  // Value meaning the state is unknown, so the next call is always issued
+  static const GLuint UNKNOWN = 0xFFFFFFFFu;
+
+  // Non-indexed buffer targets tracked, other targets are always issued
+  static const int BUFFER_TARGET_COUNT = 8;
+
+  // Capabilities tracked by enable() and disable(), others are always issued
+  static const int CAPABILITY_COUNT = 9;
+
+  GLuint _program;                                      // Bound shader program
+  GLuint _vertexArray;                                  // Bound vertex array
+  GLuint _drawFramebuffer;                              // Bound draw framebuffer
+  GLuint _readFramebuffer;                              // Bound read framebuffer
+  GLuint _buffers[BUFFER_TARGET_COUNT];                 // Bound buffer per target
+  GLuint _uniformBuffers[MAX_BUFFER_BINDINGS];          // Bound uniform buffer per index
+  GLuint _storageBuffers[MAX_BUFFER_BINDINGS];          // Bound shader storage buffer per index
+  GLuint _textures[MAX_TEXTURE_UNITS];                  // Bound texture per unit
+  GLuint _samplers[MAX_TEXTURE_UNITS];                  // Bound sampler per unit
+  GLuint _capabilities[CAPABILITY_COUNT];               // 0 disabled, 1 enabled, or UNKNOWN
+  GLuint _blendSource, _blendDestination;               // Blend factors
+  GLuint _depthFunc;                                    // Depth comparison function
+  GLuint _depthMask;                                    // Depth write mask
+  GLuint _cullFace;                                     // Faces culled
+  GLuint _unpackAlignment;                              // GL_UNPACK_ALIGNMENT
+  GLint _viewport[4];                                   // Viewport rectangle
+  bool _viewportKnown;                                  // Tracks if _viewport is valid
+
+  unsigned long _issued = 0; // Calls passed on to GL
+  unsigned long _elided = 0; // Calls skipped because they wouldn't change anything
+
+public:
+  // StateCache Constructor
+  // Starts with all state unknown
+  StateCache();
+
+  /**
+   * Gets the cache for the context current on this thread
+   * If none has been made current, a per-thread cache is used
+   */
+  static StateCache& current();
+
+  /**
+   * Makes this the cache used by current() on this thread
+   * Should be called whenever this cache's context is made current
+   */
+  void makeCurrent();
+
+  /**
+   * Prints an error the first time a thread without a current context tries to use GL
+   * The wrappers call this before touching GL, because while the submission thread owns the context
+   * only commands enqueued on it may use them. Compiled out with OPENGL_MODULE_NO_ERROR_CHECKS
+   *
+   * @param caller: The function about to call GL, named in the error
+   */
+#ifdef OPENGL_MODULE_NO_ERROR_CHECKS
+  static void checkContext(const char*) {}
+#else
+  static void checkContext(const char* caller);
+#endif
+
+  /**
+   * Forgets all tracked state
+   * Call this after changing state with raw GL calls
+   */
+  void invalidate();
+
+  /**
+   * Binds a shader program
+   *
+   * @param program: The program to use
+   */
+  void useProgram(GLuint program);
+
+  /**
+   * Binds a vertex array
+   *
+   * @param vertexArray: The vertex array to bind
+   */
+  void bindVertexArray(GLuint vertexArray);
+
+  /**
+   * Binds a buffer to a target
+   *
+   * @param target: The target to bind to
+   * @param buffer: The buffer to bind
+   */
+  void bindBuffer(GLenum target, GLuint buffer);
+
+  /**
+   * Binds a buffer to an indexed uniform or shader storage binding point
+   *
+   * @param target: GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+   * @param index:  The binding index
+   * @param buffer: The buffer to bind
+   */
+  void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+
+  /**
+   * Binds a texture to a texture unit
+   *
+   * @param unit:    The texture unit
+   * @param texture: The texture to bind
+   */
+  void bindTexture(GLuint unit, GLuint texture);
+
+  /**
+   * Binds a sampler to a texture unit
+   *
+   * @param unit:    The texture unit
+   * @param sampler: The sampler to bind
+   */
+  void bindSampler(GLuint unit, GLuint sampler);
+
+  /**
+   * Binds a framebuffer
+   *
+   * @param target:      GL_FRAMEBUFFER, GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER
+   * @param framebuffer: The framebuffer to bind
+   */
+  void bindFramebuffer(GLenum target, GLuint framebuffer);
+
+  /**
+   * Enables a capability
+   *
+   * @param capability: The capability, like GL_BLEND or GL_DEPTH_TEST
+   */
+  void enable(GLenum capability);
+
+  /**
+   * Disables a capability
+   *
+   * @param capability: The capability, like GL_BLEND or GL_DEPTH_TEST
+   */
+  void disable(GLenum capability);
+
+  /**
+   * Sets the blend factors
+   *
+   * @param source:      The source factor
+   * @param destination: The destination factor
+   */
+  void blendFunc(GLenum source, GLenum destination);
+
+  /**
+   * Sets the depth comparison function
+   *
+   * @param func: The comparison function
+   */
+  void depthFunc(GLenum func);
+
+  /**
+   * Sets if depth is written
+   *
+   * @param write: True to write depth
+   */
+  void depthMask(bool write);
+
+  /**
+   * Sets which faces are culled
+   *
+   * @param mode: GL_FRONT, GL_BACK or GL_FRONT_AND_BACK
+   */
+  void cullFace(GLenum mode);
+
+  /**
+   * Sets the viewport
+   *
+   * @param x:      The left edge, in pixels
+   * @param y:      The bottom edge, in pixels
+   * @param width:  The width, in pixels
+   * @param height: The height, in pixels
+   */
+  void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  /**
+   * Sets the row alignment of pixel data read from client memory or the unpack buffer
+   *
+   * @param alignment: 1, 2, 4 or 8
+   */
+  void unpackAlignment(GLint alignment);
+
+  // Forgets a program about to be deleted, so its name can be reused safely
+  void forgetProgram(GLuint program);
+
+  // Forgets a vertex array about to be deleted, so its name can be reused safely
+  void forgetVertexArray(GLuint vertexArray);
+
+  // Forgets a buffer about to be deleted, so its name can be reused safely
+  void forgetBuffer(GLuint buffer);
+
+  // Forgets a texture about to be deleted, so its name can be reused safely
+  void forgetTexture(GLuint texture);
+
+  // Forgets a framebuffer about to be deleted, so its name can be reused safely
+  void forgetFramebuffer(GLuint framebuffer);
+
+  // Gets the number of calls passed on to GL
+  unsigned long getIssuedCalls() const
+  {
+    return _issued;
+  }
+
+  // Gets the number of calls skipped because they wouldn't change anything
+  unsigned long getElidedCalls() const
+  {
+    return _elided;
+  }
+
+  // Resets the issued and elided counters
+  void resetCounters()
+  {
+    _issued = 0;
+    _elided = 0;
+  }
+
+private:
+  /**
+   * Updates a tracked value and counts the call
+   *
+   * @param slot:  The tracked value
+   * @param value: The new value
+   *
+   * @returns: True if the value changed and the call should be issued
+   */
+  bool change(GLuint& slot, GLuint value);
+
+  /**
+   * Gets the slot for a non-indexed buffer target
+   *
+   * @returns: The index into _buffers, or -1 if the target isn't tracked
+   */
+  static int bufferTargetIndex(GLenum target);
+
+  /**
+   * Gets the slot for a capability
+   *
+   * @returns: The index into _capabilities, or -1 if the capability isn't tracked
+   */
+  static int capabilityIndex(GLenum capability);
+};
+
+#endif // !STATE_CACHE_H
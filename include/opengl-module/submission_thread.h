@@ -0,0 +1,124 @@
+#ifndef SUBMISSION_THREAD_H
+#define SUBMISSION_THREAD_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <opengl-module/command_ring.h>
+#include <atomic>
+#include <thread>
+
+class StateCache;
+
+// Owns a context on a dedicated thread and replays GL work recorded by another thread
+// The recording thread never waits on the driver, except at explicit sync points
+// like finish() and call(), which are needed to read anything back from GL
+// Only enqueued commands may use GL, including the wrappers, the recording thread has no context
+class SubmissionThread
+{
+  CommandRing _ring;                 // Commands recorded but not yet run
+  std::thread _thread;               // The submission thread
+  std::atomic<bool> _stop;           // Tells the submission thread to exit once the ring is empty
+  GLFWwindow* _window = nullptr;     // The window whose context the thread owns
+  StateCache* _stateCache = nullptr; // The cache of that context
+
+public:
+  SubmissionThread() : _stop(false) {}
+
+  // Delete copy ctor and assignment operator, the thread holds a pointer to this
+  SubmissionThread(const SubmissionThread&) = delete;
+  SubmissionThread& operator=(const SubmissionThread&) = delete;
+
+  // Stops the submission thread
+  ~SubmissionThread();
+
+  /**
+   * Moves a window's context to the submission thread
+   * The context must be current on the calling thread, it is released before the thread starts
+   *
+   * @param window:     The window whose context the thread should own
+   * @param stateCache: The state cache of that context
+   */
+  void start(GLFWwindow* window, StateCache& stateCache);
+
+  /**
+   * Runs the remaining commands, stops the thread and makes the context current on the calling thread again
+   */
+  void stop();
+
+  // Checks if the submission thread is running
+  bool isRunning() const
+  {
+    return _window != nullptr;
+  }
+
+  /**
+   * Records a command to run on the submission thread
+   * Must only be called from the thread that started it
+   *
+   * @param command: A function object taking no arguments that makes GL calls
+   *                 Its captures must be trivially copyable and fit in CommandRing::PAYLOAD_SIZE,
+   *                 so capture pointers to anything larger and keep it alive until a sync point
+   */
+  template <typename F>
+  void enqueue(const F& command)
+  {
+    _ring.push(command);
+  }
+
+  /**
+   * Sync point: blocks until every command recorded so far has run
+   */
+  void finish();
+
+  /**
+   * Sync point: blocks until a number of commands have run
+   * Pass getRecorded() from just after a command was enqueued to wait for that command
+   *
+   * @param count: The number of commands, compared with getExecuted()
+   */
+  void waitForExecuted(uint64_t count)
+  {
+    _ring.waitForExecuted(count);
+  }
+
+  /**
+   * Sync point: runs a function on the submission thread and waits for its result
+   * Use this for queries and readbacks
+   *
+   * @param function: A function object taking no arguments, returning the result
+   *
+   * @returns: The function's result
+   */
+  template <typename R, typename F>
+  R call(const F& function)
+  {
+    R result = R();
+    R* resultPtr = &result;
+    const F* functionPtr = &function;
+
+    _ring.push([resultPtr, functionPtr]() { *resultPtr = (*functionPtr)(); });
+    finish();
+
+    return result;
+  }
+
+  // Gets the number of commands recorded so far
+  uint64_t getRecorded() const
+  {
+    return _ring.getRecorded();
+  }
+
+  // Gets the number of commands run so far
+  uint64_t getExecuted() const
+  {
+    return _ring.getExecuted();
+  }
+
+private:
+  /**
+   * Makes the context current and replays commands until stopped
+   */
+  void threadMain();
+};
+
+#endif // !SUBMISSION_THREAD_H
@@ -0,0 +1,387 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Image;
+struct CompressedLevel;
+struct MipLevel;
+
+// Wrapper for an immutable 2D texture in OpenGL
+// Storage is allocated once with every mip level, and edited with DSA calls, so nothing is bound to edit it
+// Binds go through the StateCache, so redundant binds are skipped
+class Texture2D
+{
+  GLuint _id = 0;               // The texture ID
+  int _width = 0;               // The width of the top level, in pixels
+  int _height = 0;              // The height of the top level, in pixels
+  int _levels = 0;              // The number of mip levels
+  GLenum _internalFormat = 0;   // The sized internal format
+  int _memoryTag = 0;           // The MemoryTracker tag the storage is counted under
+  bool _init = false;           // Track if the texture has been initialized
+
+public:
+  /**
+   * Texture2D Default Constructor
+   * DOES NOT INITIALIZE
+   * After constructing a Texture2D, you must call Texture2D::init()
+   */
+  Texture2D() = default;
+
+  /**
+   * Texture2D Constructor
+   *
+   * @param path: The image file to load
+   * @param srgb: Store the color channels as sRGB, for color maps
+   */
+  explicit Texture2D(const std::string& path, bool srgb = false);
+
+  /**
+   * Initializes the texture from an image file
+   * Decodes it with stb_image, uploads it and generates the mip chain
+   *
+   * @param path: The image file to load
+   * @param srgb: Store the color channels as sRGB, for color maps
+   *
+   * @returns: True if the image was loaded
+   */
+  bool init(const std::string& path, bool srgb = false);
+
+  /**
+   * Initializes the texture from a decoded image
+   * Uploads it and generates the mip chain
+   *
+   * @param image: The image to upload
+   * @param srgb:  Store the color channels as sRGB, for color maps
+   *
+   * @returns: True if the image held pixels
+   */
+  bool init(const Image& image, bool srgb = false);
+
+  /**
+   * Initializes the texture from a decoded image and mips built on the CPU
+   * Every level is uploaded as is, nothing is generated on the GPU
+   *
+   * @param image: The top level
+   * @param mips:  The levels below it, from MipGenerator::generate()
+   * @param srgb:  Store the color channels as sRGB, for color maps
+   *
+   * @returns: True if the image held pixels
+   */
+  bool init(const Image& image, const std::vector<MipLevel>& mips, bool srgb = false);
+
+  /**
+   * Initializes the texture from block compressed levels, from BlockCompressor or TextureCooker
+   * Every level is uploaded as is
+   *
+   * @param levels:         The levels, from the top one down
+   * @param internalFormat: The compressed internal format the levels were encoded to
+   *
+   * @returns: True if there was a level to upload
+   */
+  bool init(const std::vector<CompressedLevel>& levels, GLenum internalFormat);
+
+  /**
+   * Initializes the texture with uninitialized storage
+   *
+   * @param width:          The width of the top level, in pixels
+   * @param height:         The height of the top level, in pixels
+   * @param internalFormat: The sized internal format
+   * @param levels:         The number of mip levels, or 0 for a full chain down to 1x1
+   */
+  void init(int width, int height, GLenum internalFormat, int levels = 0);
+
+  /**
+   * Deletes the texture
+   */
+  void destroy();
+
+  /**
+   * Replaces part of a mip level
+   *
+   * @param level:  The mip level
+   * @param x:      The left edge of the region, in pixels
+   * @param y:      The bottom edge of the region, in pixels
+   * @param width:  The width of the region, in pixels
+   * @param height: The height of the region, in pixels
+   * @param format: The format of the pixel data
+   * @param type:   The type of the pixel data
+   * @param pixels: The pixel data, rows tightly packed
+   */
+  void setData(int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels);
+
+  /**
+   * Replaces part of a mip level from the buffer bound to GL_PIXEL_UNPACK_BUFFER
+   * The copy is done by the GPU, so the call returns without waiting for it
+   *
+   * @param level:  The mip level
+   * @param x:      The left edge of the region, in pixels
+   * @param y:      The bottom edge of the region, in pixels
+   * @param width:  The width of the region, in pixels
+   * @param height: The height of the region, in pixels
+   * @param format: The format of the pixel data
+   * @param type:   The type of the pixel data
+   * @param offset: The offset of the pixel data in the buffer, rows tightly packed
+   * @param mapped: The same pixel data through the buffer's mapping, used to record captures
+   */
+  void setDataFromUnpackBuffer(int level, int x, int y, int width, int height, GLenum format, GLenum type, size_t offset, const void* mapped);
+
+  /**
+   * Replaces part of a mip level of a block compressed texture
+   *
+   * @param level:  The mip level
+   * @param x:      The left edge of the region, in pixels, a multiple of 4
+   * @param y:      The bottom edge of the region, in pixels, a multiple of 4
+   * @param width:  The width of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+   * @param height: The height of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+   * @param size:   The size of the blocks, in bytes
+   * @param blocks: The blocks, rows of blocks tightly packed
+   */
+  void setCompressedData(int level, int x, int y, int width, int height, size_t size, const void* blocks);
+
+  /**
+   * Fills every mip level below the top one from the top level
+   */
+  void generateMipmaps();
+
+  /**
+   * Sets the texture's filtering
+   *
+   * @param minFilter: The minification filter
+   * @param magFilter: The magnification filter
+   */
+  void setFilter(GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Sets the texture's wrap modes
+   *
+   * @param wrapS: The wrap mode for the horizontal axis
+   * @param wrapT: The wrap mode for the vertical axis
+   */
+  void setWrap(GLenum wrapS, GLenum wrapT);
+
+  /**
+   * Binds the texture to a texture unit
+   *
+   * @param unit: The texture unit
+   */
+  void bind(GLuint unit) const;
+
+  /**
+   * Gets the id of the texture
+   *
+   * @returns: The id of the texture
+   */
+  GLuint getID() const
+  {
+    return _id;
+  }
+
+  // Gets the width of the top level, in pixels
+  int getWidth() const
+  {
+    return _width;
+  }
+
+  // Gets the height of the top level, in pixels
+  int getHeight() const
+  {
+    return _height;
+  }
+
+  // Gets the number of mip levels
+  int getLevels() const
+  {
+    return _levels;
+  }
+
+  // Gets the sized internal format
+  GLenum getInternalFormat() const
+  {
+    return _internalFormat;
+  }
+
+  /**
+   * Counts the mip levels in a full chain down to 1x1
+   *
+   * @param width:  The width of the top level, in pixels
+   * @param height: The height of the top level, in pixels
+   */
+  static int mipLevels(int width, int height);
+
+  /**
+   * Picks the sized internal format for 8 bit pixels
+   *
+   * @param channels: The channels per pixel, 1 to 4
+   * @param srgb:     Store the color channels as sRGB, only possible with 3 or 4 channels
+   */
+  static GLenum internalFormatFor(int channels, bool srgb);
+
+  /**
+   * Picks the pixel format for a number of channels
+   *
+   * @param channels: The channels per pixel, 1 to 4
+   */
+  static GLenum formatFor(int channels);
+
+  /**
+   * Gets the size of one pixel of client data
+   *
+   * @param format: The format of the pixel data
+   * @param type:   The type of the pixel data
+   *
+   * @returns: The size in bytes, or 0 if the format or type isn't known
+   */
+  static int pixelBytes(GLenum format, GLenum type);
+};
+
+// Wrapper for an immutable texture with layers: GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_CUBE_MAP_ARRAY, or a plain GL_TEXTURE_2D
+// Layers of arrays and faces of cube maps are both addressed as layers, faces in the order +X, -X, +Y, -Y, +Z, -Z,
+// so cube map arrays hold 6 layers per cube. Edited with DSA calls like Texture2D, and bound through the StateCache
+class Texture
+{
+  GLuint _id = 0;             // The texture ID
+  GLenum _target = 0;         // The texture target
+  int _width = 0;             // The width of the top level, in pixels
+  int _height = 0;            // The height of the top level, in pixels
+  int _layers = 0;            // The number of layers, 6 per cube for cube maps, 1 for 2D textures
+  int _levels = 0;            // The number of mip levels
+  GLenum _internalFormat = 0; // The sized internal format
+  int _memoryTag = 0;         // The MemoryTracker tag the storage is counted under
+  bool _init = false;         // Track if the texture has been initialized
+
+public:
+  /**
+   * Texture Default Constructor
+   * DOES NOT INITIALIZE
+   * After constructing a Texture, you must call Texture::init()
+   */
+  Texture() = default;
+
+  /**
+   * Initializes the texture with uninitialized storage
+   *
+   * @param target:         GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_CUBE_MAP_ARRAY
+   * @param width:          The width of the top level, in pixels
+   * @param height:         The height of the top level, in pixels
+   * @param layers:         The number of layers, 6 per cube for cube maps, ignored for 2D textures
+   * @param internalFormat: The sized internal format
+   * @param levels:         The number of mip levels, or 0 for a full chain down to 1x1
+   */
+  void init(GLenum target, int width, int height, int layers, GLenum internalFormat, int levels = 0);
+
+  /**
+   * Deletes the texture
+   */
+  void destroy();
+
+  /**
+   * Replaces part of a mip level, over a range of layers
+   *
+   * @param level:  The mip level
+   * @param x:      The left edge of the region, in pixels
+   * @param y:      The bottom edge of the region, in pixels
+   * @param layer:  The first layer
+   * @param width:  The width of the region, in pixels
+   * @param height: The height of the region, in pixels
+   * @param layers: The number of layers
+   * @param format: The format of the pixel data
+   * @param type:   The type of the pixel data
+   * @param pixels: The pixel data, rows and layers tightly packed
+   */
+  void setData(int level, int x, int y, int layer, int width, int height, int layers, GLenum format, GLenum type, const void* pixels);
+
+  /**
+   * Replaces part of a mip level of a block compressed texture, over a range of layers
+   *
+   * @param level:  The mip level
+   * @param x:      The left edge of the region, in pixels, a multiple of 4
+   * @param y:      The bottom edge of the region, in pixels, a multiple of 4
+   * @param layer:  The first layer
+   * @param width:  The width of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+   * @param height: The height of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+   * @param layers: The number of layers
+   * @param size:   The size of the blocks, in bytes
+   * @param blocks: The blocks, rows of blocks and layers tightly packed
+   */
+  void setCompressedData(int level, int x, int y, int layer, int width, int height, int layers, size_t size, const void* blocks);
+
+  /**
+   * Fills every mip level below the top one from the top level, for every layer
+   */
+  void generateMipmaps();
+
+  /**
+   * Sets the texture's filtering
+   *
+   * @param minFilter: The minification filter
+   * @param magFilter: The magnification filter
+   */
+  void setFilter(GLenum minFilter, GLenum magFilter);
+
+  /**
+   * Sets the texture's wrap modes
+   *
+   * @param wrapS: The wrap mode for the horizontal axis
+   * @param wrapT: The wrap mode for the vertical axis
+   */
+  void setWrap(GLenum wrapS, GLenum wrapT);
+
+  /**
+   * Binds the texture to a texture unit
+   *
+   * @param unit: The texture unit
+   */
+  void bind(GLuint unit) const;
+
+  /**
+   * Gets the id of the texture
+   *
+   * @returns: The id of the texture
+   */
+  GLuint getID() const
+  {
+    return _id;
+  }
+
+  // Gets the texture target
+  GLenum getTarget() const
+  {
+    return _target;
+  }
+
+  // Gets the width of the top level, in pixels
+  int getWidth() const
+  {
+    return _width;
+  }
+
+  // Gets the height of the top level, in pixels
+  int getHeight() const
+  {
+    return _height;
+  }
+
+  // Gets the number of layers, 6 per cube for cube maps
+  int getLayers() const
+  {
+    return _layers;
+  }
+
+  // Gets the number of mip levels
+  int getLevels() const
+  {
+    return _levels;
+  }
+
+  // Gets the sized internal format
+  GLenum getInternalFormat() const
+  {
+    return _internalFormat;
+  }
+};
+
+#endif // !TEXTURE_H
@@ -0,0 +1,149 @@
+#ifndef TEXTURE_ARRAY_POOL_H
+#define TEXTURE_ARRAY_POOL_H
+
+#include <glad/glad.h>
+#include <opengl-module/texture.h>
+#include <cstddef>
+#include <vector>
+
+class Image;
+
+// An image in a TextureArrayPool, everything a shader needs to sample it
+struct TextureLayer
+{
+  int array = -1;     // The array holding the image, an index into the pool, -1 if there is none
+  int layer = -1;     // The layer, the third coordinate given to a sampler2DArray
+  GLuint texture = 0; // The array's texture ID
+};
+
+// Groups images of the same size, format and mip count into GL_TEXTURE_2D_ARRAY textures
+// Materials in the same array only differ by a layer index, so draws switching between them need no texture binds
+// Layers are handed out from free lists, and released layers are reused by the next image of the same kind
+// Pixels are queued when added and uploaded by flush(), one glTextureSubImage3D per mip level for each run of neighbouring layers
+class TextureArrayPool
+{
+  // An image waiting to be uploaded
+  struct Pending
+  {
+    int layer;                         // The layer it goes to
+    std::vector<unsigned char> pixels; // The top level, rows tightly packed
+  };
+
+  // One texture array, and the layers handed out from it
+  struct Array
+  {
+    Texture texture;              // The texture
+    int channels = 0;             // The channels per pixel of the images
+    bool srgb = false;            // The color channels are stored as sRGB
+    int nextLayer = 0;            // Layers from here up have never been handed out
+    int usedLayers = 0;           // The number of layers holding an image
+    std::vector<int> freeLayers;  // Layers that were released, reused first
+    std::vector<Pending> pending; // Images waiting to be uploaded, in the order they were added
+  };
+
+  int _layersPerArray = 0;             // The number of layers each array is created with
+  std::vector<Array> _arrays;          // The arrays
+  std::vector<unsigned char> _staging; // Neighbouring layers packed together for one upload, reused between flushes
+
+public:
+  TextureArrayPool() = default;
+
+  /**
+   * Sets how many layers each array holds, arrays are only created as images are added
+   *
+   * @param layersPerArray: The number of layers, clamped to GL_MAX_ARRAY_TEXTURE_LAYERS
+   */
+  void init(int layersPerArray = 64);
+
+  /**
+   * Deletes every array
+   */
+  void destroy();
+
+  /**
+   * Adds an image to an array of the same kind with a free layer, creating an array if none has one
+   * The pixels are copied, and uploaded by the next flush()
+   *
+   * @param image:   The image to add
+   * @param srgb:    Store the color channels as sRGB, for color maps
+   * @param mipmaps: Give the image a full mip chain, built on the CPU
+   *
+   * @returns: Where the image was placed, with an array of -1 if it holds no pixels
+   */
+  TextureLayer add(const Image& image, bool srgb = false, bool mipmaps = true);
+
+  /**
+   * Adds an image to an array of the same kind with a free layer, creating an array if none has one
+   * The pixels are copied, and uploaded by the next flush()
+   *
+   * @param pixels:   The pixels, 8 bits per channel with rows tightly packed
+   * @param width:    The width, in pixels
+   * @param height:   The height, in pixels
+   * @param channels: The channels per pixel, 1 to 4
+   * @param srgb:     Store the color channels as sRGB, only possible with 3 or 4 channels
+   * @param mipmaps:  Give the image a full mip chain, built on the CPU
+   *
+   * @returns: Where the image was placed, with an array of -1 if the size or channels are invalid
+   */
+  TextureLayer add(const unsigned char* pixels, int width, int height, int channels, bool srgb = false, bool mipmaps = true);
+
+  /**
+   * Gives a layer back, so the next image of the same kind can reuse it
+   * An upload still waiting for the layer is dropped
+   * Layers that aren't in use, like ones already released, are rejected
+   *
+   * @param layer: The layer, from add()
+   */
+  void release(const TextureLayer& layer);
+
+  /**
+   * Uploads every queued image
+   * Call it once per frame, before drawing with the pool
+   */
+  void flush();
+
+  /**
+   * Binds an array to a texture unit
+   *
+   * @param array: The array
+   * @param unit:  The texture unit
+   */
+  void bind(int array, GLuint unit) const;
+
+  // Gets the number of arrays
+  int getArrayCount() const
+  {
+    return (int)_arrays.size();
+  }
+
+  // Gets an array's texture
+  const Texture& getArray(int array) const
+  {
+    return _arrays[array].texture;
+  }
+
+  // Gets the number of layers of an array holding an image
+  int getUsedLayers(int array) const
+  {
+    return _arrays[array].usedLayers;
+  }
+
+  /**
+   * Counts the images waiting for flush()
+   *
+   * @returns: The number of images
+   */
+  size_t getPendingCount() const;
+
+private:
+  /**
+   * Uploads a run of neighbouring layers, one call per mip level
+   *
+   * @param array: The array
+   * @param first: The first image of the run in the array's pending list
+   * @param count: The number of images in the run
+   */
+  void uploadRun(Array& array, size_t first, size_t count);
+};
+
+#endif // !TEXTURE_ARRAY_POOL_H
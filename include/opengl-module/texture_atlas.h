@@ -0,0 +1,216 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <glad/glad.h>
+#include <opengl-module/texture.h>
+#include <cstddef>
+#include <vector>
+
+class Image;
+
+// Where an image was placed in a TextureAtlas
+struct AtlasRegion
+{
+  int page = -1;  // The page holding the image, -1 if it wasn't placed
+  int x = 0;      // The left edge of the image in the page, in pixels
+  int y = 0;      // The bottom edge of the image in the page, in pixels
+  int width = 0;  // The width of the image, in pixels
+  int height = 0; // The height of the image, in pixels
+  float u0 = 0;   // The left edge, in texture coordinates
+  float v0 = 0;   // The bottom edge, in texture coordinates
+  float u1 = 0;   // The right edge, in texture coordinates
+  float v1 = 0;   // The top edge, in texture coordinates
+};
+
+// Packs rectangles into a fixed size area with the skyline bottom-left heuristic
+// The used area is tracked as a skyline, the top edge of everything placed so far, so inserts are cheap and can happen at any time
+// Space below the skyline that a rectangle didn't fill is never reused
+class SkylinePacker
+{
+  // A horizontal run of the skyline
+  struct Segment
+  {
+    int x;     // The left edge, in pixels
+    int y;     // The height of the skyline, in pixels
+    int width; // The width, in pixels
+  };
+
+  int _width = 0;                // The width of the area, in pixels
+  int _height = 0;               // The height of the area, in pixels
+  size_t _usedArea = 0;          // The area covered by placed rectangles, in pixels
+  std::vector<Segment> _skyline; // The skyline, from left to right
+
+public:
+  SkylinePacker() = default;
+
+  /**
+   * Sets the size of the area and empties it
+   *
+   * @param width:  The width, in pixels
+   * @param height: The height, in pixels
+   */
+  void init(int width, int height);
+
+  /**
+   * Empties the area
+   */
+  void clear();
+
+  /**
+   * Places a rectangle where it leaves the skyline lowest, then where it fits the skyline most tightly
+   *
+   * @param width:  The width, in pixels
+   * @param height: The height, in pixels
+   * @param x:      Set to the left edge of the rectangle
+   * @param y:      Set to the bottom edge of the rectangle
+   *
+   * @returns: True if the rectangle fit
+   */
+  bool insert(int width, int height, int& x, int& y);
+
+  /**
+   * Gets how much of the area is covered
+   *
+   * @returns: The covered fraction, from 0 to 1
+   */
+  float getOccupancy() const;
+
+private:
+  /**
+   * Finds where a rectangle would sit if its left edge was at a segment
+   *
+   * @param index:  The segment
+   * @param width:  The width, in pixels
+   * @param height: The height, in pixels
+   *
+   * @returns: The bottom edge, or -1 if it doesn't fit there
+   */
+  int fit(size_t index, int width, int height) const;
+};
+
+// Packs many small images, like sprites, into a few large textures, so they can be drawn with one bind and batched
+// Each image is surrounded by padding filled with its edge pixels, and placed on a grid fine enough that every mip level keeps
+// at least one padding pixel around it, so filtering never bleeds in from a neighbour
+// Images can be added at any time, their mips are built on the CPU and only their own region of each level is uploaded
+class TextureAtlas
+{
+  // One texture of the atlas
+  struct Page
+  {
+    Texture2D texture;    // The texture
+    SkylinePacker packer; // The space used in the texture, in grid cells
+  };
+
+  int _pageSize = 0;                // The width and height of each page, in pixels
+  int _padding = 0;                 // The pixels of padding on each side of an image
+  int _alignment = 1;               // The grid images are placed on, so each mip level's texels cover a single image
+  int _levels = 1;                  // The number of mip levels of each page
+  bool _srgb = false;               // Store the color channels as sRGB
+  std::vector<Page> _pages;         // The pages
+  std::vector<unsigned char> _slot; // Scratch space holding an image with its padding, reused between adds
+
+public:
+  TextureAtlas() = default;
+
+  /**
+   * Sets up the atlas, pages are only created as images are added
+   * The number of mip levels follows from the padding, 2 pixels gives 2 levels, 4 gives 3, 8 gives 4 and so on
+   *
+   * @param pageSize: The width and height of each page, in pixels
+   * @param padding:  The pixels of padding on each side of an image, 0 for no padding and no mips
+   * @param srgb:     Store the color channels as sRGB, for color maps
+   */
+  void init(int pageSize = 2048, int padding = 4, bool srgb = false);
+
+  /**
+   * Deletes every page
+   */
+  void destroy();
+
+  /**
+   * Adds an image to the first page with room for it, creating a page if none has
+   *
+   * @param image:  The image to add
+   * @param region: Set to where the image was placed
+   *
+   * @returns: True if the image was placed, false if it holds no pixels or is larger than a page
+   */
+  bool add(const Image& image, AtlasRegion& region);
+
+  /**
+   * Adds an image to the first page with room for it, creating a page if none has
+   *
+   * @param pixels:   The pixels, 8 bits per channel with rows tightly packed, the bottom row first
+   * @param width:    The width, in pixels
+   * @param height:   The height, in pixels
+   * @param channels: The channels per pixel, 1 to 4, as stb_image returns them
+   * @param region:   Set to where the image was placed
+   *
+   * @returns: True if the image was placed, false if it is larger than a page
+   */
+  bool add(const unsigned char* pixels, int width, int height, int channels, AtlasRegion& region);
+
+  /**
+   * Replaces the pixels of an image already in the atlas, for animated or generated sprites
+   *
+   * @param region:   Where the image is, from add()
+   * @param pixels:   The new pixels, the same size as the image, 8 bits per channel with rows tightly packed
+   * @param channels: The channels per pixel, 1 to 4, as stb_image returns them
+   */
+  void update(const AtlasRegion& region, const unsigned char* pixels, int channels);
+
+  /**
+   * Binds a page to a texture unit
+   *
+   * @param page: The page
+   * @param unit: The texture unit
+   */
+  void bind(int page, GLuint unit) const;
+
+  // Gets the number of pages
+  int getPageCount() const
+  {
+    return (int)_pages.size();
+  }
+
+  // Gets a page's texture
+  const Texture2D& getPage(int page) const
+  {
+    return _pages[page].texture;
+  }
+
+  /**
+   * Gets how much of a page is covered by images and their padding
+   *
+   * @param page: The page
+   *
+   * @returns: The covered fraction, from 0 to 1
+   */
+  float getOccupancy(int page) const;
+
+private:
+  /**
+   * Fills the scratch slot with an image, its padding and the rest of its grid cells, repeating its edge pixels
+   *
+   * @param pixels:     The pixels, 8 bits per channel with rows tightly packed
+   * @param width:      The width, in pixels
+   * @param height:     The height, in pixels
+   * @param channels:   The channels per pixel, 1 to 4
+   * @param slotWidth:  The width of the slot, in pixels
+   * @param slotHeight: The height of the slot, in pixels
+   */
+  void fillSlot(const unsigned char* pixels, int width, int height, int channels, int slotWidth, int slotHeight);
+
+  /**
+   * Uploads the scratch slot and its mips to a page
+   *
+   * @param page:       The page
+   * @param x:          The left edge of the slot, in pixels
+   * @param y:          The bottom edge of the slot, in pixels
+   * @param slotWidth:  The width of the slot, in pixels
+   * @param slotHeight: The height of the slot, in pixels
+   */
+  void uploadSlot(int page, int x, int y, int slotWidth, int slotHeight);
+};
+
+#endif // !TEXTURE_ATLAS_H
@@ -0,0 +1,134 @@
+#ifndef TEXTURE_COOKER_H
+#define TEXTURE_COOKER_H
+
+#include <glad/glad.h>
+#include <opengl-module/block_compression.h>
+#include <opengl-module/mipmap.h>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Image;
+class ThreadPool;
+
+// A texture encoded to a block format, with its whole mip chain
+struct CookedTexture
+{
+  BlockFormat format = BlockFormat::BC1; // The format of every level
+  GLenum internalFormat = 0;             // The internal format to allocate the texture with
+  std::vector<CompressedLevel> levels;   // The levels, from the top one down to 1x1
+};
+
+// Turns images into block compressed textures with mips, ready for Texture2D::init(levels, internalFormat)
+// Encoding is far slower than decoding, so results are cached on disk, keyed by a hash of the source
+// Safe to use from several threads at once
+class TextureCooker
+{
+  // Bump when the encoder's output changes, so stale cache files are ignored
+  static const uint32_t VERSION = 1;
+
+  std::string _cacheDirectory;           // Where cooked textures are stored, empty to not cache them
+  MipFilter _mipFilter = MipFilter::Box; // The filter the mips are built with
+  std::atomic<uint64_t> _hits;           // Textures read from the cache
+  std::atomic<uint64_t> _misses;         // Textures encoded because they weren't in the cache
+
+public:
+  TextureCooker() : _hits(0), _misses(0) {}
+
+  // Delete copy ctor and assignment operator, the counters are shared by the threads cooking
+  TextureCooker(const TextureCooker&) = delete;
+  TextureCooker& operator=(const TextureCooker&) = delete;
+
+  /**
+   * Sets where cooked textures are cached
+   *
+   * @param cacheDirectory: An existing directory to store cooked textures in, or empty to not cache them
+   * @param mipFilter:      The filter the mips are built with
+   */
+  void init(const std::string& cacheDirectory, MipFilter mipFilter = MipFilter::Box);
+
+  /**
+   * Cooks an image file
+   * The cache is keyed by the file's bytes, so a hit skips decoding as well as encoding
+   *
+   * @param path:        The image file to load
+   * @param srgb:        Store the color channels as sRGB, for color maps
+   * @param highQuality: Use BC7 for color images, see BlockCompressor::formatFor()
+   * @param cooked:      Filled with the texture
+   * @param pool:        Splits the work on each level across the pool, or nullptr to do it all on the calling thread
+   *                     Must be nullptr when called from one of the pool's tasks
+   *
+   * @returns: True if the file could be read and decoded
+   */
+  bool cook(const std::string& path, bool srgb, bool highQuality, CookedTexture& cooked, ThreadPool* pool = nullptr);
+
+  /**
+   * Cooks a decoded image
+   * The cache is keyed by the image's pixels
+   *
+   * @param image:  The top level
+   * @param srgb:   Store the color channels as sRGB, for color maps
+   * @param format: The format to encode to
+   * @param cooked: Filled with the texture
+   * @param pool:   Splits the work on each level across the pool, or nullptr to do it all on the calling thread
+   *                Must be nullptr when called from one of the pool's tasks
+   *
+   * @returns: True if the image held pixels
+   */
+  bool cook(const Image& image, bool srgb, BlockFormat format, CookedTexture& cooked, ThreadPool* pool = nullptr);
+
+  // Gets the number of textures read from the cache
+  uint64_t getHitCount() const
+  {
+    return _hits.load(std::memory_order_relaxed);
+  }
+
+  // Gets the number of textures that had to be encoded
+  uint64_t getMissCount() const
+  {
+    return _misses.load(std::memory_order_relaxed);
+  }
+
+private:
+  /**
+   * Builds the mips of an image and encodes every level
+   *
+   * @param image:  The top level
+   * @param srgb:   Filter the mips in linear space and store the color channels as sRGB
+   * @param format: The format to encode to
+   * @param cooked: Filled with the texture
+   * @param pool:   Splits the work on each level across the pool, or nullptr
+   */
+  void encode(const Image& image, bool srgb, BlockFormat format, CookedTexture& cooked, ThreadPool* pool) const;
+
+  /**
+   * Gets the cache file for a key
+   *
+   * @param key: The key
+   *
+   * @returns: The path, or empty if caching is off
+   */
+  std::string cachePath(uint64_t key) const;
+
+  /**
+   * Reads a cooked texture from the cache
+   *
+   * @param key:    The key it was stored under
+   * @param cooked: Filled with the texture
+   *
+   * @returns: True if the file existed and was complete
+   */
+  bool read(uint64_t key, CookedTexture& cooked) const;
+
+  /**
+   * Stores a cooked texture in the cache
+   * Written to a temporary file first, so other threads and processes never read a partial one
+   *
+   * @param key:    The key to store it under
+   * @param cooked: The texture
+   */
+  void write(uint64_t key, const CookedTexture& cooked) const;
+};
+
+#endif // !TEXTURE_COOKER_H
@@ -0,0 +1,168 @@
+#ifndef TEXTURE_FILE_H
+#define TEXTURE_FILE_H
+
+#include <glad/glad.h>
+#include <opengl-module/mapped_file.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Texture;
+
+// A KTX2 or DDS file holding a texture that is ready for the GPU, usually block compressed with its mips
+// The file is mapped rather than read, and each level is uploaded straight from the mapping,
+// so nothing is decoded or copied on the CPU. Supports 2D textures, arrays, cube maps and cube map arrays
+class TextureFile
+{
+  // One image in the file, a mip level of one face of one layer
+  struct Subresource
+  {
+    const unsigned char* data; // The image, in the mapping
+    size_t size;               // The size of the image, in bytes
+  };
+
+  MappedFile _file;                 // The mapped file
+  GLenum _target = 0;               // The texture target the file describes
+  GLenum _internalFormat = 0;       // The sized internal format
+  GLenum _format = 0;               // The pixel format of uncompressed files, 0 if block compressed
+  GLenum _type = 0;                 // The pixel type of uncompressed files
+  int _blockBytes = 0;              // The size of a 4x4 block, 0 if uncompressed
+  int _pixelBytes = 0;              // The size of a pixel, 0 if block compressed
+  int _width = 0;                   // The width of the top level, in pixels
+  int _height = 0;                  // The height of the top level, in pixels
+  int _layers = 0;                  // The number of layers, 6 per cube for cube maps
+  int _levels = 0;                  // The number of mip levels stored
+  bool _generateMipmaps = false;    // The file asks for the mips to be generated after loading
+  std::vector<Subresource> _images; // Every image, level by level, each level holding its layers in order
+
+public:
+  TextureFile() = default;
+
+  // Delete copy ctor and assignment operator, the images point into the mapping
+  TextureFile(const TextureFile&) = delete;
+  TextureFile& operator=(const TextureFile&) = delete;
+
+  /**
+   * Maps a KTX2 or DDS file and finds its images, picking the format from its contents rather than its name
+   * KTX2 files with supercompression aren't supported
+   *
+   * @param path: The file to load
+   * @param srgb: Treat the color channels as sRGB if the file doesn't say, for DDS files without a DX10 header
+   *
+   * @returns: True if the file was mapped and its layout understood
+   */
+  bool open(const std::string& path, bool srgb = false);
+
+  /**
+   * Unmaps the file
+   */
+  void close();
+
+  // Checks if a file is open
+  bool isOpen() const
+  {
+    return _file.isOpen();
+  }
+
+  /**
+   * Creates a texture from the file, uploading every level from the mapping
+   * The file can be closed afterwards
+   *
+   * @param texture: The texture to initialize
+   *
+   * @returns: True if the file was open
+   */
+  bool upload(Texture& texture) const;
+
+  /**
+   * Gets one image in the file
+   *
+   * @param level: The mip level
+   * @param layer: The layer, 6 per cube for cube maps
+   * @param size:  Set to the size of the image, in bytes
+   *
+   * @returns: The image, in the mapping, or nullptr if there is no such image
+   */
+  const unsigned char* getImage(int level, int layer, size_t& size) const;
+
+  // Gets the texture target the file describes
+  GLenum getTarget() const
+  {
+    return _target;
+  }
+
+  // Gets the sized internal format
+  GLenum getInternalFormat() const
+  {
+    return _internalFormat;
+  }
+
+  // Checks if the images are block compressed
+  bool isCompressed() const
+  {
+    return _blockBytes != 0;
+  }
+
+  // Gets the width of the top level, in pixels
+  int getWidth() const
+  {
+    return _width;
+  }
+
+  // Gets the height of the top level, in pixels
+  int getHeight() const
+  {
+    return _height;
+  }
+
+  // Gets the number of layers, 6 per cube for cube maps
+  int getLayers() const
+  {
+    return _layers;
+  }
+
+  // Gets the number of mip levels stored in the file
+  int getLevels() const
+  {
+    return _levels;
+  }
+
+private:
+  /**
+   * Finds the images of a DDS file
+   *
+   * @param srgb: Treat the color channels as sRGB if the file has no DX10 header
+   *
+   * @returns: True if the layout was understood
+   */
+  bool parseDDS(bool srgb);
+
+  /**
+   * Finds the images of a KTX2 file
+   *
+   * @returns: True if the layout was understood
+   */
+  bool parseKTX2();
+
+  /**
+   * Checks the size, level count and layer count read from the header, then sets the layer count
+   * Called before anything is allocated for the images, the counts come straight from the file
+   *
+   * @param layers: The number of layers, 6 per cube for cube maps
+   *
+   * @returns: True if the layout is possible and fits in the file
+   */
+  bool setLayers(uint64_t layers);
+
+  /**
+   * Gets the size of one image of a level
+   *
+   * @param level: The mip level
+   *
+   * @returns: The size, in bytes
+   */
+  size_t imageSize(int level) const;
+};
+
+#endif // !TEXTURE_FILE_H
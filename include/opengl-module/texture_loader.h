@@ -0,0 +1,253 @@
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include <opengl-module/image.h>
+#include <opengl-module/image_cache.h>
+#include <opengl-module/mipmap.h>
+#include <opengl-module/texture.h>
+#include <opengl-module/texture_cooker.h>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+// A texture being loaded by the TextureLoader
+// Binds the loader's placeholder until the image has been decoded and fully uploaded
+class AsyncTexture
+{
+  friend class TextureLoader;
+
+  // How far the load has got
+  enum State
+  {
+    Loading, // Being decoded or uploaded
+    Ready,   // Fully uploaded, with every mip level
+    Failed   // The image couldn't be decoded, the placeholder is used for good
+  };
+
+  Texture2D _texture;              // The texture, only valid once ready
+  const Texture2D* _placeholder;   // Bound until the texture is ready
+  std::atomic<int> _state;         // The State of the load
+
+public:
+  explicit AsyncTexture(const Texture2D* placeholder) : _placeholder(placeholder), _state(Loading) {}
+
+  // Delete copy ctor and assignment operator, the loader holds a reference
+  AsyncTexture(const AsyncTexture&) = delete;
+  AsyncTexture& operator=(const AsyncTexture&) = delete;
+
+  // Checks if the texture has been fully uploaded
+  bool isReady() const
+  {
+    return _state.load(std::memory_order_acquire) == Ready;
+  }
+
+  // Checks if the image couldn't be decoded
+  bool hasFailed() const
+  {
+    return _state.load(std::memory_order_acquire) == Failed;
+  }
+
+  /**
+   * Binds the texture to a texture unit, or the placeholder if it isn't ready
+   *
+   * @param unit: The texture unit
+   */
+  void bind(GLuint unit) const
+  {
+    if (isReady())
+      _texture.bind(unit);
+    else
+      _placeholder->bind(unit);
+  }
+
+  // Gets the id of the texture, or of the placeholder if it isn't ready
+  GLuint getID() const
+  {
+    return isReady() ? _texture.getID() : _placeholder->getID();
+  }
+
+  // Gets the texture, only valid once ready
+  Texture2D& getTexture()
+  {
+    return _texture;
+  }
+
+  /**
+   * Deletes the texture
+   * Must be called on the GL thread, after the load has finished
+   */
+  void destroy()
+  {
+    _texture.destroy();
+  }
+};
+
+// Streams textures in without blocking the render loop
+// Images are decoded on the thread pool, and uploaded by GL::run() a slice at a time
+// under a per frame byte budget, so a frame never waits on a large image
+class TextureLoader
+{
+  // A decoded image waiting to be uploaded
+  struct Pending
+  {
+    std::shared_ptr<AsyncTexture> texture; // The texture to fill
+    Image image;                           // The decoded pixels
+    std::vector<MipLevel> mips;            // The levels below the top one, empty if the GPU generates them
+    CookedTexture cooked;                  // The block compressed levels, empty if the texture isn't compressed
+    bool srgb;                             // Store the color channels as sRGB
+    int memoryTag;                         // The MemoryTracker tag of the thread that asked for it
+    int level;                             // The level being uploaded
+    int rowsUploaded;                      // Rows of that level uploaded so far, of blocks if it's compressed
+  };
+
+  ThreadPool* _pool = nullptr;           // Decodes the images
+  Texture2D _placeholder;                // Bound until a texture is ready
+  std::mutex _mutex;                     // Guards the decoded images
+  std::deque<Pending> _decoded;          // Decoded images, in the order they finished
+  std::deque<Pending> _uploading;        // Images taken by the GL thread, the first one may be partly uploaded
+  std::atomic<int> _loading;             // Loads that haven't finished yet
+  size_t _budget = 8 << 20;              // The bytes to upload per frame
+  size_t _uploadedLastFrame = 0;         // The bytes uploaded by the last update
+  bool _cpuMipmaps = false;              // Build the mips on the workers instead of the GPU
+  MipFilter _mipFilter = MipFilter::Box; // The filter for mips built on the workers
+  bool _compress = false;                // Block compress the textures on the workers
+  bool _highQuality = false;             // Compress color textures to BC7 instead of BC1 and BC3
+  TextureCooker _cooker;                 // Compresses the textures and caches the results
+  ImageCache _imageCache;                // Caches decoded images, off until a directory is set
+
+public:
+  TextureLoader() : _loading(0) {}
+
+  // Delete copy ctor and assignment operator, queued jobs hold a pointer to the loader
+  TextureLoader(const TextureLoader&) = delete;
+  TextureLoader& operator=(const TextureLoader&) = delete;
+
+  /**
+   * Creates the placeholder texture
+   * Called by GL once the context exists
+   *
+   * @param pool: The pool to decode images on
+   */
+  void init(ThreadPool& pool);
+
+  /**
+   * Deletes the placeholder and drops the uploads still queued
+   * Called by GL before the context is destroyed, once the pool has stopped
+   */
+  void destroy();
+
+  /**
+   * Starts loading a texture
+   * Safe to call from any thread. The texture binds the placeholder until it's ready
+   *
+   * @param path: The image file to load
+   * @param srgb: Store the color channels as sRGB, for color maps
+   *
+   * @returns: The texture being loaded
+   */
+  std::shared_ptr<AsyncTexture> load(const std::string& path, bool srgb = false);
+
+  /**
+   * Uploads decoded images until the frame's budget is spent
+   * Called by GL every frame on the thread that owns the context
+   * At least one row is uploaded per frame, so images larger than the budget still finish
+   */
+  void update();
+
+  /**
+   * Sets the number of bytes uploaded per frame
+   * Must be set before GL::run() is called
+   *
+   * @param bytes: The budget, in bytes of decoded pixels or compressed blocks
+   */
+  void setBudget(size_t bytes)
+  {
+    _budget = bytes;
+  }
+
+  /**
+   * Builds the mips on the workers after decoding, instead of with glGenerateTextureMipmap
+   * The mips count against the upload budget. sRGB textures are filtered in linear space
+   * Must be set before textures are loaded
+   *
+   * @param enabled: True to build the mips on the CPU
+   * @param filter:  The filter to build them with
+   */
+  void setCpuMipmaps(bool enabled, MipFilter filter = MipFilter::Box)
+  {
+    _cpuMipmaps = enabled;
+    _mipFilter = filter;
+  }
+
+  /**
+   * Block compresses textures on the workers, so they take 4 to 8 times less memory, see TextureCooker
+   * The mips are built on the workers too, with the filter set by setCpuMipmaps(), so set that first
+   * Must be set before textures are loaded
+   *
+   * @param enabled:        True to compress textures
+   * @param cacheDirectory: An existing directory to cache compressed textures in, or empty to not cache them
+   * @param highQuality:    Compress color textures to BC7 instead of BC1 and BC3
+   */
+  void setCompression(bool enabled, const std::string& cacheDirectory = "", bool highQuality = false)
+  {
+    _compress = enabled;
+    _highQuality = highQuality;
+    _cooker.init(cacheDirectory, _mipFilter);
+  }
+
+  /**
+   * Caches decoded images on disk, so later runs map the pixels instead of decoding them, see ImageCache
+   * Must be set before textures are loaded
+   *
+   * @param directory: An existing directory to cache decoded images in, or empty to not cache them
+   * @param maxBytes:  The size the cache is trimmed to, least recently used images first
+   */
+  void setImageCache(const std::string& directory, size_t maxBytes = (size_t)1 << 30)
+  {
+    _imageCache.init(directory, maxBytes);
+  }
+
+  // Gets the cache of decoded images, to read its counters
+  ImageCache& getImageCache()
+  {
+    return _imageCache;
+  }
+
+  // Gets the cooker compressing the textures, to read its cache counters
+  TextureCooker& getCooker()
+  {
+    return _cooker;
+  }
+
+  // Gets the number of bytes uploaded per frame
+  size_t getBudget() const
+  {
+    return _budget;
+  }
+
+  // Gets the bytes uploaded by the last frame
+  size_t getUploadedLastFrame() const
+  {
+    return _uploadedLastFrame;
+  }
+
+  // Gets the number of loads that haven't finished yet
+  int getLoadingCount() const
+  {
+    return _loading.load(std::memory_order_relaxed);
+  }
+
+  // Gets the texture bound in place of ones that aren't ready, which can be replaced with Texture2D::init()
+  Texture2D& getPlaceholder()
+  {
+    return _placeholder;
+  }
+};
+
+#endif // !TEXTURE_LOADER_H
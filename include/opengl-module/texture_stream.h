@@ -0,0 +1,139 @@
+#ifndef TEXTURE_STREAM_H
+#define TEXTURE_STREAM_H
+
+#include <glad/glad.h>
+#include <opengl-module/buffer.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Texture2D;
+
+// Space in the ring for one upload's pixels
+struct StreamRegion
+{
+  void* data = nullptr; // Where to write the pixels, nullptr if the slice was full
+  size_t offset = 0;    // The offset of the pixels in the ring's buffer
+  size_t size = 0;      // The size of the region, in bytes
+};
+
+// Streams per frame texture updates, like video frames or dynamic textures, through a
+// persistently mapped GL_PIXEL_UNPACK_BUFFER. The buffer is split into one slice per frame in flight.
+// Pixels are written straight into the mapped slice and copied to the texture by the GPU,
+// so the driver never has to copy them out of client memory before the call returns.
+// Each slice is fenced at the end of its frame, and only reused once the GPU is done with it
+class TextureStream
+{
+  // Offsets into the ring are aligned to this, enough for any pixel type
+  static const size_t REGION_ALIGNMENT = 16;
+
+  Buffer _buffer;                   // The ring, split into slices
+  unsigned char* _mapped = nullptr; // The persistent mapping of the whole ring
+  size_t _sliceSize = 0;            // The size of one slice, in bytes
+  int _slices = 0;                  // The number of slices, the frames that can be in flight
+  int _current = 0;                 // The slice being written this frame
+  size_t _used = 0;                 // Bytes used in the current slice
+  std::vector<GLsync> _fences;      // Signaled once the GPU is done with each slice
+
+  uint64_t _stalls = 0;    // Frames that had to wait for a slice's fence
+  uint64_t _overflows = 0; // Uploads that didn't fit and went through client memory
+
+public:
+  TextureStream() = default;
+
+  // Delete copy ctor and assignment operator, the stream owns a mapping and fences
+  TextureStream(const TextureStream&) = delete;
+  TextureStream& operator=(const TextureStream&) = delete;
+
+  /**
+   * Creates and maps the ring
+   * Must be called with a current context
+   *
+   * @param sliceSize: The bytes that can be uploaded per frame
+   * @param slices:    The number of slices, one per frame that can be in flight
+   */
+  void init(size_t sliceSize, int slices = 3);
+
+  /**
+   * Deletes the ring and its fences
+   * Must be called with a current context
+   */
+  void destroy();
+
+  // Checks if the ring has been created
+  bool isInitialized() const
+  {
+    return _mapped != nullptr;
+  }
+
+  /**
+   * Reserves space in this frame's slice
+   * Write the pixels to the region's data, then pass it to upload()
+   *
+   * @param size: The size of the pixels, in bytes
+   *
+   * @returns: The region, whose data is nullptr if the slice is full
+   */
+  StreamRegion allocate(size_t size);
+
+  /**
+   * Copies pixels already written to a region into part of a texture's mip level
+   * The copy is done by the GPU, so this never waits on it
+   *
+   * @param region:  The region holding the pixels, from allocate()
+   * @param texture: The texture to update
+   * @param level:   The mip level
+   * @param x:       The left edge of the region, in pixels
+   * @param y:       The bottom edge of the region, in pixels
+   * @param width:   The width of the region, in pixels
+   * @param height:  The height of the region, in pixels
+   * @param format:  The format of the pixel data
+   * @param type:    The type of the pixel data
+   */
+  void upload(const StreamRegion& region, Texture2D& texture, int level, int x, int y, int width, int height, GLenum format, GLenum type);
+
+  /**
+   * Copies pixels into the ring and uploads them to part of a texture's mip level
+   * If they don't fit in this frame's slice, they are uploaded from client memory instead
+   *
+   * @param texture: The texture to update
+   * @param level:   The mip level
+   * @param x:       The left edge of the region, in pixels
+   * @param y:       The bottom edge of the region, in pixels
+   * @param width:   The width of the region, in pixels
+   * @param height:  The height of the region, in pixels
+   * @param format:  The format of the pixel data
+   * @param type:    The type of the pixel data
+   * @param pixels:  The pixel data, rows tightly packed
+   *
+   * @returns: True if the pixels went through the ring
+   */
+  bool upload(Texture2D& texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels);
+
+  /**
+   * Fences this frame's slice and moves on to the next one
+   * Waits if the GPU is still using the next slice, which only happens when it's more frames behind than there are slices
+   * Called by GL every frame, after the render callback
+   */
+  void endFrame();
+
+  // Gets the bytes that can be uploaded per frame
+  size_t getSliceSize() const
+  {
+    return _sliceSize;
+  }
+
+  // Gets the number of frames that had to wait for the GPU to release a slice
+  uint64_t getStallCount() const
+  {
+    return _stalls;
+  }
+
+  // Gets the number of uploads that didn't fit in their slice
+  uint64_t getOverflowCount() const
+  {
+    return _overflows;
+  }
+};
+
+#endif // !TEXTURE_STREAM_H
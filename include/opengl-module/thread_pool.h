@@ -0,0 +1,94 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads running CPU work like file reads and image decoding
+// The workers have no GL context, so tasks must not make GL calls
+// Workers are started on the first submit, so an unused pool costs nothing
+class ThreadPool
+{
+  std::vector<std::thread> _threads;         // The workers
+  std::mutex _mutex;                         // Guards the queue and the counters
+  std::condition_variable _wake;             // Signaled when a task is queued or the pool is stopped
+  std::condition_variable _idle;             // Signaled when the last task finishes
+  std::deque<std::function<void()>> _tasks;  // Tasks waiting for a worker
+  int _running = 0;                          // Tasks being run by a worker
+  int _threadCount = 0;                      // Workers to start, 0 picks one less than the core count
+  bool _stop = false;                        // Tells the workers to exit
+
+public:
+  ThreadPool() = default;
+
+  // Delete copy ctor and assignment operator, the pool owns threads
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Finishes the queued tasks and stops the workers
+  ~ThreadPool();
+
+  /**
+   * Sets the number of workers
+   * Only has an effect before the first task is submitted
+   *
+   * @param count: The number of workers, 0 picks one less than the number of cores
+   */
+  void setThreadCount(int count)
+  {
+    _threadCount = count;
+  }
+
+  /**
+   * Queues a task, starting the workers if they aren't running yet
+   * Safe to call from any thread, including from a task
+   *
+   * @param task: The work to run on a worker
+   */
+  void submit(std::function<void()> task);
+
+  /**
+   * Blocks until every queued task has finished
+   * Must not be called from a task
+   */
+  void wait();
+
+  /**
+   * Finishes the queued tasks and stops the workers
+   * Submitting again starts new workers
+   */
+  void stop();
+
+  /**
+   * Runs a loop body over a range, split into bands across a pool
+   * The calling thread runs the first band itself, and returns once every band has finished
+   * Only waits on its own bands, unlike wait(). Must not be called from a task of the same pool
+   *
+   * @param pool:  The pool to run the other bands on, or nullptr to run the whole range here
+   * @param count: The size of the range
+   * @param grain: The smallest band worth giving a task
+   * @param body:  Called with the start and end of each band
+   */
+  static void parallelFor(ThreadPool* pool, int count, int grain, const std::function<void(int, int)>& body);
+
+  // Gets the number of workers running
+  int getThreadCount()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_threads.size();
+  }
+
+private:
+  /**
+   * Runs tasks until the pool is stopped
+   *
+   * @param index: The worker's index, used to name it in traces
+   */
+  void threadMain(int index);
+};
+
+#endif // !THREAD_POOL_H
@@ -0,0 +1,248 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Number of zones each thread keeps, older zones are overwritten
+const uint64_t TRACE_BUFFER_ZONES = 1 << 14;
+
+// Number of GPU zones that can be waiting on their timer queries
+const int TRACE_GPU_ZONES = 256;
+
+// A finished zone, copied out of a TraceBuffer
+struct TraceEvent
+{
+  const char* name; // The zone's name, must outlive the trace
+  uint64_t start;   // When the zone started, in nanoseconds since the trace clock started
+  uint64_t end;     // When the zone ended, in nanoseconds since the trace clock started
+};
+
+// The zones of one thread, copied out of its TraceBuffer
+struct TraceThread
+{
+  std::string name;                // The thread's name, or empty
+  int id;                          // A small id, unique to the thread
+  std::vector<TraceEvent> events;  // The thread's zones, in the order they ended
+};
+
+// A fixed size ring of the zones one thread has finished
+// Only the owning thread writes, any thread can copy the zones out without blocking the writer
+class TraceBuffer
+{
+  // A zone in the ring, fields are atomic so a reader racing the writer is well defined
+  struct Slot
+  {
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> start;
+    std::atomic<uint64_t> end;
+  };
+
+  std::vector<Slot> _slots;     // The ring, TRACE_BUFFER_ZONES long
+  std::atomic<uint64_t> _head;  // Number of zones ever written, only written by the owner
+  int _id;                      // A small id, unique to the thread
+  std::string _name;            // The thread's name, guarded by the registry mutex
+
+  friend class Trace;
+
+public:
+  /**
+   * TraceBuffer Constructor
+   *
+   * @param id:   A small id, unique to the owning thread
+   * @param name: The owning thread's name, or empty
+   */
+  TraceBuffer(int id, const std::string& name);
+
+  /**
+   * Writes a finished zone, overwriting the oldest one if the ring is full
+   * Only call from the owning thread
+   *
+   * @param name:  The zone's name, must outlive the trace
+   * @param start: When the zone started, from Trace::now()
+   * @param end:   When the zone ended, from Trace::now()
+   */
+  void write(const char* name, uint64_t start, uint64_t end)
+  {
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    Slot& slot = _slots[head & (TRACE_BUFFER_ZONES - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * Copies out the zones that ended at or after a time
+   * Zones the writer overwrote while they were being copied are left out
+   *
+   * @param since:  The earliest end time to copy
+   * @param events: The zones are appended to this
+   */
+  void copy(uint64_t since, std::vector<TraceEvent>& events) const;
+};
+
+// Records CPU zones per thread, and GPU zones on the main context,
+// and exports them as Chrome trace event JSON that Perfetto and chrome://tracing can open
+// Zones are only recorded while tracing is enabled, and checking costs a single atomic load
+class Trace
+{
+  static std::atomic<bool> _enabled; // Tracks if zones are being recorded
+
+public:
+  /**
+   * Checks if zones are being recorded
+   */
+  static bool isEnabled()
+  {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Starts or stops recording zones
+   * Each thread keeps its last TRACE_BUFFER_ZONES zones, so nothing grows while it runs
+   *
+   * @param enabled: True to record zones
+   */
+  static void setEnabled(bool enabled);
+
+  /**
+   * Gets the current time on the trace clock
+   *
+   * @returns: Nanoseconds since the trace clock started
+   */
+  static uint64_t now();
+
+  /**
+   * Records a zone on the calling thread
+   *
+   * @param name:  The zone's name, must outlive the trace, string literals are best
+   * @param start: When the zone started, from Trace::now()
+   * @param end:   When the zone ended, from Trace::now()
+   */
+  static void record(const char* name, uint64_t start, uint64_t end);
+
+  /**
+   * Names the calling thread in exported traces
+   *
+   * @param name: The thread's name
+   */
+  static void setThreadName(const std::string& name);
+
+  /**
+   * Starts a GPU zone with a GL_TIMESTAMP query
+   * Only call from the thread with the main window's context
+   *
+   * @param name: The zone's name, must outlive the trace
+   *
+   * @returns: A handle for gpuEnd(), or -1 if tracing is off or too many zones are pending
+   */
+  static int gpuBegin(const char* name);
+
+  /**
+   * Ends a GPU zone with a GL_TIMESTAMP query
+   *
+   * @param zone: The handle from gpuBegin(), -1 is ignored
+   */
+  static void gpuEnd(int zone);
+
+  /**
+   * Reads back the GPU zones whose queries are available, without waiting for the rest
+   * GPU times are moved onto the trace clock using GL_TIMESTAMP, so they line up with CPU zones
+   * GL calls this once a frame, only call from the thread with the main window's context
+   */
+  static void resolveGpu();
+
+  /**
+   * Deletes the GPU queries, pending GPU zones are dropped
+   * Must be called with the main window's context current
+   */
+  static void destroyGpu();
+
+  /**
+   * Copies out the zones of every thread
+   *
+   * @param since:   The earliest end time to copy, 0 for everything still in the rings
+   * @param threads: Filled with one entry per thread that has zones
+   */
+  static void snapshot(uint64_t since, std::vector<TraceThread>& threads);
+
+  /**
+   * Writes zones as Chrome trace event JSON
+   *
+   * @param file:    The file to write to
+   * @param threads: The zones, from snapshot()
+   */
+  static void writeChrome(FILE* file, const std::vector<TraceThread>& threads);
+
+  /**
+   * Writes every zone still in the rings to a Chrome trace event JSON file
+   *
+   * @param path: The file to write
+   *
+   * @returns: True if the file was written
+   */
+  static bool exportChrome(const std::string& path);
+};
+
+// Records the scope it lives in as a CPU zone
+class TraceZone
+{
+  const char* _name; // The zone's name, nullptr if tracing was off when it started
+  uint64_t _start;   // When the zone started
+
+public:
+  /**
+   * TraceZone Constructor
+   *
+   * @param name: The zone's name, must outlive the trace
+   */
+  explicit TraceZone(const char* name) : _name(Trace::isEnabled() ? name : nullptr), _start(_name ? Trace::now() : 0) {}
+
+  // TraceZone Destructor
+  ~TraceZone()
+  {
+    if (_name)
+      Trace::record(_name, _start, Trace::now());
+  }
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+};
+
+// Records the GPU work issued in the scope it lives in as a GPU zone
+class GpuTraceZone
+{
+  int _zone; // The handle from Trace::gpuBegin()
+
+public:
+  /**
+   * GpuTraceZone Constructor
+   *
+   * @param name: The zone's name, must outlive the trace
+   */
+  explicit GpuTraceZone(const char* name) : _zone(Trace::isEnabled() ? Trace::gpuBegin(name) : -1) {}
+
+  // GpuTraceZone Destructor
+  ~GpuTraceZone()
+  {
+    Trace::gpuEnd(_zone);
+  }
+
+  GpuTraceZone(const GpuTraceZone&) = delete;
+  GpuTraceZone& operator=(const GpuTraceZone&) = delete;
+};
+
+#define GL_TRACE_CONCAT_(a, b) a##b
+#define GL_TRACE_CONCAT(a, b) GL_TRACE_CONCAT_(a, b)
+
+// Records the rest of the enclosing scope as a CPU zone
+#define GL_TRACE_ZONE(name) TraceZone GL_TRACE_CONCAT(traceZone, __LINE__)(name)
+
+// Records the GPU work issued in the rest of the enclosing scope as a GPU zone
+#define GL_TRACE_GPU_ZONE(name) GpuTraceZone GL_TRACE_CONCAT(gpuTraceZone, __LINE__)(name)
+
+#endif // !TRACE_H
@@ -0,0 +1,100 @@
+#ifndef VERTEX_ARRAY_H
+#define VERTEX_ARRAY_H
+
+#include <glad/glad.h>
+#include <cstddef>
+
+class Buffer;
+
+// Wrapper for a vertex array object in OpenGL
+// Vertex arrays are not shared between contexts, so each window needs its own
+class VertexArray
+{
+  GLuint _id = 0;     // The vertex array ID
+  bool _init = false; // Track if the vertex array has been initialized
+
+public:
+  /**
+   * VertexArray Default Constructor
+   * DOES NOT INITIALIZE
+   * After constructing a VertexArray, you must call VertexArray::init()
+   */
+  VertexArray() = default;
+
+  /**
+   * Initializes the vertex array
+   */
+  void init();
+
+  /**
+   * Deletes the vertex array
+   */
+  void destroy();
+
+  /**
+   * Attaches a buffer as a source of vertex data
+   *
+   * @param bindingIndex: The binding index attributes read from
+   * @param buffer:       The buffer holding the vertices
+   * @param offset:       The offset of the first vertex, in bytes
+   * @param stride:       The distance between vertices, in bytes
+   */
+  void setVertexBuffer(GLuint bindingIndex, const Buffer& buffer, GLintptr offset, GLsizei stride);
+
+  /**
+   * Attaches a buffer as the source of indices
+   *
+   * @param buffer: The buffer holding the indices
+   */
+  void setElementBuffer(const Buffer& buffer);
+
+  /**
+   * Enables and describes a floating point vertex attribute
+   *
+   * @param attribute:      The attribute location
+   * @param size:           The number of components
+   * @param type:           The type of each component
+   * @param normalized:     True to normalize integer types to [0, 1] or [-1, 1]
+   * @param relativeOffset: The offset of the attribute within a vertex, in bytes
+   * @param bindingIndex:   The binding index to read the attribute from
+   */
+  void setAttribute(GLuint attribute, GLint size, GLenum type, bool normalized, GLuint relativeOffset, GLuint bindingIndex = 0);
+
+  /**
+   * Binds the vertex array
+   */
+  void bind() const;
+
+  /**
+   * Binds the vertex array and draws vertices in order
+   *
+   * @param mode:      The primitive type
+   * @param first:     The first vertex
+   * @param count:     The number of vertices
+   * @param instances: The number of instances
+   */
+  void drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instances = 1) const;
+
+  /**
+   * Binds the vertex array and draws vertices using the element buffer
+   *
+   * @param mode:      The primitive type
+   * @param count:     The number of indices
+   * @param type:      The type of the indices
+   * @param offset:    The offset of the first index, in bytes
+   * @param instances: The number of instances
+   */
+  void drawElements(GLenum mode, GLsizei count, GLenum type, size_t offset = 0, GLsizei instances = 1) const;
+
+  /**
+   * Gets the id of the vertex array
+   *
+   * @returns: The id of the vertex array
+   */
+  GLuint getID() const
+  {
+    return _id;
+  }
+};
+
+#endif // !VERTEX_ARRAY_H
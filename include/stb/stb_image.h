@@ -276,6 +276,17 @@ RECENT REVISION HISTORY:
 //
 // ===========================================================================
 //
+// Fast inflate   (enable by defining STBI_FAST_INFLATE)
+//
+// PNG decoding is mostly zlib inflate. Defining STBI_FAST_INFLATE decodes
+// Huffman blocks with a 64-bit bit buffer refilled a word at a time, an
+// 11-bit literal/length table that resolves two literals per lookup, and
+// matches copied 8 bytes at a time. The output is identical; the original
+// decoder still handles the last few bytes of input and output, where the
+// word-sized reads and writes would run past the buffers.
+//
+// ===========================================================================
+//
 // HDR image support   (disable by defining STBI_NO_HDR)
 //
 // stb_image supports loading HDR images in general, and currently the Radiance
@@ -4092,6 +4103,17 @@ static int stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp)
 #define STBI__ZFAST_MASK  ((1 << STBI__ZFAST_BITS) - 1)
 #define STBI__ZNSYMS 288 // number of symbols in literal/length alphabet
 
+#ifdef STBI_FAST_INFLATE
+// literal/length table indexed by the next 11 bits: symbol in bits 0-8, bits used
+// in 9-12, bit 13 set if a second literal follows in bits 16-23, 0 if unresolved
+#define STBI__ZFAST2_BITS  11
+#define STBI__ZFAST2_MASK  ((1 << STBI__ZFAST2_BITS) - 1)
+#define STBI__ZFAST2_PAIR  (1 << 13)
+// output needed by one step of the fast loop: the longest match plus the word copy's overrun
+#define STBI__ZFAST_ROOM   (258 + 8)
+typedef unsigned long long stbi__zword;
+#endif
+
 // zlib-style huffman encoding
 // (jpegs packs from left, zlib from right, so can't share code)
 typedef struct
@@ -4187,6 +4209,9 @@ typedef struct
    int   z_expandable;
 
    stbi__zhuffman z_length, z_distance;
+#ifdef STBI_FAST_INFLATE
+   stbi__uint32 z_fast2[1 << STBI__ZFAST2_BITS];
+#endif
 } stbi__zbuf;
 
 stbi_inline static int stbi__zeof(stbi__zbuf *z)
@@ -4306,11 +4331,179 @@ static const int stbi__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129
 static const int stbi__zdist_extra[32] =
 { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
 
-static int stbi__parse_huffman_block(stbi__zbuf *a)
+#ifdef STBI_FAST_INFLATE
+// the fast loop only runs with a word of input left and room for a whole match
+stbi_inline static int stbi__zfast_ready(stbi__zbuf *a, char *zout)
+{
+   return !a->hit_zeof_once && a->zbuffer_end - a->zbuffer >= 8 && a->zout_end - zout >= STBI__ZFAST_ROOM;
+}
+
+// decode a symbol from the low bits of 'bits', of which 'avail' are valid;
+// returns -1 if the code is invalid or longer than 'avail'
+static int stbi__zhuffman_peek(const stbi__zhuffman *z, stbi__uint32 bits, int avail, int *len)
+{
+   int b,s,k;
+   b = z->fast[bits & STBI__ZFAST_MASK];
+   if (b) {
+      *len = b >> 9;
+      return *len <= avail ? (b & 511) : -1;
+   }
+   k = stbi__bit_reverse(bits & 0xffff, 16);
+   for (s=STBI__ZFAST_BITS+1; s <= avail && s < 16; ++s)
+      if (k < z->maxcode[s])
+         break;
+   if (s > avail || s >= 16) return -1;
+   b = (k >> (16-s)) - z->firstcode[s] + z->firstsymbol[s];
+   if (b >= STBI__ZNSYMS || z->size[b] != s) return -1;
+   *len = s;
+   return z->value[b];
+}
+
+static void stbi__zbuild_fast2(stbi__zbuf *a)
+{
+   int i;
+   for (i=0; i < (1 << STBI__ZFAST2_BITS); ++i) {
+      int s1,s2,len1,len2;
+      stbi__uint32 e = 0;
+      s1 = stbi__zhuffman_peek(&a->z_length, (stbi__uint32) i, STBI__ZFAST2_BITS, &len1);
+      if (s1 >= 0) {
+         e = (stbi__uint32) s1 | ((stbi__uint32) len1 << 9);
+         // a literal whose code leaves room for another literal's code decodes both
+         if (s1 < 256 && len1 < STBI__ZFAST2_BITS) {
+            s2 = stbi__zhuffman_peek(&a->z_length, (stbi__uint32) i >> len1, STBI__ZFAST2_BITS - len1, &len2);
+            if (s2 >= 0 && s2 < 256)
+               e = (stbi__uint32) s1 | ((stbi__uint32) (len1 + len2) << 9) | STBI__ZFAST2_PAIR | ((stbi__uint32) s2 << 16);
+         }
+      }
+      a->z_fast2[i] = e;
+   }
+}
+
+stbi_inline static stbi__zword stbi__zload64le(const stbi_uc *p)
+{
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+   stbi__zword v;
+   memcpy(&v, p, 8);
+   return v;
+#else
+   return (stbi__zword) p[0]       | (stbi__zword) p[1] << 8  | (stbi__zword) p[2] << 16 | (stbi__zword) p[3] << 24 |
+          (stbi__zword) p[4] << 32 | (stbi__zword) p[5] << 40 | (stbi__zword) p[6] << 48 | (stbi__zword) p[7] << 56;
+#endif
+}
+
+// returns 1 at the end of the block, 0 on error, 2 when the input or output
+// is too close to its end and the careful decoder must take over
+static int stbi__parse_huffman_block_fast(stbi__zbuf *a)
+{
+   char *zout = a->zout;
+   const stbi_uc *in = a->zbuffer;
+   stbi__zword bits = a->code_buffer;
+   int nbits = a->num_bits;
+
+   // the zero bits padded on at the end of the input match no bytes to give back
+   if (a->hit_zeof_once) return 2;
+
+   while (a->zbuffer_end - in >= 8 && a->zout_end - zout >= STBI__ZFAST_ROOM) {
+      stbi__uint32 e;
+      int z,len,dist,n;
+
+      // branchless refill to at least 56 bits; bits past nbits are real
+      // input and get OR'd in again, unchanged, by the next refill
+      bits |= stbi__zload64le(in) << nbits;
+      in += (63 - nbits) >> 3;
+      nbits |= 56;
+
+      // one step uses at most 15+5+15+13 = 48 bits, so no refill within it
+      e = a->z_fast2[bits & STBI__ZFAST2_MASK];
+      if (e & STBI__ZFAST2_PAIR) {
+         zout[0] = (char) (e & 255);
+         zout[1] = (char) ((e >> 16) & 255);
+         zout += 2;
+         n = (e >> 9) & 15;
+         bits >>= n; nbits -= n;
+         continue;
+      }
+      if (e) {
+         z = e & 511;
+         n = (e >> 9) & 15;
+      } else {
+         z = stbi__zhuffman_peek(&a->z_length, (stbi__uint32) bits, 16, &n);
+         if (z < 0) return stbi__err("bad huffman code","Corrupt PNG");
+      }
+      bits >>= n; nbits -= n;
+      if (z < 256) {
+         *zout++ = (char) z;
+         continue;
+      }
+      if (z == 256) {
+         // give back the whole bytes still in the bit buffer
+         in -= nbits >> 3;
+         nbits &= 7;
+         a->zbuffer = (stbi_uc *) in;
+         a->code_buffer = (stbi__uint32) (bits & ((1u << nbits) - 1));
+         a->num_bits = nbits;
+         a->zout = zout;
+         return 1;
+      }
+      if (z >= 286) return stbi__err("bad huffman code","Corrupt PNG");
+      z -= 257;
+      n = stbi__zlength_extra[z];
+      len = stbi__zlength_base[z] + (int) (bits & ((1u << n) - 1));
+      bits >>= n; nbits -= n;
+      z = stbi__zhuffman_peek(&a->z_distance, (stbi__uint32) bits, 16, &n);
+      if (z < 0 || z >= 30) return stbi__err("bad huffman code","Corrupt PNG");
+      bits >>= n; nbits -= n;
+      n = stbi__zdist_extra[z];
+      dist = stbi__zdist_base[z] + (int) (bits & ((1u << n) - 1));
+      bits >>= n; nbits -= n;
+      if (zout - a->zout_start < dist) return stbi__err("bad dist","Corrupt PNG");
+      {
+         // copies may write up to 7 bytes past the match, STBI__ZFAST_ROOM leaves space for them
+         const char *src = zout - dist;
+         char *end = zout + len;
+         if (dist >= 8) {
+            // each word's source was written before it is read
+            do { memcpy(zout, src, 8); zout += 8; src += 8; } while (zout < end);
+         } else if (dist == 1) {
+            stbi__zword v = (stbi_uc) *src * 0x0101010101010101ull;
+            do { memcpy(zout, &v, 8); zout += 8; } while (zout < end);
+         } else {
+            // a shorter pattern also repeats every 'step' bytes, so once that much is
+            // written the rest can be copied a word at a time from 'step' back
+            int step = dist * ((8 + dist - 1) / dist);
+            char *split = zout + (len < step ? len : step);
+            do *zout++ = *src++; while (zout < split);
+            for (src = zout - step; zout < end; zout += 8, src += 8)
+               memcpy(zout, src, 8);
+         }
+         zout = end;
+      }
+   }
+
+   in -= nbits >> 3;
+   nbits &= 7;
+   a->zbuffer = (stbi_uc *) in;
+   a->code_buffer = (stbi__uint32) (bits & ((1u << nbits) - 1));
+   a->num_bits = nbits;
+   a->zout = zout;
+   return 2;
+}
+#endif
+
+// decodes a block a symbol at a time; with STBI_FAST_INFLATE it returns 2
+// to hand back to the fast loop once there is room for it again
+static int stbi__parse_huffman_block_careful(stbi__zbuf *a)
 {
    char *zout = a->zout;
    for(;;) {
-      int z = stbi__zhuffman_decode(a, &a->z_length);
+      int z;
+#ifdef STBI_FAST_INFLATE
+      if (stbi__zfast_ready(a, zout)) {
+         a->zout = zout;
+         return 2;
+      }
+#endif
+      z = stbi__zhuffman_decode(a, &a->z_length);
       if (z < 256) {
          if (z < 0) return stbi__err("bad huffman code","Corrupt PNG"); // error in huffman codes
          if (zout >= a->zout_end) {
@@ -4356,6 +4549,21 @@ static int stbi__parse_huffman_block(stbi__zbuf *a)
    }
 }
 
+static int stbi__parse_huffman_block(stbi__zbuf *a)
+{
+#ifdef STBI_FAST_INFLATE
+   stbi__zbuild_fast2(a);
+   for (;;) {
+      int r = stbi__parse_huffman_block_fast(a);
+      if (r != 2) return r;
+      r = stbi__parse_huffman_block_careful(a);
+      if (r != 2) return r;
+   }
+#else
+   return stbi__parse_huffman_block_careful(a);
+#endif
+}
+
 static int stbi__compute_huffman_codes(stbi__zbuf *a)
 {
    static const stbi_uc length_dezigzag[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
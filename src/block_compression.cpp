@@ -0,0 +1,1048 @@
+#include <opengl-module/block_compression.h>
+#include <opengl-module/thread_pool.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Use the vector min/max the compiler was allowed to, AVX2 has nothing to add for 16 pixel blocks
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLOCK_COMPRESSION_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BLOCK_COMPRESSION_NEON
+#endif
+
+// Rows of blocks given to each task when an image is split across the pool
+static const int BLOCK_ROWS_PER_TASK = 8;
+
+// The weights of the second endpoint for BC7's 4 bit and 2 bit indices, out of 64
+static const int BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+static const int BC7_WEIGHTS2[4] = { 0, 21, 43, 64 };
+
+/**
+ * Reads a 4x4 block as RGBA
+ *
+ * @param pixels:   The image
+ * @param width:    The width of the image, in pixels
+ * @param height:   The height of the image, in pixels
+ * @param channels: The channels per pixel
+ * @param bx:       The column of the block
+ * @param by:       The row of the block
+ * @param block:    Filled with 16 RGBA pixels, row by row
+ */
+static void loadBlock(const unsigned char* pixels, int width, int height, int channels, int bx, int by, unsigned char block[64])
+{
+  for (int y = 0; y < 4; y++)
+  {
+    int sy = std::min(by * 4 + y, height - 1);
+    const unsigned char* row = pixels + (size_t)sy * width * channels;
+
+    // Whole rows of 4 channel pixels can be copied as is
+    if (channels == 4 && bx * 4 + 4 <= width)
+    {
+      memcpy(block + y * 16, row + bx * 16, 16);
+      continue;
+    }
+
+    for (int x = 0; x < 4; x++)
+    {
+      int sx = std::min(bx * 4 + x, width - 1);
+      const unsigned char* p = row + (size_t)sx * channels;
+      unsigned char* out = block + (y * 4 + x) * 4;
+
+      out[0] = p[0];
+      out[1] = channels > 1 ? p[1] : 0;
+      out[2] = channels > 2 ? p[2] : 0;
+      out[3] = channels > 3 ? p[3] : 255;
+    }
+  }
+}
+
+/**
+ * Finds the smallest and largest value of each channel in a block
+ *
+ * @param block: 16 RGBA pixels
+ * @param low:   Filled with the smallest value of each channel
+ * @param high:  Filled with the largest value of each channel
+ */
+static void blockBounds(const unsigned char block[64], unsigned char low[4], unsigned char high[4])
+{
+#if defined(BLOCK_COMPRESSION_SSE2)
+  __m128i p0 = _mm_loadu_si128((const __m128i*)block);
+  __m128i p1 = _mm_loadu_si128((const __m128i*)(block + 16));
+  __m128i p2 = _mm_loadu_si128((const __m128i*)(block + 32));
+  __m128i p3 = _mm_loadu_si128((const __m128i*)(block + 48));
+
+  __m128i lo = _mm_min_epu8(_mm_min_epu8(p0, p1), _mm_min_epu8(p2, p3));
+  __m128i hi = _mm_max_epu8(_mm_max_epu8(p0, p1), _mm_max_epu8(p2, p3));
+
+  // Fold the 4 pixels left in each register into one
+  lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+  hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2)));
+  lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+  hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  uint32_t lowBits = (uint32_t)_mm_cvtsi128_si32(lo);
+  uint32_t highBits = (uint32_t)_mm_cvtsi128_si32(hi);
+  memcpy(low, &lowBits, 4);
+  memcpy(high, &highBits, 4);
+#elif defined(BLOCK_COMPRESSION_NEON)
+  uint8x16_t p0 = vld1q_u8(block);
+  uint8x16_t p1 = vld1q_u8(block + 16);
+  uint8x16_t p2 = vld1q_u8(block + 32);
+  uint8x16_t p3 = vld1q_u8(block + 48);
+
+  uint8x16_t lo = vminq_u8(vminq_u8(p0, p1), vminq_u8(p2, p3));
+  uint8x16_t hi = vmaxq_u8(vmaxq_u8(p0, p1), vmaxq_u8(p2, p3));
+
+  // Fold the 4 pixels left in each register into two, then one
+  uint8x8_t lo2 = vmin_u8(vget_low_u8(lo), vget_high_u8(lo));
+  uint8x8_t hi2 = vmax_u8(vget_low_u8(hi), vget_high_u8(hi));
+  lo2 = vmin_u8(lo2, vext_u8(lo2, lo2, 4));
+  hi2 = vmax_u8(hi2, vext_u8(hi2, hi2, 4));
+
+  uint8_t lowBytes[8], highBytes[8];
+  vst1_u8(lowBytes, lo2);
+  vst1_u8(highBytes, hi2);
+  memcpy(low, lowBytes, 4);
+  memcpy(high, highBytes, 4);
+#else
+  for (int c = 0; c < 4; c++)
+  {
+    low[c] = 255;
+    high[c] = 0;
+  }
+
+  for (int i = 0; i < 16; i++)
+  {
+    for (int c = 0; c < 4; c++)
+    {
+      low[c] = std::min(low[c], block[i * 4 + c]);
+      high[c] = std::max(high[c], block[i * 4 + c]);
+    }
+  }
+#endif
+}
+
+// Writes a value in little endian order
+static void store16(unsigned char* out, uint32_t value)
+{
+  out[0] = (unsigned char)value;
+  out[1] = (unsigned char)(value >> 8);
+}
+
+static void store32(unsigned char* out, uint32_t value)
+{
+  for (int i = 0; i < 4; i++)
+    out[i] = (unsigned char)(value >> (i * 8));
+}
+
+// Rounds a color to 5:6:5
+static uint32_t to565(const int color[3])
+{
+  int r = std::min(std::max(color[0], 0), 255);
+  int g = std::min(std::max(color[1], 0), 255);
+  int b = std::min(std::max(color[2], 0), 255);
+  return (uint32_t)(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+// Expands a 5:6:5 color back to 8 bits per channel, as the GPU does
+static void from565(uint32_t packed, int color[3])
+{
+  int r = (packed >> 11) & 31;
+  int g = (packed >> 5) & 63;
+  int b = packed & 31;
+  color[0] = (r << 3) | (r >> 2);
+  color[1] = (g << 2) | (g >> 4);
+  color[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ * Picks the closest of a BC1 block's 4 colors for each pixel
+ * Always uses the 4 color mode, which needs the first endpoint to be larger
+ *
+ * @param block:   16 RGBA pixels
+ * @param c0:      The first endpoint, in 5:6:5
+ * @param c1:      The second endpoint, in 5:6:5
+ * @param indices: Filled with the 2 bit index of each pixel
+ *
+ * @returns: The squared error of the block
+ */
+static int bc1Indices(const unsigned char block[64], uint32_t c0, uint32_t c1, uint32_t& indices)
+{
+  int palette[4][3];
+  from565(c0, palette[0]);
+  from565(c1, palette[1]);
+  for (int c = 0; c < 3; c++)
+  {
+    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+  }
+
+  int error = 0;
+  indices = 0;
+
+  for (int i = 0; i < 16; i++)
+  {
+    const unsigned char* p = block + i * 4;
+    int best = 0;
+    int bestDistance = 1 << 30;
+
+    for (int k = 0; k < 4; k++)
+    {
+      int dr = p[0] - palette[k][0];
+      int dg = p[1] - palette[k][1];
+      int db = p[2] - palette[k][2];
+      int distance = dr * dr + dg * dg + db * db;
+      if (distance < bestDistance)
+      {
+        bestDistance = distance;
+        best = k;
+      }
+    }
+
+    indices |= (uint32_t)best << (i * 2);
+    error += bestDistance;
+  }
+
+  return error;
+}
+
+/**
+ * Finds the endpoints that best fit a block's colors for a set of indices, with least squares
+ *
+ * @param block:   16 RGBA pixels
+ * @param indices: The 2 bit index of each pixel
+ * @param c0:      Set to the first endpoint, in 5:6:5
+ * @param c1:      Set to the second endpoint, in 5:6:5
+ *
+ * @returns: False if every pixel uses the same weight, so there is nothing to fit
+ */
+static bool bc1Refit(const unsigned char block[64], uint32_t indices, uint32_t& c0, uint32_t& c1)
+{
+  // The weight of the first endpoint for each index
+  static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+  float aa = 0, bb = 0, ab = 0;
+  float ax[3] = { 0, 0, 0 };
+  float bx[3] = { 0, 0, 0 };
+
+  for (int i = 0; i < 16; i++)
+  {
+    float a = weights[(indices >> (i * 2)) & 3];
+    float b = 1.0f - a;
+    aa += a * a;
+    bb += b * b;
+    ab += a * b;
+    for (int c = 0; c < 3; c++)
+    {
+      ax[c] += a * block[i * 4 + c];
+      bx[c] += b * block[i * 4 + c];
+    }
+  }
+
+  float det = aa * bb - ab * ab;
+  if (std::fabs(det) < 1e-6f)
+    return false;
+
+  int e0[3], e1[3];
+  for (int c = 0; c < 3; c++)
+  {
+    e0[c] = (int)std::lround((ax[c] * bb - bx[c] * ab) / det);
+    e1[c] = (int)std::lround((bx[c] * aa - ax[c] * ab) / det);
+  }
+
+  c0 = to565(e0);
+  c1 = to565(e1);
+  return true;
+}
+
+/**
+ * Encodes a BC1 color block, also used for the color half of BC3
+ *
+ * @param block: 16 RGBA pixels, alpha is ignored
+ * @param out:   Filled with the 8 byte block
+ */
+static void encodeBC1(const unsigned char block[64], unsigned char* out)
+{
+  unsigned char low[4], high[4];
+  blockBounds(block, low, high);
+
+  // The bounds are two corners of the box around the colors, but the colors may run along another diagonal
+  // Measure each channel's covariance with the widest one, and flip the ones that run against it
+  int reference = 0;
+  for (int c = 1; c < 3; c++)
+  {
+    if (high[c] - low[c] > high[reference] - low[reference])
+      reference = c;
+  }
+
+  int center[3];
+  for (int c = 0; c < 3; c++)
+    center[c] = (low[c] + high[c] + 1) / 2;
+
+  int e0[3], e1[3];
+  for (int c = 0; c < 3; c++)
+  {
+    int covariance = 0;
+    if (c != reference)
+    {
+      for (int i = 0; i < 16; i++)
+        covariance += (block[i * 4 + reference] - center[reference]) * (block[i * 4 + c] - center[c]);
+    }
+
+    // Inset the endpoints, the extremes are usually outliers that would waste the interpolated colors
+    int inset = (high[c] - low[c]) / 16;
+    e0[c] = covariance < 0 ? low[c] + inset : high[c] - inset;
+    e1[c] = covariance < 0 ? high[c] - inset : low[c] + inset;
+  }
+
+  uint32_t c0 = to565(e0);
+  uint32_t c1 = to565(e1);
+  uint32_t indices = 0;
+
+  if (c0 != c1)
+  {
+    if (c0 < c1)
+      std::swap(c0, c1);
+
+    int error = bc1Indices(block, c0, c1, indices);
+
+    // One least squares pass, kept only if it helps
+    uint32_t fit0, fit1, fitIndices;
+    if (error > 0 && bc1Refit(block, indices, fit0, fit1) && fit0 != fit1)
+    {
+      if (fit0 < fit1)
+        std::swap(fit0, fit1);
+
+      if (bc1Indices(block, fit0, fit1, fitIndices) < error)
+      {
+        c0 = fit0;
+        c1 = fit1;
+        indices = fitIndices;
+      }
+    }
+  }
+
+  store16(out, c0);
+  store16(out + 2, c1);
+  store32(out + 4, indices);
+}
+
+/**
+ * Encodes one channel of a block as a BC4 block, also used for BC3's alpha and each half of BC5
+ *
+ * @param block:   16 RGBA pixels
+ * @param channel: The channel to encode
+ * @param out:     Filled with the 8 byte block
+ */
+static void encodeBC4(const unsigned char block[64], int channel, unsigned char* out)
+{
+  unsigned char values[16];
+  for (int i = 0; i < 16; i++)
+    values[i] = block[i * 4 + channel];
+
+#if defined(BLOCK_COMPRESSION_SSE2)
+  __m128i v = _mm_loadu_si128((const __m128i*)values);
+  __m128i lo = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+  __m128i hi = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+  lo = _mm_min_epu8(lo, _mm_srli_si128(lo, 4));
+  hi = _mm_max_epu8(hi, _mm_srli_si128(hi, 4));
+  lo = _mm_min_epu8(lo, _mm_srli_si128(lo, 2));
+  hi = _mm_max_epu8(hi, _mm_srli_si128(hi, 2));
+  lo = _mm_min_epu8(lo, _mm_srli_si128(lo, 1));
+  hi = _mm_max_epu8(hi, _mm_srli_si128(hi, 1));
+  int low = _mm_cvtsi128_si32(lo) & 0xFF;
+  int high = _mm_cvtsi128_si32(hi) & 0xFF;
+#elif defined(BLOCK_COMPRESSION_NEON)
+  uint8x16_t v = vld1q_u8(values);
+  uint8x8_t lo = vmin_u8(vget_low_u8(v), vget_high_u8(v));
+  uint8x8_t hi = vmax_u8(vget_low_u8(v), vget_high_u8(v));
+  lo = vpmin_u8(lo, lo);
+  hi = vpmax_u8(hi, hi);
+  lo = vpmin_u8(lo, lo);
+  hi = vpmax_u8(hi, hi);
+  lo = vpmin_u8(lo, lo);
+  hi = vpmax_u8(hi, hi);
+  int low = vget_lane_u8(lo, 0);
+  int high = vget_lane_u8(hi, 0);
+#else
+  int low = 255, high = 0;
+  for (int i = 0; i < 16; i++)
+  {
+    low = std::min(low, (int)values[i]);
+    high = std::max(high, (int)values[i]);
+  }
+#endif
+
+  out[0] = (unsigned char)high;
+  out[1] = (unsigned char)low;
+
+  // With the first endpoint larger, the block holds the endpoints and 6 evenly spaced values between them
+  // so the closest is found by rounding. Index 0 is the high endpoint, 1 the low one and 2 to 7 run from high to low
+  uint64_t indices = 0;
+  int range = high - low;
+  if (range > 0)
+  {
+    for (int i = 0; i < 16; i++)
+    {
+      int step = ((values[i] - low) * 14 + range) / (range * 2);
+      int index = step == 7 ? 0 : step == 0 ? 1 : 8 - step;
+      indices |= (uint64_t)index << (i * 3);
+    }
+  }
+
+  for (int i = 0; i < 6; i++)
+    out[2 + i] = (unsigned char)(indices >> (i * 8));
+}
+
+// Packs the fields of a 128 bit block, lowest bit first
+struct BlockBits
+{
+  uint64_t low = 0;
+  uint64_t high = 0;
+  int position = 0;
+
+  void write(uint32_t value, int bits)
+  {
+    if (position >= 64)
+      high |= (uint64_t)value << (position - 64);
+    else
+    {
+      low |= (uint64_t)value << position;
+      if (position + bits > 64)
+        high |= (uint64_t)value >> (64 - position);
+    }
+    position += bits;
+  }
+
+  void store(unsigned char* out) const
+  {
+    for (int i = 0; i < 8; i++)
+    {
+      out[i] = (unsigned char)(low >> (i * 8));
+      out[8 + i] = (unsigned char)(high >> (i * 8));
+    }
+  }
+};
+
+/**
+ * Finds the line through a block's values that fits them best, over some of its channels
+ * The line follows the principal axis of the values, found by power iteration on their covariance, and spans their projections onto it
+ *
+ * @param block: 16 RGBA pixels
+ * @param first: The first channel to fit
+ * @param count: The number of channels to fit
+ * @param f0:    Filled with one end of the line, 0 to 255 per channel
+ * @param f1:    Filled with the other end
+ */
+static void bc7PrincipalEndpoints(const unsigned char block[64], int first, int count, float f0[4], float f1[4])
+{
+  unsigned char low[4], high[4];
+  blockBounds(block, low, high);
+
+  float mean[4] = { 0, 0, 0, 0 };
+  for (int i = 0; i < 16; i++)
+  {
+    for (int c = 0; c < count; c++)
+      mean[c] += block[i * 4 + first + c];
+  }
+  for (int c = 0; c < count; c++)
+    mean[c] /= 16.0f;
+
+  float covariance[4][4] = {};
+  for (int i = 0; i < 16; i++)
+  {
+    float d[4];
+    for (int c = 0; c < count; c++)
+      d[c] = block[i * 4 + first + c] - mean[c];
+    for (int r = 0; r < count; r++)
+    {
+      for (int c = 0; c < count; c++)
+        covariance[r][c] += d[r] * d[c];
+    }
+  }
+
+  // Start from the diagonal of the bounds, which is usually close already
+  float axis[4];
+  for (int c = 0; c < count; c++)
+    axis[c] = (float)(high[first + c] - low[first + c]);
+
+  for (int iteration = 0; iteration < 4; iteration++)
+  {
+    float next[4];
+    float length = 0;
+    for (int r = 0; r < count; r++)
+    {
+      next[r] = 0;
+      for (int c = 0; c < count; c++)
+        next[r] += covariance[r][c] * axis[c];
+      length = std::max(length, std::fabs(next[r]));
+    }
+
+    if (length <= 0)
+      break;
+
+    for (int c = 0; c < count; c++)
+      axis[c] = next[c] / length;
+  }
+
+  float axisLength = 0;
+  for (int c = 0; c < count; c++)
+    axisLength += axis[c] * axis[c];
+
+  float tMin = 0, tMax = 0;
+  if (axisLength > 0)
+  {
+    tMin = 1e30f;
+    tMax = -1e30f;
+    for (int i = 0; i < 16; i++)
+    {
+      float t = 0;
+      for (int c = 0; c < count; c++)
+        t += (block[i * 4 + first + c] - mean[c]) * axis[c];
+      t /= axisLength;
+      tMin = std::min(tMin, t);
+      tMax = std::max(tMax, t);
+    }
+  }
+
+  for (int c = 0; c < count; c++)
+  {
+    f0[first + c] = std::min(std::max(mean[c] + tMin * axis[c], 0.0f), 255.0f);
+    f1[first + c] = std::min(std::max(mean[c] + tMax * axis[c], 0.0f), 255.0f);
+  }
+}
+
+/**
+ * Picks the closest interpolated value for each pixel, over some of its channels
+ *
+ * @param block:   16 RGBA pixels
+ * @param first:   The first channel
+ * @param count:   The number of channels
+ * @param e0:      The first endpoint, 8 bits per channel
+ * @param e1:      The second endpoint, 8 bits per channel
+ * @param weights: The weight of the second endpoint for each index, out of 64
+ * @param levels:  The number of indices
+ * @param indices: Filled with the index of each pixel
+ *
+ * @returns: The squared error over those channels
+ */
+static int bc7Indices(const unsigned char block[64], int first, int count, const int e0[4], const int e1[4], const int* weights, int levels,
+                      unsigned char indices[16])
+{
+  int palette[16][4];
+  for (int k = 0; k < levels; k++)
+  {
+    for (int c = first; c < first + count; c++)
+      palette[k][c] = ((64 - weights[k]) * e0[c] + weights[k] * e1[c] + 32) >> 6;
+  }
+
+  int axis[4];
+  int axisLength = 0;
+  for (int c = first; c < first + count; c++)
+  {
+    axis[c] = e1[c] - e0[c];
+    axisLength += axis[c] * axis[c];
+  }
+
+  int error = 0;
+
+  for (int i = 0; i < 16; i++)
+  {
+    const unsigned char* p = block + i * 4;
+
+    // Project onto the line between the endpoints to guess the index, then check its neighbors
+    // The weights aren't evenly spaced, so the projection can be off by one
+    int guess = 0;
+    if (axisLength > 0)
+    {
+      int dot = 0;
+      for (int c = first; c < first + count; c++)
+        dot += (p[c] - e0[c]) * axis[c];
+      guess = (int)((dot * (levels - 1) * 2LL + axisLength) / (axisLength * 2LL));
+      guess = std::min(std::max(guess, 0), levels - 1);
+    }
+
+    int best = guess;
+    int bestDistance = 1 << 30;
+    for (int k = std::max(guess - 1, 0); k <= std::min(guess + 1, levels - 1); k++)
+    {
+      int distance = 0;
+      for (int c = first; c < first + count; c++)
+      {
+        int delta = p[c] - palette[k][c];
+        distance += delta * delta;
+      }
+
+      if (distance < bestDistance)
+      {
+        bestDistance = distance;
+        best = k;
+      }
+    }
+
+    indices[i] = (unsigned char)best;
+    error += bestDistance;
+  }
+
+  return error;
+}
+
+/**
+ * Finds the endpoints that best fit a block's values for a set of indices, with least squares
+ *
+ * @param block:   16 RGBA pixels
+ * @param first:   The first channel
+ * @param count:   The number of channels
+ * @param indices: The index of each pixel
+ * @param weights: The weight of the second endpoint for each index, out of 64
+ * @param f0:      Filled with the first endpoint, 0 to 255 per channel
+ * @param f1:      Filled with the second endpoint
+ *
+ * @returns: False if every pixel uses the same weight, so there is nothing to fit
+ */
+static bool bc7Refit(const unsigned char block[64], int first, int count, const unsigned char indices[16], const int* weights, float f0[4],
+                     float f1[4])
+{
+  float aa = 0, bb = 0, ab = 0;
+  float ax[4] = { 0, 0, 0, 0 };
+  float bx[4] = { 0, 0, 0, 0 };
+
+  for (int i = 0; i < 16; i++)
+  {
+    float b = weights[indices[i]] / 64.0f;
+    float a = 1.0f - b;
+    aa += a * a;
+    bb += b * b;
+    ab += a * b;
+    for (int c = first; c < first + count; c++)
+    {
+      ax[c] += a * block[i * 4 + c];
+      bx[c] += b * block[i * 4 + c];
+    }
+  }
+
+  float det = aa * bb - ab * ab;
+  if (std::fabs(det) < 1e-6f)
+    return false;
+
+  for (int c = first; c < first + count; c++)
+  {
+    f0[c] = std::min(std::max((ax[c] * bb - bx[c] * ab) / det, 0.0f), 255.0f);
+    f1[c] = std::min(std::max((bx[c] * aa - ax[c] * ab) / det, 0.0f), 255.0f);
+  }
+
+  return true;
+}
+
+/**
+ * Rounds a BC7 mode 6 endpoint to 7 bits per channel and a shared low bit
+ *
+ * @param endpoint:  The endpoint, 0 to 255 per channel
+ * @param quantized: Filled with the 7 bit values
+ * @param pBit:      Set to the shared low bit that fits best
+ */
+static void bc7QuantizeEndpoint(const float endpoint[4], int quantized[4], int& pBit)
+{
+  int bestError = 1 << 30;
+
+  for (int p = 0; p < 2; p++)
+  {
+    int values[4];
+    int error = 0;
+    for (int c = 0; c < 4; c++)
+    {
+      values[c] = std::min(std::max((int)std::lround((endpoint[c] - p) / 2.0f), 0), 127);
+      int delta = (values[c] << 1 | p) - (int)std::lround(endpoint[c]);
+      error += delta * delta;
+    }
+
+    if (error < bestError)
+    {
+      bestError = error;
+      pBit = p;
+      memcpy(quantized, values, sizeof(values));
+    }
+  }
+}
+
+// The endpoints and indices of a BC7 mode 6 block
+struct Mode6
+{
+  int q0[4], q1[4];          // The endpoints, 7 bits per channel
+  int p0, p1;                // The endpoints' low bits
+  unsigned char indices[16]; // The 4 bit index of each pixel
+};
+
+/**
+ * Quantizes a pair of mode 6 endpoints and picks the indices for them
+ *
+ * @param block: 16 RGBA pixels
+ * @param f0:    The first endpoint, 0 to 255 per channel
+ * @param f1:    The second endpoint, 0 to 255 per channel
+ * @param mode:  Filled with the endpoints and indices
+ *
+ * @returns: The squared error of the block
+ */
+static int bc7Mode6Fit(const unsigned char block[64], const float f0[4], const float f1[4], Mode6& mode)
+{
+  bc7QuantizeEndpoint(f0, mode.q0, mode.p0);
+  bc7QuantizeEndpoint(f1, mode.q1, mode.p1);
+
+  int e0[4], e1[4];
+  for (int c = 0; c < 4; c++)
+  {
+    e0[c] = mode.q0[c] << 1 | mode.p0;
+    e1[c] = mode.q1[c] << 1 | mode.p1;
+  }
+
+  return bc7Indices(block, 0, 4, e0, e1, BC7_WEIGHTS4, 16, mode.indices);
+}
+
+/**
+ * Encodes a BC7 block with mode 6, one pair of RGBA endpoints with 16 values between them
+ *
+ * @param block: 16 RGBA pixels
+ * @param out:   Filled with the 16 byte block
+ *
+ * @returns: The squared error of the block
+ */
+static int encodeBC7Mode6(const unsigned char block[64], unsigned char* out)
+{
+  float f0[4], f1[4];
+  bc7PrincipalEndpoints(block, 0, 4, f0, f1);
+
+  Mode6 mode;
+  int error = bc7Mode6Fit(block, f0, f1, mode);
+
+  // One least squares pass over the chosen weights, kept only if it helps
+  Mode6 refit;
+  if (error > 0 && bc7Refit(block, 0, 4, mode.indices, BC7_WEIGHTS4, f0, f1))
+  {
+    int refitError = bc7Mode6Fit(block, f0, f1, refit);
+    if (refitError < error)
+    {
+      mode = refit;
+      error = refitError;
+    }
+  }
+
+  // The first pixel's index drops its top bit, so it must be below 8, swap the endpoints if it isn't
+  if (mode.indices[0] & 8)
+  {
+    std::swap(mode.q0, mode.q1);
+    std::swap(mode.p0, mode.p1);
+    for (int i = 0; i < 16; i++)
+      mode.indices[i] = (unsigned char)(15 - mode.indices[i]);
+  }
+
+  BlockBits bits;
+  bits.write(1 << 6, 7);
+  for (int c = 0; c < 4; c++)
+  {
+    bits.write((uint32_t)mode.q0[c], 7);
+    bits.write((uint32_t)mode.q1[c], 7);
+  }
+  bits.write((uint32_t)mode.p0, 1);
+  bits.write((uint32_t)mode.p1, 1);
+  bits.write(mode.indices[0], 3);
+  for (int i = 1; i < 16; i++)
+    bits.write(mode.indices[i], 4);
+
+  bits.store(out);
+  return error;
+}
+
+/**
+ * Quantizes a pair of mode 5 color endpoints and picks the indices for them
+ *
+ * @param block:   16 RGBA pixels
+ * @param f0:      The first endpoint, 0 to 255 per channel
+ * @param f1:      The second endpoint, 0 to 255 per channel
+ * @param q0:      Filled with the first endpoint, 7 bits per channel
+ * @param q1:      Filled with the second endpoint, 7 bits per channel
+ * @param indices: Filled with the 2 bit index of each pixel
+ *
+ * @returns: The squared error of the color channels
+ */
+static int bc7Mode5ColorFit(const unsigned char block[64], const float f0[4], const float f1[4], int q0[3], int q1[3], unsigned char indices[16])
+{
+  int e0[4], e1[4];
+  for (int c = 0; c < 3; c++)
+  {
+    // 7 bit endpoints are expanded by repeating their top bit
+    q0[c] = std::min(std::max((int)std::lround(f0[c] * 127.0f / 255.0f), 0), 127);
+    q1[c] = std::min(std::max((int)std::lround(f1[c] * 127.0f / 255.0f), 0), 127);
+    e0[c] = q0[c] << 1 | q0[c] >> 6;
+    e1[c] = q1[c] << 1 | q1[c] >> 6;
+  }
+
+  return bc7Indices(block, 0, 3, e0, e1, BC7_WEIGHTS2, 4, indices);
+}
+
+/**
+ * Encodes a BC7 block with mode 5, RGB and alpha endpoints each with their own indices
+ * Fits blocks whose alpha doesn't follow their color, like the edges of cutouts, which mode 6 can't
+ *
+ * @param block: 16 RGBA pixels
+ * @param out:   Filled with the 16 byte block
+ *
+ * @returns: The squared error of the block
+ */
+static int encodeBC7Mode5(const unsigned char block[64], unsigned char* out)
+{
+  float f0[4], f1[4];
+  bc7PrincipalEndpoints(block, 0, 3, f0, f1);
+
+  int q0[3], q1[3];
+  unsigned char colorIndices[16];
+  int colorError = bc7Mode5ColorFit(block, f0, f1, q0, q1, colorIndices);
+
+  int r0[3], r1[3];
+  unsigned char refitIndices[16];
+  if (colorError > 0 && bc7Refit(block, 0, 3, colorIndices, BC7_WEIGHTS2, f0, f1))
+  {
+    int refitError = bc7Mode5ColorFit(block, f0, f1, r0, r1, refitIndices);
+    if (refitError < colorError)
+    {
+      memcpy(q0, r0, sizeof(r0));
+      memcpy(q1, r1, sizeof(r1));
+      memcpy(colorIndices, refitIndices, sizeof(refitIndices));
+      colorError = refitError;
+    }
+  }
+
+  // Alpha endpoints are stored with all 8 bits, so its extremes are exact
+  int a0[4] = { 0, 0, 0, 255 };
+  int a1[4] = { 0, 0, 0, 0 };
+  for (int i = 0; i < 16; i++)
+  {
+    a0[3] = std::min(a0[3], (int)block[i * 4 + 3]);
+    a1[3] = std::max(a1[3], (int)block[i * 4 + 3]);
+  }
+
+  unsigned char alphaIndices[16];
+  int alphaError = bc7Indices(block, 3, 1, a0, a1, BC7_WEIGHTS2, 4, alphaIndices);
+
+  // The first pixel's indices drop their top bit, swap the endpoints of each set that needs it
+  if (colorIndices[0] & 2)
+  {
+    std::swap(q0, q1);
+    for (int i = 0; i < 16; i++)
+      colorIndices[i] = (unsigned char)(3 - colorIndices[i]);
+  }
+
+  if (alphaIndices[0] & 2)
+  {
+    std::swap(a0, a1);
+    for (int i = 0; i < 16; i++)
+      alphaIndices[i] = (unsigned char)(3 - alphaIndices[i]);
+  }
+
+  BlockBits bits;
+  bits.write(1 << 5, 6);
+  bits.write(0, 2); // No channel rotation
+  for (int c = 0; c < 3; c++)
+  {
+    bits.write((uint32_t)q0[c], 7);
+    bits.write((uint32_t)q1[c], 7);
+  }
+  bits.write((uint32_t)a0[3], 8);
+  bits.write((uint32_t)a1[3], 8);
+  bits.write(colorIndices[0], 1);
+  for (int i = 1; i < 16; i++)
+    bits.write(colorIndices[i], 2);
+  bits.write(alphaIndices[0], 1);
+  for (int i = 1; i < 16; i++)
+    bits.write(alphaIndices[i], 2);
+
+  bits.store(out);
+  return colorError + alphaError;
+}
+
+/**
+ * Encodes a BC7 block with whichever of modes 5 and 6 fits it better
+ * The other 6 modes split blocks into partitions, and need a far longer search to pick one
+ *
+ * @param block: 16 RGBA pixels
+ * @param out:   Filled with the 16 byte block
+ */
+static void encodeBC7(const unsigned char block[64], unsigned char* out)
+{
+  int error = encodeBC7Mode6(block, out);
+
+  // Mode 5's separate alpha only helps when alpha varies
+  bool alphaVaries = false;
+  for (int i = 1; i < 16 && !alphaVaries; i++)
+    alphaVaries = block[i * 4 + 3] != block[3];
+
+  if (error > 0 && alphaVaries)
+  {
+    unsigned char candidate[16];
+    if (encodeBC7Mode5(block, candidate) < error)
+      memcpy(out, candidate, sizeof(candidate));
+  }
+}
+
+/**
+ * Encodes an image
+ * Blocks on the right and bottom edges are padded by repeating the last column and row
+ *
+ * @param pixels:   The pixels, 8 bits per channel with rows tightly packed
+ * @param width:    The width, in pixels
+ * @param height:   The height, in pixels
+ * @param channels: The channels per pixel, 1 to 4, missing ones read as 0 and alpha as 255
+ * @param format:   The format to encode to
+ * @param pool:     Splits the rows of blocks across the pool, or nullptr to do it all on the calling thread
+ *                  Must be nullptr when called from one of the pool's tasks
+ *
+ * @returns: The encoded level
+ */
+CompressedLevel BlockCompressor::compress(const unsigned char* pixels, int width, int height, int channels, BlockFormat format, ThreadPool* pool)
+{
+  GL_TRACE_ZONE("BlockCompressor::compress");
+
+  CompressedLevel level;
+  level.width = width;
+  level.height = height;
+  level.blocks.resize(compressedSize(format, width, height));
+
+  if (level.blocks.empty())
+    return level;
+
+  int blocksWide = (width + 3) / 4;
+  int blocksHigh = (height + 3) / 4;
+  int bytes = blockBytes(format);
+  unsigned char* blocks = level.blocks.data();
+
+  ThreadPool::parallelFor(pool, blocksHigh, BLOCK_ROWS_PER_TASK, [&](int start, int end) {
+    unsigned char block[64];
+
+    for (int by = start; by < end; by++)
+    {
+      unsigned char* out = blocks + (size_t)by * blocksWide * bytes;
+
+      for (int bx = 0; bx < blocksWide; bx++, out += bytes)
+      {
+        loadBlock(pixels, width, height, channels, bx, by, block);
+
+        switch (format)
+        {
+        case BlockFormat::BC1:
+          encodeBC1(block, out);
+          break;
+        case BlockFormat::BC3:
+          encodeBC4(block, 3, out);
+          encodeBC1(block, out + 8);
+          break;
+        case BlockFormat::BC4:
+          encodeBC4(block, 0, out);
+          break;
+        case BlockFormat::BC5:
+          encodeBC4(block, 0, out);
+          encodeBC4(block, 1, out + 8);
+          break;
+        case BlockFormat::BC7:
+          encodeBC7(block, out);
+          break;
+        }
+      }
+    }
+  });
+
+  return level;
+}
+
+/**
+ * Picks a format for a number of channels
+ * 1 channel is BC4, 2 are BC5, 3 are BC1 and 4 are BC3, or BC7 for 3 and 4 when quality matters more than encode time
+ *
+ * @param channels:    The channels per pixel, 1 to 4
+ * @param highQuality: Use BC7 for color images
+ */
+BlockFormat BlockCompressor::formatFor(int channels, bool highQuality)
+{
+  switch (channels)
+  {
+  case 1:
+    return BlockFormat::BC4;
+  case 2:
+    return BlockFormat::BC5;
+  case 3:
+    return highQuality ? BlockFormat::BC7 : BlockFormat::BC1;
+  default:
+    return highQuality ? BlockFormat::BC7 : BlockFormat::BC3;
+  }
+}
+
+/**
+ * Gets the sized internal format to allocate a texture with
+ *
+ * @param format: The block format
+ * @param srgb:   Decode the color channels as sRGB, ignored for BC4 and BC5
+ */
+GLenum BlockCompressor::internalFormatFor(BlockFormat format, bool srgb)
+{
+  switch (format)
+  {
+  case BlockFormat::BC1:
+    return srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+  case BlockFormat::BC3:
+    return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+  case BlockFormat::BC4:
+    return GL_COMPRESSED_RED_RGTC1;
+  case BlockFormat::BC5:
+    return GL_COMPRESSED_RG_RGTC2;
+  case BlockFormat::BC7:
+    return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+  }
+
+  return 0;
+}
+
+/**
+ * Gets the size of one 4x4 block
+ *
+ * @param format: The block format
+ *
+ * @returns: 8 or 16 bytes
+ */
+int BlockCompressor::blockBytes(BlockFormat format)
+{
+  return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+}
+
+/**
+ * Gets the size of an encoded level
+ *
+ * @param format: The block format
+ * @param width:  The width, in pixels
+ * @param height: The height, in pixels
+ */
+size_t BlockCompressor::compressedSize(BlockFormat format, int width, int height)
+{
+  if (width <= 0 || height <= 0)
+    return 0;
+
+  return (size_t)((width + 3) / 4) * ((height + 3) / 4) * blockBytes(format);
+}
+
+/**
+ * Gets the instruction set the bounds search was compiled for
+ *
+ * @returns: "SSE2", "NEON" or "scalar"
+ */
+const char* BlockCompressor::getSimdName()
+{
+#if defined(BLOCK_COMPRESSION_SSE2)
+  return "SSE2";
+#elif defined(BLOCK_COMPRESSION_NEON)
+  return "NEON";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,115 @@
+#include <opengl-module/buffer.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/state_cache.h>
+
+/**
+ * Buffer Constructor
+ *
+ * @param size:  The size of the buffer, in bytes
+ * @param data:  The initial contents, or nullptr to leave it uninitialized
+ * @param flags: The storage flags passed to glNamedBufferStorage
+ */
+Buffer::Buffer(GLsizeiptr size, const void* data, GLbitfield flags)
+{
+  init(size, data, flags);
+}
+
+/**
+ * Initializes the buffer
+ * Allocates immutable storage of the given size
+ *
+ * @param size:  The size of the buffer, in bytes
+ * @param data:  The initial contents, or nullptr to leave it uninitialized
+ * @param flags: The storage flags passed to glNamedBufferStorage
+ */
+void Buffer::init(GLsizeiptr size, const void* data, GLbitfield flags)
+{
+  StateCache::checkContext("Buffer::init");
+
+  // Immutable storage can't be resized, so replace the old buffer
+  if (_init)
+    destroy();
+
+  glCreateBuffers(1, &_id);
+  glNamedBufferStorage(_id, size, data, flags);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::CreateBuffer, { _id, (uint32_t)size, flags }, data, data ? (uint32_t)size : 0);
+
+  _memoryTag = MemoryTracker::getCurrentTag();
+  MemoryTracker::allocate(MemoryKind::Buffer, _memoryTag, size);
+
+  _size = size;
+  _init = true;
+}
+
+/**
+ * Deletes the buffer
+ */
+void Buffer::destroy()
+{
+  StateCache::checkContext("Buffer::destroy");
+
+  if (!_init)
+    return;
+
+  StateCache::current().forgetBuffer(_id);
+  glDeleteBuffers(1, &_id);
+  MemoryTracker::release(MemoryKind::Buffer, _memoryTag, _size);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::DeleteBuffer, { _id });
+
+  _id = 0;
+  _size = 0;
+  _init = false;
+}
+
+/**
+ * Replaces part of the buffer's contents
+ * The buffer must have been created with GL_DYNAMIC_STORAGE_BIT
+ *
+ * @param offset: The offset to write at, in bytes
+ * @param size:   The number of bytes to write
+ * @param data:   The data to write
+ */
+void Buffer::setData(GLintptr offset, GLsizeiptr size, const void* data)
+{
+  StateCache::checkContext("Buffer::setData");
+
+  if (!_init)
+    return;
+
+  glNamedBufferSubData(_id, offset, size, data);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::BufferSubData, { _id, (uint32_t)offset }, data, (uint32_t)size);
+}
+
+/**
+ * Binds the buffer to a target
+ *
+ * @param target: The target to bind to
+ */
+void Buffer::bind(GLenum target) const
+{
+  StateCache::checkContext("Buffer::bind");
+
+  if (_init)
+    StateCache::current().bindBuffer(target, _id);
+}
+
+/**
+ * Binds the buffer to an indexed uniform or shader storage binding point
+ *
+ * @param target: GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+ * @param index:  The binding index
+ */
+void Buffer::bindBase(GLenum target, GLuint index) const
+{
+  StateCache::checkContext("Buffer::bindBase");
+
+  if (_init)
+    StateCache::current().bindBufferBase(target, index, _id);
+}
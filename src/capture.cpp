@@ -0,0 +1,120 @@
+#include <opengl-module/capture.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+std::atomic<bool> Capture::_active(false);
+
+// The open capture file, guarded by captureMutex
+static FILE* captureFile = nullptr;
+static int framesLeft = 0;
+static std::mutex captureMutex;
+
+/**
+ * Starts recording to a file
+ * Objects created before this are not in the capture, so GL starts it before the init callback
+ *
+ * @param path:   The file to write
+ * @param frames: The number of frames to record before stopping
+ *
+ * @returns: True if the file could be opened
+ */
+bool Capture::begin(const std::string& path, int frames)
+{
+  std::lock_guard<std::mutex> lock(captureMutex);
+
+  if (captureFile)
+    return false;
+
+  captureFile = fopen(path.c_str(), "wb");
+  if (!captureFile)
+  {
+    std::cerr << "ERROR::CAPTURE::FILE_NOT_OPENED: " << path << "\n";
+    return false;
+  }
+
+  // Buffer generously, payloads can be large and the file is written from hot paths
+  setvbuf(captureFile, nullptr, _IOFBF, 1 << 20);
+  fwrite(CAPTURE_MAGIC, 1, sizeof(CAPTURE_MAGIC), captureFile);
+
+  framesLeft = frames;
+  _active.store(true, std::memory_order_release);
+  return true;
+}
+
+/**
+ * Stops recording and closes the file
+ */
+void Capture::end()
+{
+  std::lock_guard<std::mutex> lock(captureMutex);
+
+  _active.store(false, std::memory_order_release);
+
+  if (captureFile)
+  {
+    fclose(captureFile);
+    captureFile = nullptr;
+  }
+}
+
+/**
+ * Records the end of a frame
+ * Stops recording once the requested number of frames has been captured
+ */
+void Capture::endFrame()
+{
+  if (!isActive())
+    return;
+
+  record(CaptureOp::FrameEnd, {});
+
+  bool finished;
+  {
+    std::lock_guard<std::mutex> lock(captureMutex);
+    finished = --framesLeft <= 0;
+  }
+
+  if (finished)
+    end();
+}
+
+/**
+ * Records a call
+ * Safe to call from any thread
+ *
+ * @param op:          The call
+ * @param args:        The call's arguments, see CaptureOp
+ * @param payload:     Data the call reads, or nullptr
+ * @param payloadSize: The size of the payload, in bytes
+ */
+void Capture::record(CaptureOp op, std::initializer_list<uint32_t> args, const void* payload, uint32_t payloadSize)
+{
+  std::lock_guard<std::mutex> lock(captureMutex);
+
+  if (!captureFile)
+    return;
+
+  if (!payload)
+    payloadSize = 0;
+
+  uint16_t header[2] = { (uint16_t)op, (uint16_t)args.size() };
+  fwrite(header, sizeof(header), 1, captureFile);
+  fwrite(&payloadSize, sizeof(payloadSize), 1, captureFile);
+
+  if (args.size())
+    fwrite(args.begin(), sizeof(uint32_t), args.size(), captureFile);
+  if (payloadSize)
+    fwrite(payload, 1, payloadSize, captureFile);
+}
+
+/**
+ * Stores a float in a capture argument
+ */
+uint32_t Capture::floatBits(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
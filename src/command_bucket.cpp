@@ -0,0 +1,207 @@
+#include <opengl-module/command_bucket.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/state_cache.h>
+#include <cstring>
+#include <utility>
+
+/**
+ * Converts a view depth to key bits that sort in the same order
+ *
+ * @param depth:       The distance from the camera, must not be negative
+ * @param backToFront: True to sort the farthest draws first, for transparent passes
+ *
+ * @returns: The depth bits for makeSortKey()
+ */
+uint32_t depthKey(float depth, bool backToFront)
+{
+  if (!(depth > 0.0f))
+    depth = 0.0f;
+
+  // The bits of a non-negative float increase with its value
+  uint32_t bits;
+  memcpy(&bits, &depth, sizeof(bits));
+
+  return backToFront ? ~bits : bits;
+}
+
+/**
+ * CommandBucket Constructor
+ *
+ * @param capacity: The maximum number of commands per frame
+ */
+CommandBucket::CommandBucket(uint32_t capacity)
+  : _keys(capacity), _commands(capacity), _order(capacity), _sortKeys(capacity), _scratchKeys(capacity), _scratch(capacity), _count(0)
+{
+}
+
+/**
+ * Adds a draw to the bucket
+ * Safe to call from any number of threads at once, but not while sorting or submitting
+ *
+ * @param key:     The sort key, see makeSortKey()
+ * @param command: The draw
+ *
+ * @returns: False if the bucket is full and the draw was dropped
+ */
+bool CommandBucket::add(uint64_t key, const DrawCommand& command)
+{
+  // Each thread claims its own slot, so no lock is needed to write it
+  uint32_t index = _count.fetch_add(1, std::memory_order_relaxed);
+
+  if (index >= _commands.size())
+    return false;
+
+  _keys[index] = key;
+  _commands[index] = command;
+  return true;
+}
+
+// Gets the number of commands in the bucket
+uint32_t CommandBucket::size() const
+{
+  uint32_t count = _count.load(std::memory_order_acquire);
+  uint32_t capacity = (uint32_t)_commands.size();
+
+  return count < capacity ? count : capacity;
+}
+
+/**
+ * Sorts the commands by key
+ * Called by submit() if commands were added since it was last called
+ */
+void CommandBucket::sort()
+{
+  uint32_t count = size();
+
+  // Sort a copy of the keys along with their indices, least significant byte first
+  // The original keys are kept in add() order so submit() can read each command's pass
+  memcpy(_sortKeys.data(), _keys.data(), count * sizeof(uint64_t));
+
+  uint64_t* keys = _sortKeys.data();
+  uint64_t* keysOut = _scratchKeys.data();
+
+  uint32_t* order = _order.data();
+  uint32_t* orderOut = _scratch.data();
+
+  for (uint32_t i = 0; i < count; i++)
+    order[i] = i;
+
+  for (int shift = 0; shift < 64; shift += 8)
+  {
+    uint32_t histogram[256] = {};
+
+    for (uint32_t i = 0; i < count; i++)
+      histogram[(keys[i] >> shift) & 0xFF]++;
+
+    // Every key has the same byte here, so this pass wouldn't move anything
+    if (count == 0 || histogram[(keys[0] >> shift) & 0xFF] == count)
+      continue;
+
+    uint32_t offset = 0;
+    for (uint32_t& bucket : histogram)
+    {
+      uint32_t size = bucket;
+      bucket = offset;
+      offset += size;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+      uint32_t destination = histogram[(keys[i] >> shift) & 0xFF]++;
+      keysOut[destination] = keys[i];
+      orderOut[destination] = order[i];
+    }
+
+    std::swap(keys, keysOut);
+    std::swap(order, orderOut);
+  }
+
+  // The result may have ended up in the scratch buffer
+  if (order != _order.data())
+    memcpy(_order.data(), order, count * sizeof(uint32_t));
+
+  _sortedCount = count;
+}
+
+/**
+ * Submits every command in key order
+ * Must be called on the render thread, after all threads have finished adding
+ *
+ * @param stateCache: The cache of the current context
+ */
+void CommandBucket::submit(StateCache& stateCache)
+{
+  StateCache::checkContext("CommandBucket::submit");
+
+  // Commands added after an earlier sort() aren't in _order yet
+  if (_sortedCount != size())
+    sort();
+
+  uint32_t count = size();
+  unsigned pass = 0xFFFFFFFFu;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint32_t index = _order[i];
+    const DrawCommand& command = _commands[index];
+
+    if (_passCallback)
+    {
+      unsigned commandPass = (unsigned)(_keys[index] >> 60);
+      if (commandPass != pass)
+      {
+        pass = commandPass;
+        _passCallback(pass);
+      }
+    }
+
+    stateCache.useProgram(command.program);
+    stateCache.bindVertexArray(command.vertexArray);
+
+    for (int unit = 0; unit < DRAW_COMMAND_TEXTURES; unit++)
+    {
+      if (command.textures[unit])
+        stateCache.bindTexture(unit, command.textures[unit]);
+    }
+
+    if (command.indexType)
+    {
+      glDrawElementsInstancedBaseVertexBaseInstance(command.mode, command.count, command.indexType, (const void*)(uintptr_t)command.first,
+                                                    command.instances, command.baseVertex, command.baseInstance);
+
+      if (Capture::isActive())
+      {
+        Capture::record(CaptureOp::DrawElements, { command.mode, (uint32_t)command.count, command.indexType, command.first,
+                                                   (uint32_t)command.instances, (uint32_t)command.baseVertex, command.baseInstance });
+      }
+    }
+    else
+    {
+      glDrawArraysInstancedBaseInstance(command.mode, command.first, command.count, command.instances, command.baseInstance);
+
+      if (Capture::isActive())
+        Capture::record(CaptureOp::DrawArrays, { command.mode, command.first, (uint32_t)command.count, (uint32_t)command.instances, command.baseInstance });
+    }
+  }
+}
+
+/**
+ * Submits every command in key order using the current context's cache
+ */
+void CommandBucket::submit()
+{
+  submit(StateCache::current());
+}
+
+/**
+ * Removes all of the commands, ready for the next frame
+ */
+void CommandBucket::clear()
+{
+  uint32_t count = _count.load(std::memory_order_acquire);
+  if (count > _commands.size())
+    _dropped += count - _commands.size();
+
+  _count.store(0, std::memory_order_release);
+  _sortedCount = 0;
+}
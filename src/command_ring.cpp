@@ -0,0 +1,139 @@
+#include <opengl-module/command_ring.h>
+#include <thread>
+
+// Number of times the consumer checks for work before going to sleep
+static const int SPIN_COUNT = 256;
+
+/**
+ * CommandRing Constructor
+ *
+ * @param slots: The number of commands the ring can hold, rounded up to a power of two
+ */
+CommandRing::CommandRing(size_t slots)
+  : _head(0), _tail(0), _consumerSleeping(false), _producerSleeping(false)
+{
+  size_t size = 1;
+  while (size < slots)
+    size <<= 1;
+
+  _slots.resize(size);
+  _mask = size - 1;
+}
+
+/**
+ * Runs every recorded command, blocking while the ring is empty
+ * Only call from the consumer thread
+ *
+ * @param stop: Returns once this is set and the ring is empty
+ */
+void CommandRing::consume(const std::atomic<bool>& stop)
+{
+  uint64_t tail = _tail.load(std::memory_order_relaxed);
+  int spins = 0;
+
+  while (true)
+  {
+    uint64_t head = _head.load(std::memory_order_acquire);
+
+    // Run everything recorded so far, publishing progress after each command
+    // so sync points waiting on a specific command are released as early as possible
+    if (tail != head)
+    {
+      while (tail != head)
+      {
+        Slot& slot = _slots[tail & _mask];
+        slot.execute(slot.payload);
+        _tail.store(++tail, std::memory_order_release);
+
+        // Pairs with the fence in waitForExecuted(), so either the producer sees the new tail
+        // or this sees that the producer is sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (_producerSleeping.load(std::memory_order_relaxed))
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _progress.notify_one();
+        }
+      }
+
+      spins = 0;
+      continue;
+    }
+
+    if (stop.load(std::memory_order_acquire))
+      return;
+
+    // Spin briefly, commands usually arrive in bursts
+    if (spins++ < SPIN_COUNT)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // Sleep until the producer records something
+    std::unique_lock<std::mutex> lock(_mutex);
+    _consumerSleeping.store(true, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    _wake.wait(lock, [&] {
+      return _head.load(std::memory_order_acquire) != tail || stop.load(std::memory_order_acquire);
+    });
+
+    _consumerSleeping.store(false, std::memory_order_relaxed);
+    spins = 0;
+  }
+}
+
+/**
+ * Wakes the consumer so it can notice a stop request
+ */
+void CommandRing::wakeConsumer()
+{
+  // Pairs with the fence in consume(), so either the consumer sees the new head
+  // or this sees that the consumer is sleeping
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (_consumerSleeping.load(std::memory_order_relaxed))
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _wake.notify_one();
+  }
+}
+
+/**
+ * Blocks until a number of commands have run, sleeping rather than spinning once a short spin fails
+ * Only call from the producer thread
+ *
+ * @param count: The number of commands, compared with getExecuted()
+ */
+void CommandRing::waitForExecuted(uint64_t count)
+{
+  // Spin briefly, the consumer is often about to get there
+  for (int spins = 0; spins < SPIN_COUNT; spins++)
+  {
+    if (_tail.load(std::memory_order_acquire) >= count)
+      return;
+
+    std::this_thread::yield();
+  }
+
+  // Sleep until the consumer has run far enough, so waiting on a swap or vsync doesn't burn a core
+  std::unique_lock<std::mutex> lock(_mutex);
+  _producerSleeping.store(true, std::memory_order_seq_cst);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  _progress.wait(lock, [&] { return _tail.load(std::memory_order_acquire) >= count; });
+
+  _producerSleeping.store(false, std::memory_order_relaxed);
+}
+
+/**
+ * Blocks until the slot at head is free
+ *
+ * @param head: The slot the producer wants to write
+ */
+void CommandRing::waitForSpace(uint64_t head)
+{
+  if (head - _tail.load(std::memory_order_acquire) >= _slots.size())
+    waitForExecuted(head - _slots.size() + 1);
+}
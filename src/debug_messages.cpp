@@ -0,0 +1,128 @@
+#include <opengl-module/debug_messages.h>
+#include <algorithm>
+#include <iostream>
+
+/**
+ * Forwards messages from the driver to the DebugMessages that installed the callback
+ */
+static void APIENTRY debugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
+{
+  DebugMessages* messages = (DebugMessages*)userParam;
+  messages->record(source, type, id, severity, length, message);
+}
+
+/**
+ * Installs the callback on the current context
+ * Does nothing if the context wasn't created with the debug flag
+ *
+ * @returns: True if the callback was installed
+ */
+bool DebugMessages::install()
+{
+  GLint flags = 0;
+  glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+
+  if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT))
+  {
+    std::cerr << "ERROR::DEBUG_MESSAGES::NOT_A_DEBUG_CONTEXT: The driver did not create a debug context\n";
+    return false;
+  }
+
+  glEnable(GL_DEBUG_OUTPUT);
+  glDebugMessageCallback(debugCallback, this);
+
+  // Notifications are mostly informational chatter about allocations
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+  return true;
+}
+
+/**
+ * Records a message
+ * Called by the debug callback
+ */
+void DebugMessages::record(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  Key key = { source, type, id };
+  DebugMessageCount& entry = _messages[key];
+
+  if (entry.count++ == 0)
+  {
+    entry.source = source;
+    entry.type = type;
+    entry.id = id;
+    entry.severity = severity;
+    entry.message = length < 0 ? std::string(message) : std::string(message, length);
+
+    // Errors are worth seeing right away, everything else is left for the report
+    if (type == GL_DEBUG_TYPE_ERROR)
+      std::cerr << "ERROR::GL::DEBUG: " << entry.message << "\n";
+  }
+}
+
+/**
+ * Gets the performance messages, most frequent first
+ */
+std::vector<DebugMessageCount> DebugMessages::getPerformanceMessages() const
+{
+  std::vector<DebugMessageCount> performance;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& entry : _messages)
+    {
+      if (entry.second.type == GL_DEBUG_TYPE_PERFORMANCE)
+        performance.push_back(entry.second);
+    }
+  }
+
+  std::sort(performance.begin(), performance.end(), [](const DebugMessageCount& a, const DebugMessageCount& b) {
+    return a.count > b.count;
+  });
+
+  return performance;
+}
+
+/**
+ * Gets the total number of messages of a type
+ *
+ * @param type: The message type, like GL_DEBUG_TYPE_ERROR
+ */
+unsigned long DebugMessages::getCount(GLenum type) const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  unsigned long count = 0;
+  for (const auto& entry : _messages)
+  {
+    if (entry.second.type == type)
+      count += entry.second.count;
+  }
+
+  return count;
+}
+
+/**
+ * Prints the performance messages and how many times each was reported
+ *
+ * @param out: The stream to print to
+ */
+void DebugMessages::printReport(std::ostream& out) const
+{
+  std::vector<DebugMessageCount> performance = getPerformanceMessages();
+
+  if (performance.empty())
+    return;
+
+  out << "GL performance messages:\n";
+  for (const DebugMessageCount& message : performance)
+    out << "  " << message.count << "x [id " << message.id << "] " << message.message << "\n";
+}
+
+// Forgets every message recorded so far
+void DebugMessages::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _messages.clear();
+}
@@ -0,0 +1,177 @@
+#include <opengl-module/flight_recorder.h>
+#include <opengl-module/trace.h>
+#include <cstdio>
+#include <iostream>
+
+// Stops the writer thread
+FlightRecorder::~FlightRecorder()
+{
+  stop();
+}
+
+/**
+ * Enables tracing and starts the writer thread
+ *
+ * @param path:        The file to write, dumps are numbered, so trace.json becomes trace-1.json, trace-2.json...
+ * @param thresholdMs: Frames longer than this trigger a dump, in milliseconds
+ * @param frames:      The number of frames before the spike to include
+ */
+void FlightRecorder::start(const std::string& path, double thresholdMs, int frames)
+{
+  if (isRunning())
+    return;
+
+  _path = path;
+  _thresholdMs = thresholdMs;
+  _frames = frames < 1 ? 1 : frames;
+
+  _frameStarts.assign(_frames + 1, 0);
+  _frameCount = 0;
+  _framesUntilDump = -1;
+  _stop = false;
+
+  _traceWasEnabled = Trace::isEnabled();
+  Trace::setEnabled(true);
+  _thread = std::thread(&FlightRecorder::threadMain, this);
+}
+
+/**
+ * Waits for a dump in progress, then stops the writer thread
+ * Turns tracing back off if it was off when start() was called
+ */
+void FlightRecorder::stop()
+{
+  if (!isRunning())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+
+  _wake.notify_one();
+  _thread.join();
+
+  Trace::setEnabled(_traceWasEnabled);
+}
+
+/**
+ * Records the end of a frame, and requests a dump if it took too long
+ * Only call from the thread running the frame loop
+ *
+ * @param start: When the frame started, from Trace::now()
+ * @param end:   When the frame ended, from Trace::now()
+ */
+void FlightRecorder::endFrame(uint64_t start, uint64_t end)
+{
+  _frameStarts[_frameCount % _frameStarts.size()] = start;
+  _frameCount++;
+
+  // Wait a few frames after a spike, so its GPU zones are in the rings too
+  if (_framesUntilDump > 0)
+  {
+    _framesUntilDump--;
+    return;
+  }
+
+  if (_framesUntilDump == 0)
+  {
+    _framesUntilDump = -1;
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_writing || _dumpRequested)
+        return;
+
+      _dumpRequested = true;
+      _requestedSince = _dumpSince;
+    }
+
+    _wake.notify_one();
+    return;
+  }
+
+  if ((end - start) / 1e6 <= _thresholdMs)
+    return;
+
+  // The oldest start in the ring is the frame N before this one, or the first frame recorded
+  uint64_t oldest = _frameCount > _frameStarts.size() ? _frameCount - _frameStarts.size() : 0;
+  _dumpSince = _frameStarts[oldest % _frameStarts.size()];
+  _framesUntilDump = FRAMES_AFTER_SPIKE;
+}
+
+/**
+ * Gets the number of dumps written so far
+ */
+int FlightRecorder::getDumpCount()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _dumpCount;
+}
+
+/**
+ * Waits for dump requests and writes them
+ */
+void FlightRecorder::threadMain()
+{
+  Trace::setThreadName("FlightRecorder");
+
+  std::vector<TraceThread> threads;
+
+  while (true)
+  {
+    uint64_t since;
+    int index;
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wake.wait(lock, [this] { return _stop || _dumpRequested; });
+
+      if (_stop)
+        break;
+
+      since = _requestedSince;
+      index = _dumpCount + 1;
+      _dumpRequested = false;
+      _writing = true;
+    }
+
+    // The rings are read without locking, so copying here doesn't hold up the frame loop
+    Trace::snapshot(since, threads);
+
+    std::string path = dumpPath(index);
+    FILE* file = fopen(path.c_str(), "w");
+    if (file)
+    {
+      Trace::writeChrome(file, threads);
+      fclose(file);
+    }
+    else
+    {
+      std::cerr << "ERROR::FLIGHT_RECORDER::FILE_NOT_OPENED: " << path << "\n";
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _writing = false;
+    if (file)
+      _dumpCount = index;
+  }
+}
+
+/**
+ * Gets the path of a numbered dump
+ *
+ * @param index: The dump's number
+ */
+std::string FlightRecorder::dumpPath(int index) const
+{
+  std::string number = "-" + std::to_string(index);
+
+  // Only treat a dot in the file name as the extension, not one in a directory
+  size_t dot = _path.find_last_of('.');
+  size_t slash = _path.find_last_of("/\\");
+  if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+    return _path + number;
+
+  return _path.substr(0, dot) + number + _path.substr(dot);
+}
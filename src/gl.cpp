@@ -1,4 +1,10 @@
 #include <opengl-module/gl.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/trace.h>
+#ifdef OPENGL_MODULE_LAZY_GL_LOADER
+#include <glad/glad_lazy.h>
+#endif
 #include <GLFW/glfw3.h>
 #include <iostream>
 
@@ -44,38 +50,163 @@ GL::~GL()
  */
 int GL::run(Callback updateCallback, Callback renderCallback, Callback initCallback, std::string windowName, int windowWidth, int windowHeight)
 {
+  uint64_t runStart = Trace::now();
+  Trace::setThreadName("Main");
+
+  // Start the CPU only preparation first, so it overlaps with creating the window and context
+  for (std::function<void()>& task : _prepareTasks)
+    _threadPool.submit(std::move(task));
+  _prepareTasks.clear();
+
   // Initialize glfw and glad
   _init = init(windowName, windowWidth, windowHeight);
 
-  // Check if initialization failed
+  // Check if initialization failed, the tasks may still be using the app's data
   if (!_init)
+  {
+    _threadPool.wait();
     return -1;
+  }
+
+  // Create the latency queries before the first frame
+  if (_trackLatency)
+    _latency.init();
+
+  // Start capturing before the init callback creates its objects
+  if (!_capturePath.empty())
+    Capture::begin(_capturePath, _captureFrames);
+
+  // The placeholder has to exist before the init callback starts loading textures
+  _textureLoader.init(_threadPool);
+
+  if (_textureStreamSlice > 0)
+    _textureStream.init(_textureStreamSlice, _textureStreamSlices);
+
+  // The init callback uploads what the prepare tasks produced
+  uint64_t prepareStart = Trace::now();
+  _threadPool.wait();
+  uint64_t prepareEnd = Trace::now();
+  recordStartupStep("Startup::prepareWait", prepareStart, prepareEnd, _startupTiming.prepareWait);
 
   // Call the init callback, if not nullptr
   if (initCallback)
     initCallback();
 
+  uint64_t initCallbackEnd = Trace::now();
+  recordStartupStep("Startup::initCallback", prepareEnd, initCallbackEnd, _startupTiming.initCallback);
+  bool firstFrame = true;
+
+  if (!_flightRecorderPath.empty())
+    _flightRecorder.start(_flightRecorderPath, _flightRecorderThreshold, _flightRecorderFrames);
+
+  // Hand the context over once the init callback has finished setting things up
+  if (_useSubmissionThread)
+    _submission.start(_window, _stateCache);
+
   // Loop until the window should close
   while (!glfwWindowShouldClose(_window))
   {
+    uint64_t frameStart = Trace::now();
+
     // Check for input
     processInput(_window);
 
     // Check for any events like key press or mouse clicks
     // Invokes appropriate callbacks
     glfwPollEvents();
+    _inputTime = glfwGetTime();
+    uint64_t pollEnd = Trace::now();
 
     // Call update callback if not nullptr
     if (updateCallback)
       updateCallback();
 
+    uint64_t updateEnd = Trace::now();
+
+    // GPU zones are issued on the main context, which belongs to the submission thread when it runs
+    int gpuZone = _submission.isRunning() ? -1 : Trace::gpuBegin("GL::render");
+
+    // Allocate new targets and reallocate resized ones before rendering,
+    // and upload this frame's share of the decoded textures
+    if (_submission.isRunning())
+    {
+      _submission.enqueue([this]() {
+        _renderTargets.update();
+        _textureLoader.update();
+      });
+    }
+    else
+    {
+      _renderTargets.update();
+      _textureLoader.update();
+    }
+
     // Call render callback if not nullptr
     if (renderCallback)
       renderCallback();
 
-    glfwSwapBuffers(_window);
+    // Sample input again and let the late latch callback patch the frame
+    if (_lateLatchCallback)
+    {
+      glfwPollEvents();
+      _inputTime = glfwGetTime();
+      _lateLatchCallback();
+    }
+
+    // Fence the texture stream's slice behind this frame's uploads
+    if (_submission.isRunning())
+      _submission.enqueue([this]() { _textureStream.endFrame(); });
+    else
+      _textureStream.endFrame();
+
+    Trace::gpuEnd(gpuZone);
+
+    uint64_t renderEnd = Trace::now();
+    present();
+    uint64_t presentEnd = Trace::now();
+
+    if (firstFrame)
+    {
+      recordStartupStep("Startup::firstFrame", initCallbackEnd, presentEnd, _startupTiming.firstFrame);
+      recordStartupStep("Startup", runStart, presentEnd, _startupTiming.total);
+      firstFrame = false;
+    }
+
+    // Render any other windows with their own contexts
+    if (!_secondaryWindows.empty())
+      renderSecondaryWindows();
+
+    uint64_t frameEnd = Trace::now();
+    _frameTiming.poll = (pollEnd - frameStart) / 1e6;
+    _frameTiming.update = (updateEnd - pollEnd) / 1e6;
+    _frameTiming.render = (renderEnd - updateEnd + frameEnd - presentEnd) / 1e6;
+    _frameTiming.present = (presentEnd - renderEnd) / 1e6;
+
+    if (Trace::isEnabled())
+    {
+      Trace::record("GL::frame", frameStart, frameEnd);
+      Trace::record("GL::poll", frameStart, pollEnd);
+      Trace::record("GL::update", pollEnd, updateEnd);
+      Trace::record("GL::render", updateEnd, renderEnd);
+      Trace::record("GL::present", renderEnd, presentEnd);
+
+      if (!_submission.isRunning())
+        Trace::resolveGpu();
+    }
+
+    if (_flightRecorder.isRunning())
+      _flightRecorder.endFrame(frameStart, frameEnd);
+
+    MemoryTracker::endFrame();
   }
 
+  // Take the context back before releasing anything
+  _submission.stop();
+
+  // Close the capture if the window closed before enough frames were recorded
+  Capture::end();
+  _flightRecorder.stop();
+
   // Handle deallocation of resources after the window should close
   destroyWindow();
 
@@ -83,6 +214,52 @@ int GL::run(Callback updateCallback, Callback renderCallback, Callback initCallb
   return 0;
 }
 
+/**
+ * Swaps the main window's buffers and ends the frame
+ * With the submission thread, the swap is recorded and this waits
+ * until the previous frame has been swapped
+ */
+void GL::present()
+{
+  if (!_submission.isRunning())
+  {
+    glfwSwapBuffers(_window);
+    _latency.endFrame(_inputTime);
+    Capture::endFrame();
+    return;
+  }
+
+  // glfwSwapBuffers can be called from any thread
+  double inputTime = _inputTime;
+  _submission.enqueue([this, inputTime]() {
+    glfwSwapBuffers(_window);
+    _latency.endFrame(inputTime);
+    Capture::endFrame();
+  });
+
+  // Let this thread record the next frame while the last one is submitted, but no further
+  // Sleeps while the submission thread is blocked in the swap
+  uint64_t previousSwap = _previousSwap;
+  _previousSwap = _submission.getRecorded();
+  _submission.waitForExecuted(previousSwap);
+}
+
+/**
+ * Stores how long a step of starting up took, and records it as a trace zone
+ *
+ * @param name:     The zone's name
+ * @param start:    When the step started, from Trace::now()
+ * @param end:      When the step ended, from Trace::now()
+ * @param duration: Set to the step's length, in milliseconds
+ */
+void GL::recordStartupStep(const char* name, uint64_t start, uint64_t end, double& duration)
+{
+  duration = (end - start) / 1e6;
+
+  if (Trace::isEnabled())
+    Trace::record(name, start, end);
+}
+
 /**
  * Handles the creation of the context and window
  * Loads gl with glad
@@ -95,6 +272,8 @@ int GL::run(Callback updateCallback, Callback renderCallback, Callback initCallb
  */
 bool GL::init(std::string windowName, int windowWidth, int windowHeight)
 {
+  uint64_t initStart = Trace::now();
+
   // Initialize glfw, and return false if there was an error
   if (!glfwInit())
   {
@@ -102,14 +281,24 @@ bool GL::init(std::string windowName, int windowWidth, int windowHeight)
     return false;
   }
 
+  uint64_t glfwEnd = Trace::now();
+  recordStartupStep("Startup::glfwInit", initStart, glfwEnd, _startupTiming.glfwInit);
+
   // Set opengl version
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
   glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+  // Ask for a debug or no error context
+  glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, _contextMode == ContextMode::Debug ? GLFW_TRUE : GLFW_FALSE);
+  glfwWindowHint(GLFW_CONTEXT_NO_ERROR, _contextMode == ContextMode::NoError ? GLFW_TRUE : GLFW_FALSE);
+  glfwWindowHint(GLFW_VISIBLE, _windowVisible ? GLFW_TRUE : GLFW_FALSE);
+
   // Create the window and the context
   _window = glfwCreateWindow(windowWidth, windowHeight, windowName.c_str(), NULL, NULL);
   glfwMakeContextCurrent(_window);
+  _currentWindow = _window;
+  _stateCache.makeCurrent();
 
   // Check for errors during window creation
   if (!_window)
@@ -118,21 +307,152 @@ bool GL::init(std::string windowName, int windowWidth, int windowHeight)
     return false;
   }
 
+  uint64_t windowEnd = Trace::now();
+  recordStartupStep("Startup::createWindow", glfwEnd, windowEnd, _startupTiming.createWindow);
+
   // Load GL with glad, and check for errors
+  // The lazy loader resolves each function on its first call instead of all of them here
+#ifdef OPENGL_MODULE_LAZY_GL_LOADER
+  if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress))
+#else
   if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+#endif
   {
     std::cerr << "Failed to initialize GLAD" << std::endl;
     return false;
   }
 
-  // Set the viewport and window resize callback
-  glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
+  uint64_t gladEnd = Trace::now();
+  recordStartupStep("Startup::loadGL", windowEnd, gladEnd, _startupTiming.loadGL);
+
+  // Collect the driver's messages as early as possible
+  if (_contextMode == ContextMode::Debug)
+    _debugMessages.install();
+
+  // Set the viewport from the actual framebuffer size, which can differ
+  // from the requested window size on high DPI displays
+  int framebufferWidth, framebufferHeight;
+  glfwGetFramebufferSize(_window, &framebufferWidth, &framebufferHeight);
+  _stateCache.viewport(0, 0, framebufferWidth, framebufferHeight);
+  _renderTargets.resize(framebufferWidth, framebufferHeight);
+
+  // Set the window resize callback
   glfwSetFramebufferSizeCallback(_window, (GLFWframebuffersizefun)framebufferSizeCallback);
 
+  if (_swapIntervalSet)
+    glfwSwapInterval(_swapInterval);
+
+  // Start the loader thread once glad has loaded, it uses the same function pointers
+  if (_useLoaderThread && !_loader.start(_window, _windowVisible))
+    return false;
+
+  recordStartupStep("Startup::setup", gladEnd, Trace::now(), _startupTiming.setup);
+
   // No errors occured, so return true
   return true;
 }
 
+/**
+ * Sets the swap interval of the main window
+ * Can be called before or during GL::run()
+ *
+ * @param interval: The number of screen updates to wait before swapping, 0 disables vsync
+ */
+void GL::setSwapInterval(int interval)
+{
+  _swapInterval = interval;
+  _swapIntervalSet = true;
+
+  // The swap interval belongs to the current context, so only apply it to the main window's
+  if (_init && glfwGetCurrentContext() == _window)
+    glfwSwapInterval(interval);
+}
+
+/**
+ * Opens another window rendered by the same loop as the main window
+ * Its context shares objects with the main window
+ *
+ * @param windowName:     The name to give the window
+ * @param renderCallback: A function called every frame with this window's context current
+ * @param windowWidth:    The width of the window, in pixels
+ * @param windowHeight:   The height of the window, in pixels
+ * @param swapInterval:   The number of screen updates to wait before swapping this window
+ *
+ * @returns: The new window, or nullptr if it could not be created
+ */
+GLFWwindow* GL::addWindow(std::string windowName, Callback renderCallback, int windowWidth, int windowHeight, int swapInterval)
+{
+  if (!_init)
+  {
+    std::cerr << "ERROR::GL::NOT_RUNNING: Secondary windows can only be added while GL is running\n";
+    return nullptr;
+  }
+
+  if (_useSubmissionThread)
+  {
+    std::cerr << "ERROR::GL::SUBMISSION_THREAD: Secondary windows are not supported with the submission thread\n";
+    return nullptr;
+  }
+
+  // Passing the main window shares its objects with the new context
+  // The window hints from GL::init() are still set, so it gets the same context version
+  GLFWwindow* window = glfwCreateWindow(windowWidth, windowHeight, windowName.c_str(), NULL, _window);
+  if (!window)
+  {
+    std::cerr << "Could not create window or context for " << windowName << "\n";
+    return nullptr;
+  }
+
+  // The swap interval is per context, so set it once while the new context is current
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(swapInterval);
+  glfwMakeContextCurrent(_currentWindow);
+
+  _secondaryWindows.push_back({ window, renderCallback, std::make_shared<StateCache>() });
+  return window;
+}
+
+/**
+ * Renders each secondary window and swaps its buffers
+ * Destroys any that have been closed
+ * The main window's context is current again afterwards
+ */
+void GL::renderSecondaryWindows()
+{
+  for (size_t i = 0; i < _secondaryWindows.size();)
+  {
+    SecondaryWindow& secondary = _secondaryWindows[i];
+
+    processInput(secondary.window);
+
+    glfwMakeContextCurrent(secondary.window);
+    _currentWindow = secondary.window;
+    secondary.stateCache->makeCurrent();
+
+    if (glfwWindowShouldClose(secondary.window))
+    {
+      glfwDestroyWindow(secondary.window);
+      _secondaryWindows.erase(_secondaryWindows.begin() + i);
+      continue;
+    }
+
+    // The resize callback only updates the main context's viewport
+    int width, height;
+    glfwGetFramebufferSize(secondary.window, &width, &height);
+    secondary.stateCache->viewport(0, 0, width, height);
+
+    if (secondary.renderCallback)
+      secondary.renderCallback();
+
+    glfwSwapBuffers(secondary.window);
+    i++;
+  }
+
+  glfwMakeContextCurrent(_window);
+  _currentWindow = _window;
+  _stateCache.makeCurrent();
+}
+
 /**
  * Destroys the window and terminates OpenGL
  * Uninitializes glfw and glad
@@ -143,6 +463,29 @@ void GL::destroyWindow()
   if (!_init)
     return;
 
+  // Finish any uploads in flight before the context they share objects with is destroyed
+  _loader.stop();
+  _threadPool.stop();
+
+  // Destroy the secondary windows before the context they share objects with
+  for (SecondaryWindow& secondary : _secondaryWindows)
+    glfwDestroyWindow(secondary.window);
+  _secondaryWindows.clear();
+
+  glfwMakeContextCurrent(_window);
+  _currentWindow = _window;
+
+  // Report the driver's performance warnings before the context is gone
+  if (_contextMode == ContextMode::Debug)
+    _debugMessages.printReport(std::cerr);
+
+  // Delete the queries, render targets and textures still streaming in while the context is still current
+  _latency.destroy();
+  Trace::destroyGpu();
+  _renderTargets.destroy();
+  _textureLoader.destroy();
+  _textureStream.destroy();
+
   if (_window)
     glfwDestroyWindow(_window);
 
@@ -160,7 +503,26 @@ void GL::destroyWindow()
  */
 void framebufferSizeCallback(const GLFWwindow* window, int width, int height)
 {
-  glViewport(0, 0, width, height);
+  SubmissionThread& submission = GL::getInstance().getSubmissionThread();
+  StateCache& stateCache = GL::getInstance().getStateCache();
+
+  RenderTargets& renderTargets = GL::getInstance().getRenderTargets();
+
+  // The context lives on the submission thread, so the viewport has to be set there
+  // Set through the main context's cache, so a later viewport() call isn't skipped against a stale size
+  // The render targets are resized and reallocated there too, in order with the frames that use them
+  if (submission.isRunning())
+  {
+    submission.enqueue([&stateCache, &renderTargets, width, height]() {
+      stateCache.viewport(0, 0, width, height);
+      renderTargets.resize(width, height);
+    });
+  }
+  else
+  {
+    stateCache.viewport(0, 0, width, height);
+    renderTargets.resize(width, height);
+  }
 }
 
 /**
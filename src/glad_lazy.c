@@ -0,0 +1,5310 @@
+/*
+    Lazy OpenGL loader, generated from glad.h by tools/gen_glad_lazy.py
+    Do not edit, run the generator again instead
+
+    Every glad_gl* pointer starts out pointing at a trampoline that resolves the real
+    function and patches the pointer on the first call. Racing first calls from
+    several threads resolve the same address, so the patch is idempotent
+*/
+
+#include <stdio.h>
+#include <glad/glad_lazy.h>
+
+static GLADloadproc lazyLoad = NULL;
+
+/* Resolves a function, reporting the ones the driver doesn't have */
+static void* glad_lazy_resolve(const char* name) {
+    void* proc = lazyLoad ? lazyLoad(name) : NULL;
+    if (proc == NULL) {
+        fprintf(stderr, "ERROR::GLAD_LAZY::FUNCTION_NOT_FOUND: %s\n", name);
+    }
+    return proc;
+}
+
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+    glad_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace");
+    glad_glCullFace(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+    glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace");
+    glad_glFrontFace(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+    glad_glHint = (PFNGLHINTPROC)glad_lazy_resolve("glHint");
+    glad_glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+    glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth");
+    glad_glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+    glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize");
+    glad_glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+    glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode");
+    glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glScissor = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor");
+    glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf");
+    glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv");
+    glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri");
+    glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv");
+    glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D");
+    glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D");
+    glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+    glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer");
+    glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+    glad_glClear = (PFNGLCLEARPROC)glad_lazy_resolve("glClear");
+    glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor");
+    glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+    glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil");
+    glad_glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+    glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth");
+    glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+    glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask");
+    glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    glad_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask");
+    glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+    glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask");
+    glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+    glad_glDisable = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable");
+    glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+    glad_glEnable = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable");
+    glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+    glad_glFinish = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish");
+    glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+    glad_glFlush = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush");
+    glad_glFlush();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc");
+    glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+    glad_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp");
+    glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc");
+    glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp");
+    glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+    glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc");
+    glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+    glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref");
+    glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+    glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei");
+    glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+    glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer");
+    glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels");
+    glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+    glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv");
+    glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+    glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev");
+    glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+    glad_glGetError = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError");
+    return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+    glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv");
+    glad_glGetFloatv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv");
+    glad_glGetIntegerv(pname, data);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+    glad_glGetString = (PFNGLGETSTRINGPROC)glad_lazy_resolve("glGetString");
+    return glad_glGetString(name);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage");
+    glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv");
+    glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv");
+    glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv");
+    glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv");
+    glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+    glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled");
+    return glad_glIsEnabled(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+    glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange");
+    glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport");
+    glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) {
+    glad_glNewList = (PFNGLNEWLISTPROC)glad_lazy_resolve("glNewList");
+    glad_glNewList(list, mode);
+}
+static void APIENTRY glad_lazy_glEndList(void) {
+    glad_glEndList = (PFNGLENDLISTPROC)glad_lazy_resolve("glEndList");
+    glad_glEndList();
+}
+static void APIENTRY glad_lazy_glCallList(GLuint list) {
+    glad_glCallList = (PFNGLCALLLISTPROC)glad_lazy_resolve("glCallList");
+    glad_glCallList(list);
+}
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+    glad_glCallLists = (PFNGLCALLLISTSPROC)glad_lazy_resolve("glCallLists");
+    glad_glCallLists(n, type, lists);
+}
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) {
+    glad_glDeleteLists = (PFNGLDELETELISTSPROC)glad_lazy_resolve("glDeleteLists");
+    glad_glDeleteLists(list, range);
+}
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) {
+    glad_glGenLists = (PFNGLGENLISTSPROC)glad_lazy_resolve("glGenLists");
+    return glad_glGenLists(range);
+}
+static void APIENTRY glad_lazy_glListBase(GLuint base) {
+    glad_glListBase = (PFNGLLISTBASEPROC)glad_lazy_resolve("glListBase");
+    glad_glListBase(base);
+}
+static void APIENTRY glad_lazy_glBegin(GLenum mode) {
+    glad_glBegin = (PFNGLBEGINPROC)glad_lazy_resolve("glBegin");
+    glad_glBegin(mode);
+}
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+    glad_glBitmap = (PFNGLBITMAPPROC)glad_lazy_resolve("glBitmap");
+    glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    glad_glColor3b = (PFNGLCOLOR3BPROC)glad_lazy_resolve("glColor3b");
+    glad_glColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) {
+    glad_glColor3bv = (PFNGLCOLOR3BVPROC)glad_lazy_resolve("glColor3bv");
+    glad_glColor3bv(v);
+}
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    glad_glColor3d = (PFNGLCOLOR3DPROC)glad_lazy_resolve("glColor3d");
+    glad_glColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) {
+    glad_glColor3dv = (PFNGLCOLOR3DVPROC)glad_lazy_resolve("glColor3dv");
+    glad_glColor3dv(v);
+}
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    glad_glColor3f = (PFNGLCOLOR3FPROC)glad_lazy_resolve("glColor3f");
+    glad_glColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) {
+    glad_glColor3fv = (PFNGLCOLOR3FVPROC)glad_lazy_resolve("glColor3fv");
+    glad_glColor3fv(v);
+}
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) {
+    glad_glColor3i = (PFNGLCOLOR3IPROC)glad_lazy_resolve("glColor3i");
+    glad_glColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) {
+    glad_glColor3iv = (PFNGLCOLOR3IVPROC)glad_lazy_resolve("glColor3iv");
+    glad_glColor3iv(v);
+}
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+    glad_glColor3s = (PFNGLCOLOR3SPROC)glad_lazy_resolve("glColor3s");
+    glad_glColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) {
+    glad_glColor3sv = (PFNGLCOLOR3SVPROC)glad_lazy_resolve("glColor3sv");
+    glad_glColor3sv(v);
+}
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    glad_glColor3ub = (PFNGLCOLOR3UBPROC)glad_lazy_resolve("glColor3ub");
+    glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) {
+    glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)glad_lazy_resolve("glColor3ubv");
+    glad_glColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+    glad_glColor3ui = (PFNGLCOLOR3UIPROC)glad_lazy_resolve("glColor3ui");
+    glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) {
+    glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)glad_lazy_resolve("glColor3uiv");
+    glad_glColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+    glad_glColor3us = (PFNGLCOLOR3USPROC)glad_lazy_resolve("glColor3us");
+    glad_glColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) {
+    glad_glColor3usv = (PFNGLCOLOR3USVPROC)glad_lazy_resolve("glColor3usv");
+    glad_glColor3usv(v);
+}
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    glad_glColor4b = (PFNGLCOLOR4BPROC)glad_lazy_resolve("glColor4b");
+    glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) {
+    glad_glColor4bv = (PFNGLCOLOR4BVPROC)glad_lazy_resolve("glColor4bv");
+    glad_glColor4bv(v);
+}
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    glad_glColor4d = (PFNGLCOLOR4DPROC)glad_lazy_resolve("glColor4d");
+    glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) {
+    glad_glColor4dv = (PFNGLCOLOR4DVPROC)glad_lazy_resolve("glColor4dv");
+    glad_glColor4dv(v);
+}
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glColor4f = (PFNGLCOLOR4FPROC)glad_lazy_resolve("glColor4f");
+    glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) {
+    glad_glColor4fv = (PFNGLCOLOR4FVPROC)glad_lazy_resolve("glColor4fv");
+    glad_glColor4fv(v);
+}
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    glad_glColor4i = (PFNGLCOLOR4IPROC)glad_lazy_resolve("glColor4i");
+    glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) {
+    glad_glColor4iv = (PFNGLCOLOR4IVPROC)glad_lazy_resolve("glColor4iv");
+    glad_glColor4iv(v);
+}
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    glad_glColor4s = (PFNGLCOLOR4SPROC)glad_lazy_resolve("glColor4s");
+    glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) {
+    glad_glColor4sv = (PFNGLCOLOR4SVPROC)glad_lazy_resolve("glColor4sv");
+    glad_glColor4sv(v);
+}
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    glad_glColor4ub = (PFNGLCOLOR4UBPROC)glad_lazy_resolve("glColor4ub");
+    glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) {
+    glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)glad_lazy_resolve("glColor4ubv");
+    glad_glColor4ubv(v);
+}
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    glad_glColor4ui = (PFNGLCOLOR4UIPROC)glad_lazy_resolve("glColor4ui");
+    glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) {
+    glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)glad_lazy_resolve("glColor4uiv");
+    glad_glColor4uiv(v);
+}
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    glad_glColor4us = (PFNGLCOLOR4USPROC)glad_lazy_resolve("glColor4us");
+    glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) {
+    glad_glColor4usv = (PFNGLCOLOR4USVPROC)glad_lazy_resolve("glColor4usv");
+    glad_glColor4usv(v);
+}
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) {
+    glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)glad_lazy_resolve("glEdgeFlag");
+    glad_glEdgeFlag(flag);
+}
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) {
+    glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)glad_lazy_resolve("glEdgeFlagv");
+    glad_glEdgeFlagv(flag);
+}
+static void APIENTRY glad_lazy_glEnd(void) {
+    glad_glEnd = (PFNGLENDPROC)glad_lazy_resolve("glEnd");
+    glad_glEnd();
+}
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) {
+    glad_glIndexd = (PFNGLINDEXDPROC)glad_lazy_resolve("glIndexd");
+    glad_glIndexd(c);
+}
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) {
+    glad_glIndexdv = (PFNGLINDEXDVPROC)glad_lazy_resolve("glIndexdv");
+    glad_glIndexdv(c);
+}
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) {
+    glad_glIndexf = (PFNGLINDEXFPROC)glad_lazy_resolve("glIndexf");
+    glad_glIndexf(c);
+}
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) {
+    glad_glIndexfv = (PFNGLINDEXFVPROC)glad_lazy_resolve("glIndexfv");
+    glad_glIndexfv(c);
+}
+static void APIENTRY glad_lazy_glIndexi(GLint c) {
+    glad_glIndexi = (PFNGLINDEXIPROC)glad_lazy_resolve("glIndexi");
+    glad_glIndexi(c);
+}
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) {
+    glad_glIndexiv = (PFNGLINDEXIVPROC)glad_lazy_resolve("glIndexiv");
+    glad_glIndexiv(c);
+}
+static void APIENTRY glad_lazy_glIndexs(GLshort c) {
+    glad_glIndexs = (PFNGLINDEXSPROC)glad_lazy_resolve("glIndexs");
+    glad_glIndexs(c);
+}
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) {
+    glad_glIndexsv = (PFNGLINDEXSVPROC)glad_lazy_resolve("glIndexsv");
+    glad_glIndexsv(c);
+}
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    glad_glNormal3b = (PFNGLNORMAL3BPROC)glad_lazy_resolve("glNormal3b");
+    glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) {
+    glad_glNormal3bv = (PFNGLNORMAL3BVPROC)glad_lazy_resolve("glNormal3bv");
+    glad_glNormal3bv(v);
+}
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    glad_glNormal3d = (PFNGLNORMAL3DPROC)glad_lazy_resolve("glNormal3d");
+    glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) {
+    glad_glNormal3dv = (PFNGLNORMAL3DVPROC)glad_lazy_resolve("glNormal3dv");
+    glad_glNormal3dv(v);
+}
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    glad_glNormal3f = (PFNGLNORMAL3FPROC)glad_lazy_resolve("glNormal3f");
+    glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) {
+    glad_glNormal3fv = (PFNGLNORMAL3FVPROC)glad_lazy_resolve("glNormal3fv");
+    glad_glNormal3fv(v);
+}
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+    glad_glNormal3i = (PFNGLNORMAL3IPROC)glad_lazy_resolve("glNormal3i");
+    glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) {
+    glad_glNormal3iv = (PFNGLNORMAL3IVPROC)glad_lazy_resolve("glNormal3iv");
+    glad_glNormal3iv(v);
+}
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+    glad_glNormal3s = (PFNGLNORMAL3SPROC)glad_lazy_resolve("glNormal3s");
+    glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) {
+    glad_glNormal3sv = (PFNGLNORMAL3SVPROC)glad_lazy_resolve("glNormal3sv");
+    glad_glNormal3sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+    glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)glad_lazy_resolve("glRasterPos2d");
+    glad_glRasterPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) {
+    glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)glad_lazy_resolve("glRasterPos2dv");
+    glad_glRasterPos2dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+    glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)glad_lazy_resolve("glRasterPos2f");
+    glad_glRasterPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) {
+    glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)glad_lazy_resolve("glRasterPos2fv");
+    glad_glRasterPos2fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) {
+    glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)glad_lazy_resolve("glRasterPos2i");
+    glad_glRasterPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) {
+    glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)glad_lazy_resolve("glRasterPos2iv");
+    glad_glRasterPos2iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) {
+    glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)glad_lazy_resolve("glRasterPos2s");
+    glad_glRasterPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) {
+    glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)glad_lazy_resolve("glRasterPos2sv");
+    glad_glRasterPos2sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)glad_lazy_resolve("glRasterPos3d");
+    glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) {
+    glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)glad_lazy_resolve("glRasterPos3dv");
+    glad_glRasterPos3dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)glad_lazy_resolve("glRasterPos3f");
+    glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) {
+    glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)glad_lazy_resolve("glRasterPos3fv");
+    glad_glRasterPos3fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+    glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)glad_lazy_resolve("glRasterPos3i");
+    glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) {
+    glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)glad_lazy_resolve("glRasterPos3iv");
+    glad_glRasterPos3iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+    glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)glad_lazy_resolve("glRasterPos3s");
+    glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) {
+    glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)glad_lazy_resolve("glRasterPos3sv");
+    glad_glRasterPos3sv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)glad_lazy_resolve("glRasterPos4d");
+    glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) {
+    glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)glad_lazy_resolve("glRasterPos4dv");
+    glad_glRasterPos4dv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)glad_lazy_resolve("glRasterPos4f");
+    glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) {
+    glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)glad_lazy_resolve("glRasterPos4fv");
+    glad_glRasterPos4fv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)glad_lazy_resolve("glRasterPos4i");
+    glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) {
+    glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)glad_lazy_resolve("glRasterPos4iv");
+    glad_glRasterPos4iv(v);
+}
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)glad_lazy_resolve("glRasterPos4s");
+    glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) {
+    glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)glad_lazy_resolve("glRasterPos4sv");
+    glad_glRasterPos4sv(v);
+}
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    glad_glRectd = (PFNGLRECTDPROC)glad_lazy_resolve("glRectd");
+    glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+    glad_glRectdv = (PFNGLRECTDVPROC)glad_lazy_resolve("glRectdv");
+    glad_glRectdv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    glad_glRectf = (PFNGLRECTFPROC)glad_lazy_resolve("glRectf");
+    glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+    glad_glRectfv = (PFNGLRECTFVPROC)glad_lazy_resolve("glRectfv");
+    glad_glRectfv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    glad_glRecti = (PFNGLRECTIPROC)glad_lazy_resolve("glRecti");
+    glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) {
+    glad_glRectiv = (PFNGLRECTIVPROC)glad_lazy_resolve("glRectiv");
+    glad_glRectiv(v1, v2);
+}
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    glad_glRects = (PFNGLRECTSPROC)glad_lazy_resolve("glRects");
+    glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+    glad_glRectsv = (PFNGLRECTSVPROC)glad_lazy_resolve("glRectsv");
+    glad_glRectsv(v1, v2);
+}
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) {
+    glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)glad_lazy_resolve("glTexCoord1d");
+    glad_glTexCoord1d(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) {
+    glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)glad_lazy_resolve("glTexCoord1dv");
+    glad_glTexCoord1dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) {
+    glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)glad_lazy_resolve("glTexCoord1f");
+    glad_glTexCoord1f(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) {
+    glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)glad_lazy_resolve("glTexCoord1fv");
+    glad_glTexCoord1fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) {
+    glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)glad_lazy_resolve("glTexCoord1i");
+    glad_glTexCoord1i(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) {
+    glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)glad_lazy_resolve("glTexCoord1iv");
+    glad_glTexCoord1iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) {
+    glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)glad_lazy_resolve("glTexCoord1s");
+    glad_glTexCoord1s(s);
+}
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) {
+    glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)glad_lazy_resolve("glTexCoord1sv");
+    glad_glTexCoord1sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+    glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)glad_lazy_resolve("glTexCoord2d");
+    glad_glTexCoord2d(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) {
+    glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)glad_lazy_resolve("glTexCoord2dv");
+    glad_glTexCoord2dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+    glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)glad_lazy_resolve("glTexCoord2f");
+    glad_glTexCoord2f(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) {
+    glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)glad_lazy_resolve("glTexCoord2fv");
+    glad_glTexCoord2fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) {
+    glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)glad_lazy_resolve("glTexCoord2i");
+    glad_glTexCoord2i(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) {
+    glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)glad_lazy_resolve("glTexCoord2iv");
+    glad_glTexCoord2iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) {
+    glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)glad_lazy_resolve("glTexCoord2s");
+    glad_glTexCoord2s(s, t);
+}
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) {
+    glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)glad_lazy_resolve("glTexCoord2sv");
+    glad_glTexCoord2sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)glad_lazy_resolve("glTexCoord3d");
+    glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) {
+    glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)glad_lazy_resolve("glTexCoord3dv");
+    glad_glTexCoord3dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)glad_lazy_resolve("glTexCoord3f");
+    glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) {
+    glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)glad_lazy_resolve("glTexCoord3fv");
+    glad_glTexCoord3fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+    glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)glad_lazy_resolve("glTexCoord3i");
+    glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) {
+    glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)glad_lazy_resolve("glTexCoord3iv");
+    glad_glTexCoord3iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+    glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)glad_lazy_resolve("glTexCoord3s");
+    glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) {
+    glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)glad_lazy_resolve("glTexCoord3sv");
+    glad_glTexCoord3sv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)glad_lazy_resolve("glTexCoord4d");
+    glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) {
+    glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)glad_lazy_resolve("glTexCoord4dv");
+    glad_glTexCoord4dv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)glad_lazy_resolve("glTexCoord4f");
+    glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) {
+    glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)glad_lazy_resolve("glTexCoord4fv");
+    glad_glTexCoord4fv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)glad_lazy_resolve("glTexCoord4i");
+    glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) {
+    glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)glad_lazy_resolve("glTexCoord4iv");
+    glad_glTexCoord4iv(v);
+}
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)glad_lazy_resolve("glTexCoord4s");
+    glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) {
+    glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)glad_lazy_resolve("glTexCoord4sv");
+    glad_glTexCoord4sv(v);
+}
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) {
+    glad_glVertex2d = (PFNGLVERTEX2DPROC)glad_lazy_resolve("glVertex2d");
+    glad_glVertex2d(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) {
+    glad_glVertex2dv = (PFNGLVERTEX2DVPROC)glad_lazy_resolve("glVertex2dv");
+    glad_glVertex2dv(v);
+}
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) {
+    glad_glVertex2f = (PFNGLVERTEX2FPROC)glad_lazy_resolve("glVertex2f");
+    glad_glVertex2f(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) {
+    glad_glVertex2fv = (PFNGLVERTEX2FVPROC)glad_lazy_resolve("glVertex2fv");
+    glad_glVertex2fv(v);
+}
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) {
+    glad_glVertex2i = (PFNGLVERTEX2IPROC)glad_lazy_resolve("glVertex2i");
+    glad_glVertex2i(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) {
+    glad_glVertex2iv = (PFNGLVERTEX2IVPROC)glad_lazy_resolve("glVertex2iv");
+    glad_glVertex2iv(v);
+}
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) {
+    glad_glVertex2s = (PFNGLVERTEX2SPROC)glad_lazy_resolve("glVertex2s");
+    glad_glVertex2s(x, y);
+}
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) {
+    glad_glVertex2sv = (PFNGLVERTEX2SVPROC)glad_lazy_resolve("glVertex2sv");
+    glad_glVertex2sv(v);
+}
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_glVertex3d = (PFNGLVERTEX3DPROC)glad_lazy_resolve("glVertex3d");
+    glad_glVertex3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) {
+    glad_glVertex3dv = (PFNGLVERTEX3DVPROC)glad_lazy_resolve("glVertex3dv");
+    glad_glVertex3dv(v);
+}
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_glVertex3f = (PFNGLVERTEX3FPROC)glad_lazy_resolve("glVertex3f");
+    glad_glVertex3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) {
+    glad_glVertex3fv = (PFNGLVERTEX3FVPROC)glad_lazy_resolve("glVertex3fv");
+    glad_glVertex3fv(v);
+}
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) {
+    glad_glVertex3i = (PFNGLVERTEX3IPROC)glad_lazy_resolve("glVertex3i");
+    glad_glVertex3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) {
+    glad_glVertex3iv = (PFNGLVERTEX3IVPROC)glad_lazy_resolve("glVertex3iv");
+    glad_glVertex3iv(v);
+}
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+    glad_glVertex3s = (PFNGLVERTEX3SPROC)glad_lazy_resolve("glVertex3s");
+    glad_glVertex3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) {
+    glad_glVertex3sv = (PFNGLVERTEX3SVPROC)glad_lazy_resolve("glVertex3sv");
+    glad_glVertex3sv(v);
+}
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glVertex4d = (PFNGLVERTEX4DPROC)glad_lazy_resolve("glVertex4d");
+    glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) {
+    glad_glVertex4dv = (PFNGLVERTEX4DVPROC)glad_lazy_resolve("glVertex4dv");
+    glad_glVertex4dv(v);
+}
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_glVertex4f = (PFNGLVERTEX4FPROC)glad_lazy_resolve("glVertex4f");
+    glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) {
+    glad_glVertex4fv = (PFNGLVERTEX4FVPROC)glad_lazy_resolve("glVertex4fv");
+    glad_glVertex4fv(v);
+}
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+    glad_glVertex4i = (PFNGLVERTEX4IPROC)glad_lazy_resolve("glVertex4i");
+    glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) {
+    glad_glVertex4iv = (PFNGLVERTEX4IVPROC)glad_lazy_resolve("glVertex4iv");
+    glad_glVertex4iv(v);
+}
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_glVertex4s = (PFNGLVERTEX4SPROC)glad_lazy_resolve("glVertex4s");
+    glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) {
+    glad_glVertex4sv = (PFNGLVERTEX4SVPROC)glad_lazy_resolve("glVertex4sv");
+    glad_glVertex4sv(v);
+}
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+    glad_glClipPlane = (PFNGLCLIPPLANEPROC)glad_lazy_resolve("glClipPlane");
+    glad_glClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) {
+    glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)glad_lazy_resolve("glColorMaterial");
+    glad_glColorMaterial(face, mode);
+}
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) {
+    glad_glFogf = (PFNGLFOGFPROC)glad_lazy_resolve("glFogf");
+    glad_glFogf(pname, param);
+}
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) {
+    glad_glFogfv = (PFNGLFOGFVPROC)glad_lazy_resolve("glFogfv");
+    glad_glFogfv(pname, params);
+}
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) {
+    glad_glFogi = (PFNGLFOGIPROC)glad_lazy_resolve("glFogi");
+    glad_glFogi(pname, param);
+}
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) {
+    glad_glFogiv = (PFNGLFOGIVPROC)glad_lazy_resolve("glFogiv");
+    glad_glFogiv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    glad_glLightf = (PFNGLLIGHTFPROC)glad_lazy_resolve("glLightf");
+    glad_glLightf(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    glad_glLightfv = (PFNGLLIGHTFVPROC)glad_lazy_resolve("glLightfv");
+    glad_glLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+    glad_glLighti = (PFNGLLIGHTIPROC)glad_lazy_resolve("glLighti");
+    glad_glLighti(light, pname, param);
+}
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+    glad_glLightiv = (PFNGLLIGHTIVPROC)glad_lazy_resolve("glLightiv");
+    glad_glLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) {
+    glad_glLightModelf = (PFNGLLIGHTMODELFPROC)glad_lazy_resolve("glLightModelf");
+    glad_glLightModelf(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+    glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)glad_lazy_resolve("glLightModelfv");
+    glad_glLightModelfv(pname, params);
+}
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) {
+    glad_glLightModeli = (PFNGLLIGHTMODELIPROC)glad_lazy_resolve("glLightModeli");
+    glad_glLightModeli(pname, param);
+}
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) {
+    glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)glad_lazy_resolve("glLightModeliv");
+    glad_glLightModeliv(pname, params);
+}
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) {
+    glad_glLineStipple = (PFNGLLINESTIPPLEPROC)glad_lazy_resolve("glLineStipple");
+    glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    glad_glMaterialf = (PFNGLMATERIALFPROC)glad_lazy_resolve("glMaterialf");
+    glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    glad_glMaterialfv = (PFNGLMATERIALFVPROC)glad_lazy_resolve("glMaterialfv");
+    glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+    glad_glMateriali = (PFNGLMATERIALIPROC)glad_lazy_resolve("glMateriali");
+    glad_glMateriali(face, pname, param);
+}
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+    glad_glMaterialiv = (PFNGLMATERIALIVPROC)glad_lazy_resolve("glMaterialiv");
+    glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) {
+    glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)glad_lazy_resolve("glPolygonStipple");
+    glad_glPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) {
+    glad_glShadeModel = (PFNGLSHADEMODELPROC)glad_lazy_resolve("glShadeModel");
+    glad_glShadeModel(mode);
+}
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    glad_glTexEnvf = (PFNGLTEXENVFPROC)glad_lazy_resolve("glTexEnvf");
+    glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    glad_glTexEnvfv = (PFNGLTEXENVFVPROC)glad_lazy_resolve("glTexEnvfv");
+    glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    glad_glTexEnvi = (PFNGLTEXENVIPROC)glad_lazy_resolve("glTexEnvi");
+    glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    glad_glTexEnviv = (PFNGLTEXENVIVPROC)glad_lazy_resolve("glTexEnviv");
+    glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+    glad_glTexGend = (PFNGLTEXGENDPROC)glad_lazy_resolve("glTexGend");
+    glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+    glad_glTexGendv = (PFNGLTEXGENDVPROC)glad_lazy_resolve("glTexGendv");
+    glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    glad_glTexGenf = (PFNGLTEXGENFPROC)glad_lazy_resolve("glTexGenf");
+    glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+    glad_glTexGenfv = (PFNGLTEXGENFVPROC)glad_lazy_resolve("glTexGenfv");
+    glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+    glad_glTexGeni = (PFNGLTEXGENIPROC)glad_lazy_resolve("glTexGeni");
+    glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+    glad_glTexGeniv = (PFNGLTEXGENIVPROC)glad_lazy_resolve("glTexGeniv");
+    glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+    glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)glad_lazy_resolve("glFeedbackBuffer");
+    glad_glFeedbackBuffer(size, type, buffer);
+}
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+    glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)glad_lazy_resolve("glSelectBuffer");
+    glad_glSelectBuffer(size, buffer);
+}
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) {
+    glad_glRenderMode = (PFNGLRENDERMODEPROC)glad_lazy_resolve("glRenderMode");
+    return glad_glRenderMode(mode);
+}
+static void APIENTRY glad_lazy_glInitNames(void) {
+    glad_glInitNames = (PFNGLINITNAMESPROC)glad_lazy_resolve("glInitNames");
+    glad_glInitNames();
+}
+static void APIENTRY glad_lazy_glLoadName(GLuint name) {
+    glad_glLoadName = (PFNGLLOADNAMEPROC)glad_lazy_resolve("glLoadName");
+    glad_glLoadName(name);
+}
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) {
+    glad_glPassThrough = (PFNGLPASSTHROUGHPROC)glad_lazy_resolve("glPassThrough");
+    glad_glPassThrough(token);
+}
+static void APIENTRY glad_lazy_glPopName(void) {
+    glad_glPopName = (PFNGLPOPNAMEPROC)glad_lazy_resolve("glPopName");
+    glad_glPopName();
+}
+static void APIENTRY glad_lazy_glPushName(GLuint name) {
+    glad_glPushName = (PFNGLPUSHNAMEPROC)glad_lazy_resolve("glPushName");
+    glad_glPushName(name);
+}
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glClearAccum = (PFNGLCLEARACCUMPROC)glad_lazy_resolve("glClearAccum");
+    glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) {
+    glad_glClearIndex = (PFNGLCLEARINDEXPROC)glad_lazy_resolve("glClearIndex");
+    glad_glClearIndex(c);
+}
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) {
+    glad_glIndexMask = (PFNGLINDEXMASKPROC)glad_lazy_resolve("glIndexMask");
+    glad_glIndexMask(mask);
+}
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) {
+    glad_glAccum = (PFNGLACCUMPROC)glad_lazy_resolve("glAccum");
+    glad_glAccum(op, value);
+}
+static void APIENTRY glad_lazy_glPopAttrib(void) {
+    glad_glPopAttrib = (PFNGLPOPATTRIBPROC)glad_lazy_resolve("glPopAttrib");
+    glad_glPopAttrib();
+}
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) {
+    glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)glad_lazy_resolve("glPushAttrib");
+    glad_glPushAttrib(mask);
+}
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+    glad_glMap1d = (PFNGLMAP1DPROC)glad_lazy_resolve("glMap1d");
+    glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+    glad_glMap1f = (PFNGLMAP1FPROC)glad_lazy_resolve("glMap1f");
+    glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+    glad_glMap2d = (PFNGLMAP2DPROC)glad_lazy_resolve("glMap2d");
+    glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+    glad_glMap2f = (PFNGLMAP2FPROC)glad_lazy_resolve("glMap2f");
+    glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)glad_lazy_resolve("glMapGrid1d");
+    glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)glad_lazy_resolve("glMapGrid1f");
+    glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)glad_lazy_resolve("glMapGrid2d");
+    glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)glad_lazy_resolve("glMapGrid2f");
+    glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) {
+    glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)glad_lazy_resolve("glEvalCoord1d");
+    glad_glEvalCoord1d(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) {
+    glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)glad_lazy_resolve("glEvalCoord1dv");
+    glad_glEvalCoord1dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) {
+    glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)glad_lazy_resolve("glEvalCoord1f");
+    glad_glEvalCoord1f(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) {
+    glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)glad_lazy_resolve("glEvalCoord1fv");
+    glad_glEvalCoord1fv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+    glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)glad_lazy_resolve("glEvalCoord2d");
+    glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) {
+    glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)glad_lazy_resolve("glEvalCoord2dv");
+    glad_glEvalCoord2dv(u);
+}
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+    glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)glad_lazy_resolve("glEvalCoord2f");
+    glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) {
+    glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)glad_lazy_resolve("glEvalCoord2fv");
+    glad_glEvalCoord2fv(u);
+}
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)glad_lazy_resolve("glEvalMesh1");
+    glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) {
+    glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)glad_lazy_resolve("glEvalPoint1");
+    glad_glEvalPoint1(i);
+}
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)glad_lazy_resolve("glEvalMesh2");
+    glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) {
+    glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)glad_lazy_resolve("glEvalPoint2");
+    glad_glEvalPoint2(i, j);
+}
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+    glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)glad_lazy_resolve("glAlphaFunc");
+    glad_glAlphaFunc(func, ref);
+}
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    glad_glPixelZoom = (PFNGLPIXELZOOMPROC)glad_lazy_resolve("glPixelZoom");
+    glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+    glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)glad_lazy_resolve("glPixelTransferf");
+    glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) {
+    glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)glad_lazy_resolve("glPixelTransferi");
+    glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+    glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)glad_lazy_resolve("glPixelMapfv");
+    glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+    glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)glad_lazy_resolve("glPixelMapuiv");
+    glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+    glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)glad_lazy_resolve("glPixelMapusv");
+    glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)glad_lazy_resolve("glCopyPixels");
+    glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)glad_lazy_resolve("glDrawPixels");
+    glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+    glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)glad_lazy_resolve("glGetClipPlane");
+    glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+    glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)glad_lazy_resolve("glGetLightfv");
+    glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+    glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)glad_lazy_resolve("glGetLightiv");
+    glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+    glad_glGetMapdv = (PFNGLGETMAPDVPROC)glad_lazy_resolve("glGetMapdv");
+    glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+    glad_glGetMapfv = (PFNGLGETMAPFVPROC)glad_lazy_resolve("glGetMapfv");
+    glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+    glad_glGetMapiv = (PFNGLGETMAPIVPROC)glad_lazy_resolve("glGetMapiv");
+    glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+    glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)glad_lazy_resolve("glGetMaterialfv");
+    glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+    glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)glad_lazy_resolve("glGetMaterialiv");
+    glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+    glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)glad_lazy_resolve("glGetPixelMapfv");
+    glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+    glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)glad_lazy_resolve("glGetPixelMapuiv");
+    glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+    glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)glad_lazy_resolve("glGetPixelMapusv");
+    glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) {
+    glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)glad_lazy_resolve("glGetPolygonStipple");
+    glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+    glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)glad_lazy_resolve("glGetTexEnvfv");
+    glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)glad_lazy_resolve("glGetTexEnviv");
+    glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+    glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)glad_lazy_resolve("glGetTexGendv");
+    glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+    glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)glad_lazy_resolve("glGetTexGenfv");
+    glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+    glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)glad_lazy_resolve("glGetTexGeniv");
+    glad_glGetTexGeniv(coord, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) {
+    glad_glIsList = (PFNGLISLISTPROC)glad_lazy_resolve("glIsList");
+    return glad_glIsList(list);
+}
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    glad_glFrustum = (PFNGLFRUSTUMPROC)glad_lazy_resolve("glFrustum");
+    glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glLoadIdentity(void) {
+    glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)glad_lazy_resolve("glLoadIdentity");
+    glad_glLoadIdentity();
+}
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) {
+    glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)glad_lazy_resolve("glLoadMatrixf");
+    glad_glLoadMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) {
+    glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)glad_lazy_resolve("glLoadMatrixd");
+    glad_glLoadMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) {
+    glad_glMatrixMode = (PFNGLMATRIXMODEPROC)glad_lazy_resolve("glMatrixMode");
+    glad_glMatrixMode(mode);
+}
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) {
+    glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)glad_lazy_resolve("glMultMatrixf");
+    glad_glMultMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) {
+    glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)glad_lazy_resolve("glMultMatrixd");
+    glad_glMultMatrixd(m);
+}
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    glad_glOrtho = (PFNGLORTHOPROC)glad_lazy_resolve("glOrtho");
+    glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY glad_lazy_glPopMatrix(void) {
+    glad_glPopMatrix = (PFNGLPOPMATRIXPROC)glad_lazy_resolve("glPopMatrix");
+    glad_glPopMatrix();
+}
+static void APIENTRY glad_lazy_glPushMatrix(void) {
+    glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)glad_lazy_resolve("glPushMatrix");
+    glad_glPushMatrix();
+}
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glRotated = (PFNGLROTATEDPROC)glad_lazy_resolve("glRotated");
+    glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    glad_glRotatef = (PFNGLROTATEFPROC)glad_lazy_resolve("glRotatef");
+    glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+    glad_glScaled = (PFNGLSCALEDPROC)glad_lazy_resolve("glScaled");
+    glad_glScaled(x, y, z);
+}
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+    glad_glScalef = (PFNGLSCALEFPROC)glad_lazy_resolve("glScalef");
+    glad_glScalef(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+    glad_glTranslated = (PFNGLTRANSLATEDPROC)glad_lazy_resolve("glTranslated");
+    glad_glTranslated(x, y, z);
+}
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+    glad_glTranslatef = (PFNGLTRANSLATEFPROC)glad_lazy_resolve("glTranslatef");
+    glad_glTranslatef(x, y, z);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays");
+    glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements");
+    glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+    glad_glGetPointerv = (PFNGLGETPOINTERVPROC)glad_lazy_resolve("glGetPointerv");
+    glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+    glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset");
+    glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D");
+    glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D");
+    glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D");
+    glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D");
+    glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D");
+    glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D");
+    glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+    glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture");
+    glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures");
+    glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+    glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures");
+    glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+    glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture");
+    return glad_glIsTexture(texture);
+}
+static void APIENTRY glad_lazy_glArrayElement(GLint i) {
+    glad_glArrayElement = (PFNGLARRAYELEMENTPROC)glad_lazy_resolve("glArrayElement");
+    glad_glArrayElement(i);
+}
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glColorPointer = (PFNGLCOLORPOINTERPROC)glad_lazy_resolve("glColorPointer");
+    glad_glColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) {
+    glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)glad_lazy_resolve("glDisableClientState");
+    glad_glDisableClientState(array);
+}
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+    glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)glad_lazy_resolve("glEdgeFlagPointer");
+    glad_glEdgeFlagPointer(stride, pointer);
+}
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) {
+    glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)glad_lazy_resolve("glEnableClientState");
+    glad_glEnableClientState(array);
+}
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)glad_lazy_resolve("glIndexPointer");
+    glad_glIndexPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+    glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)glad_lazy_resolve("glInterleavedArrays");
+    glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)glad_lazy_resolve("glNormalPointer");
+    glad_glNormalPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)glad_lazy_resolve("glTexCoordPointer");
+    glad_glTexCoordPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)glad_lazy_resolve("glVertexPointer");
+    glad_glVertexPointer(size, type, stride, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+    glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)glad_lazy_resolve("glAreTexturesResident");
+    return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+    glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)glad_lazy_resolve("glPrioritizeTextures");
+    glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) {
+    glad_glIndexub = (PFNGLINDEXUBPROC)glad_lazy_resolve("glIndexub");
+    glad_glIndexub(c);
+}
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) {
+    glad_glIndexubv = (PFNGLINDEXUBVPROC)glad_lazy_resolve("glIndexubv");
+    glad_glIndexubv(c);
+}
+static void APIENTRY glad_lazy_glPopClientAttrib(void) {
+    glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)glad_lazy_resolve("glPopClientAttrib");
+    glad_glPopClientAttrib();
+}
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) {
+    glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)glad_lazy_resolve("glPushClientAttrib");
+    glad_glPushClientAttrib(mask);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements");
+    glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D");
+    glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D");
+    glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D");
+    glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+    glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture");
+    glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+    glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage");
+    glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D");
+    glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D");
+    glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D");
+    glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D");
+    glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D");
+    glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D");
+    glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage");
+    glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) {
+    glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)glad_lazy_resolve("glClientActiveTexture");
+    glad_glClientActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+    glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)glad_lazy_resolve("glMultiTexCoord1d");
+    glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+    glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)glad_lazy_resolve("glMultiTexCoord1dv");
+    glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+    glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)glad_lazy_resolve("glMultiTexCoord1f");
+    glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+    glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)glad_lazy_resolve("glMultiTexCoord1fv");
+    glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+    glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)glad_lazy_resolve("glMultiTexCoord1i");
+    glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+    glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)glad_lazy_resolve("glMultiTexCoord1iv");
+    glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+    glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)glad_lazy_resolve("glMultiTexCoord1s");
+    glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+    glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)glad_lazy_resolve("glMultiTexCoord1sv");
+    glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)glad_lazy_resolve("glMultiTexCoord2d");
+    glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+    glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)glad_lazy_resolve("glMultiTexCoord2dv");
+    glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)glad_lazy_resolve("glMultiTexCoord2f");
+    glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+    glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)glad_lazy_resolve("glMultiTexCoord2fv");
+    glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)glad_lazy_resolve("glMultiTexCoord2i");
+    glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+    glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)glad_lazy_resolve("glMultiTexCoord2iv");
+    glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)glad_lazy_resolve("glMultiTexCoord2s");
+    glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+    glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)glad_lazy_resolve("glMultiTexCoord2sv");
+    glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)glad_lazy_resolve("glMultiTexCoord3d");
+    glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+    glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)glad_lazy_resolve("glMultiTexCoord3dv");
+    glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)glad_lazy_resolve("glMultiTexCoord3f");
+    glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+    glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)glad_lazy_resolve("glMultiTexCoord3fv");
+    glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)glad_lazy_resolve("glMultiTexCoord3i");
+    glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+    glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)glad_lazy_resolve("glMultiTexCoord3iv");
+    glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)glad_lazy_resolve("glMultiTexCoord3s");
+    glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+    glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)glad_lazy_resolve("glMultiTexCoord3sv");
+    glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)glad_lazy_resolve("glMultiTexCoord4d");
+    glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+    glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)glad_lazy_resolve("glMultiTexCoord4dv");
+    glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)glad_lazy_resolve("glMultiTexCoord4f");
+    glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+    glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)glad_lazy_resolve("glMultiTexCoord4fv");
+    glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)glad_lazy_resolve("glMultiTexCoord4i");
+    glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+    glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)glad_lazy_resolve("glMultiTexCoord4iv");
+    glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)glad_lazy_resolve("glMultiTexCoord4s");
+    glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+    glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)glad_lazy_resolve("glMultiTexCoord4sv");
+    glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+    glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glLoadTransposeMatrixf");
+    glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+    glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glLoadTransposeMatrixd");
+    glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) {
+    glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)glad_lazy_resolve("glMultTransposeMatrixf");
+    glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) {
+    glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)glad_lazy_resolve("glMultTransposeMatrixd");
+    glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate");
+    glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays");
+    glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements");
+    glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+    glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf");
+    glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv");
+    glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+    glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri");
+    glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+    glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv");
+    glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) {
+    glad_glFogCoordf = (PFNGLFOGCOORDFPROC)glad_lazy_resolve("glFogCoordf");
+    glad_glFogCoordf(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) {
+    glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)glad_lazy_resolve("glFogCoordfv");
+    glad_glFogCoordfv(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) {
+    glad_glFogCoordd = (PFNGLFOGCOORDDPROC)glad_lazy_resolve("glFogCoordd");
+    glad_glFogCoordd(coord);
+}
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) {
+    glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)glad_lazy_resolve("glFogCoorddv");
+    glad_glFogCoorddv(coord);
+}
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+    glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)glad_lazy_resolve("glFogCoordPointer");
+    glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)glad_lazy_resolve("glSecondaryColor3b");
+    glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) {
+    glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)glad_lazy_resolve("glSecondaryColor3bv");
+    glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)glad_lazy_resolve("glSecondaryColor3d");
+    glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) {
+    glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)glad_lazy_resolve("glSecondaryColor3dv");
+    glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)glad_lazy_resolve("glSecondaryColor3f");
+    glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) {
+    glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)glad_lazy_resolve("glSecondaryColor3fv");
+    glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+    glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)glad_lazy_resolve("glSecondaryColor3i");
+    glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) {
+    glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)glad_lazy_resolve("glSecondaryColor3iv");
+    glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)glad_lazy_resolve("glSecondaryColor3s");
+    glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) {
+    glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)glad_lazy_resolve("glSecondaryColor3sv");
+    glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)glad_lazy_resolve("glSecondaryColor3ub");
+    glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) {
+    glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)glad_lazy_resolve("glSecondaryColor3ubv");
+    glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)glad_lazy_resolve("glSecondaryColor3ui");
+    glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) {
+    glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)glad_lazy_resolve("glSecondaryColor3uiv");
+    glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)glad_lazy_resolve("glSecondaryColor3us");
+    glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) {
+    glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)glad_lazy_resolve("glSecondaryColor3usv");
+    glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)glad_lazy_resolve("glSecondaryColorPointer");
+    glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+    glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)glad_lazy_resolve("glWindowPos2d");
+    glad_glWindowPos2d(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) {
+    glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)glad_lazy_resolve("glWindowPos2dv");
+    glad_glWindowPos2dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+    glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)glad_lazy_resolve("glWindowPos2f");
+    glad_glWindowPos2f(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) {
+    glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)glad_lazy_resolve("glWindowPos2fv");
+    glad_glWindowPos2fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) {
+    glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)glad_lazy_resolve("glWindowPos2i");
+    glad_glWindowPos2i(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) {
+    glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)glad_lazy_resolve("glWindowPos2iv");
+    glad_glWindowPos2iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) {
+    glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)glad_lazy_resolve("glWindowPos2s");
+    glad_glWindowPos2s(x, y);
+}
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) {
+    glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)glad_lazy_resolve("glWindowPos2sv");
+    glad_glWindowPos2sv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)glad_lazy_resolve("glWindowPos3d");
+    glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) {
+    glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)glad_lazy_resolve("glWindowPos3dv");
+    glad_glWindowPos3dv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)glad_lazy_resolve("glWindowPos3f");
+    glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) {
+    glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)glad_lazy_resolve("glWindowPos3fv");
+    glad_glWindowPos3fv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+    glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)glad_lazy_resolve("glWindowPos3i");
+    glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) {
+    glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)glad_lazy_resolve("glWindowPos3iv");
+    glad_glWindowPos3iv(v);
+}
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+    glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)glad_lazy_resolve("glWindowPos3s");
+    glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) {
+    glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)glad_lazy_resolve("glWindowPos3sv");
+    glad_glWindowPos3sv(v);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor");
+    glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+    glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation");
+    glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+    glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries");
+    glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries");
+    glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+    glad_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery");
+    return glad_glIsQuery(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+    glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery");
+    glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+    glad_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery");
+    glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv");
+    glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv");
+    glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv");
+    glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+    glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer");
+    glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers");
+    glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+    glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers");
+    glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+    glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer");
+    return glad_glIsBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData");
+    glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData");
+    glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData");
+    glad_glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+    glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer");
+    return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+    glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer");
+    return glad_glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv");
+    glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv");
+    glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate");
+    glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers");
+    glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate");
+    glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate");
+    glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate");
+    glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+    glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader");
+    glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation");
+    glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+    glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader");
+    glad_glCompileShader(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+    glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram");
+    return glad_glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+    glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader");
+    return glad_glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+    glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram");
+    glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+    glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader");
+    glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+    glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader");
+    glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+    glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray");
+    glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+    glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray");
+    glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib");
+    glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform");
+    glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders");
+    glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+    glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation");
+    return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv");
+    glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog");
+    glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv");
+    glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog");
+    glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource");
+    glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+    glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation");
+    return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv");
+    glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv");
+    glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv");
+    glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv");
+    glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv");
+    glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv");
+    glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+    glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram");
+    return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+    glad_glIsShader = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader");
+    return glad_glIsShader(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+    glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram");
+    glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource");
+    glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+    glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram");
+    glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+    glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f");
+    glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f");
+    glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f");
+    glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f");
+    glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+    glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i");
+    glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+    glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i");
+    glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i");
+    glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i");
+    glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv");
+    glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv");
+    glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv");
+    glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv");
+    glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv");
+    glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv");
+    glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv");
+    glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv");
+    glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv");
+    glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv");
+    glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv");
+    glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+    glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram");
+    glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+    glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d");
+    glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv");
+    glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+    glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f");
+    glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv");
+    glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+    glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s");
+    glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv");
+    glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d");
+    glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv");
+    glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f");
+    glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv");
+    glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s");
+    glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv");
+    glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d");
+    glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv");
+    glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f");
+    glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv");
+    glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s");
+    glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv");
+    glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv");
+    glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv");
+    glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv");
+    glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub");
+    glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv");
+    glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv");
+    glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv");
+    glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv");
+    glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d");
+    glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv");
+    glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f");
+    glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv");
+    glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv");
+    glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s");
+    glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv");
+    glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv");
+    glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv");
+    glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv");
+    glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer");
+    glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv");
+    glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv");
+    glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv");
+    glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv");
+    glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv");
+    glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv");
+    glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski");
+    glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v");
+    glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v");
+    glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+    glad_glEnablei = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei");
+    glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+    glad_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei");
+    glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+    glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi");
+    return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+    glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback");
+    glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+    glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback");
+    glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange");
+    glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase");
+    glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings");
+    glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying");
+    glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+    glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor");
+    glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+    glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender");
+    glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+    glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender");
+    glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer");
+    glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv");
+    glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv");
+    glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+    glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i");
+    glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i");
+    glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i");
+    glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i");
+    glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+    glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui");
+    glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui");
+    glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui");
+    glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui");
+    glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv");
+    glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv");
+    glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv");
+    glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv");
+    glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv");
+    glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv");
+    glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv");
+    glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv");
+    glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv");
+    glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv");
+    glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv");
+    glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv");
+    glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv");
+    glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation");
+    glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation");
+    return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+    glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui");
+    glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui");
+    glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui");
+    glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui");
+    glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv");
+    glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv");
+    glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv");
+    glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv");
+    glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv");
+    glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv");
+    glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv");
+    glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv");
+    glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv");
+    glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv");
+    glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv");
+    glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi");
+    glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+    glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi");
+    return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+    glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer");
+    return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer");
+    glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers");
+    glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers");
+    glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage");
+    glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv");
+    glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+    glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer");
+    return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer");
+    glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers");
+    glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers");
+    glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+    glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus");
+    return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D");
+    glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D");
+    glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D");
+    glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer");
+    glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv");
+    glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+    glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap");
+    glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer");
+    glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample");
+    glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer");
+    glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange");
+    return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange");
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+    glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray");
+    glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays");
+    glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays");
+    glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+    glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray");
+    return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced");
+    glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced");
+    glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer");
+    glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+    glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex");
+    glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData");
+    glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices");
+    glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv");
+    glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName");
+    glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex");
+    return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv");
+    glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName");
+    glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding");
+    glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex");
+    glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex");
+    glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex");
+    glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex");
+    glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+    glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex");
+    glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+    glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync");
+    return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+    glad_glIsSync = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync");
+    return glad_glIsSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+    glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync");
+    glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync");
+    return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync");
+    glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+    glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v");
+    glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv");
+    glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v");
+    glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v");
+    glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture");
+    glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample");
+    glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample");
+    glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv");
+    glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski");
+    glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed");
+    glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex");
+    return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+    glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers");
+    glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers");
+    glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+    glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler");
+    return glad_glIsSampler(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+    glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler");
+    glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri");
+    glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv");
+    glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf");
+    glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv");
+    glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv");
+    glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv");
+    glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv");
+    glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv");
+    glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv");
+    glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv");
+    glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+    glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter");
+    glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v");
+    glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v");
+    glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor");
+    glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui");
+    glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv");
+    glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui");
+    glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv");
+    glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui");
+    glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv");
+    glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui");
+    glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv");
+    glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+    glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui");
+    glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+    glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv");
+    glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+    glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui");
+    glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+    glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv");
+    glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+    glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui");
+    glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+    glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv");
+    glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+    glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui");
+    glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv");
+    glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+    glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui");
+    glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv");
+    glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+    glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui");
+    glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv");
+    glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+    glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui");
+    glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv");
+    glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui");
+    glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv");
+    glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui");
+    glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv");
+    glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui");
+    glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv");
+    glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui");
+    glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv");
+    glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+    glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui");
+    glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv");
+    glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+    glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui");
+    glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+    glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv");
+    glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+    glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui");
+    glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+    glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv");
+    glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui");
+    glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv");
+    glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) {
+    glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glad_lazy_resolve("glMinSampleShading");
+    glad_glMinSampleShading(value);
+}
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+    glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glad_lazy_resolve("glBlendEquationi");
+    glad_glBlendEquationi(buf, mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glad_lazy_resolve("glBlendEquationSeparatei");
+    glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)glad_lazy_resolve("glBlendFunci");
+    glad_glBlendFunci(buf, src, dst);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glad_lazy_resolve("glBlendFuncSeparatei");
+    glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glDrawArraysIndirect");
+    glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glDrawElementsIndirect");
+    glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) {
+    glad_glUniform1d = (PFNGLUNIFORM1DPROC)glad_lazy_resolve("glUniform1d");
+    glad_glUniform1d(location, x);
+}
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    glad_glUniform2d = (PFNGLUNIFORM2DPROC)glad_lazy_resolve("glUniform2d");
+    glad_glUniform2d(location, x, y);
+}
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glUniform3d = (PFNGLUNIFORM3DPROC)glad_lazy_resolve("glUniform3d");
+    glad_glUniform3d(location, x, y, z);
+}
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glUniform4d = (PFNGLUNIFORM4DPROC)glad_lazy_resolve("glUniform4d");
+    glad_glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)glad_lazy_resolve("glUniform1dv");
+    glad_glUniform1dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)glad_lazy_resolve("glUniform2dv");
+    glad_glUniform2dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)glad_lazy_resolve("glUniform3dv");
+    glad_glUniform3dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)glad_lazy_resolve("glUniform4dv");
+    glad_glUniform4dv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glad_lazy_resolve("glUniformMatrix2dv");
+    glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glad_lazy_resolve("glUniformMatrix3dv");
+    glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glad_lazy_resolve("glUniformMatrix4dv");
+    glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glad_lazy_resolve("glUniformMatrix2x3dv");
+    glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glad_lazy_resolve("glUniformMatrix2x4dv");
+    glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glad_lazy_resolve("glUniformMatrix3x2dv");
+    glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glad_lazy_resolve("glUniformMatrix3x4dv");
+    glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glad_lazy_resolve("glUniformMatrix4x2dv");
+    glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glad_lazy_resolve("glUniformMatrix4x3dv");
+    glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glad_lazy_resolve("glGetUniformdv");
+    glad_glGetUniformdv(program, location, params);
+}
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetSubroutineUniformLocation");
+    return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glad_lazy_resolve("glGetSubroutineIndex");
+    return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_lazy_resolve("glGetActiveSubroutineUniformiv");
+    glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveSubroutineUniformName");
+    glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glad_lazy_resolve("glGetActiveSubroutineName");
+    glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glad_lazy_resolve("glUniformSubroutinesuiv");
+    glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_lazy_resolve("glGetUniformSubroutineuiv");
+    glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glad_lazy_resolve("glGetProgramStageiv");
+    glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) {
+    glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glad_lazy_resolve("glPatchParameteri");
+    glad_glPatchParameteri(pname, value);
+}
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glad_lazy_resolve("glPatchParameterfv");
+    glad_glPatchParameterfv(pname, values);
+}
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+    glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBindTransformFeedback");
+    glad_glBindTransformFeedback(target, id);
+}
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_lazy_resolve("glDeleteTransformFeedbacks");
+    glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glad_lazy_resolve("glGenTransformFeedbacks");
+    glad_glGenTransformFeedbacks(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) {
+    glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glIsTransformFeedback");
+    return glad_glIsTransformFeedback(id);
+}
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+    glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_lazy_resolve("glPauseTransformFeedback");
+    glad_glPauseTransformFeedback();
+}
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+    glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_lazy_resolve("glResumeTransformFeedback");
+    glad_glResumeTransformFeedback();
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glDrawTransformFeedback");
+    glad_glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_lazy_resolve("glDrawTransformFeedbackStream");
+    glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glad_lazy_resolve("glBeginQueryIndexed");
+    glad_glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+    glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glad_lazy_resolve("glEndQueryIndexed");
+    glad_glEndQueryIndexed(target, index);
+}
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glad_lazy_resolve("glGetQueryIndexediv");
+    glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+    glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glad_lazy_resolve("glReleaseShaderCompiler");
+    glad_glReleaseShaderCompiler();
+}
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    glad_glShaderBinary = (PFNGLSHADERBINARYPROC)glad_lazy_resolve("glShaderBinary");
+    glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glad_lazy_resolve("glGetShaderPrecisionFormat");
+    glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) {
+    glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)glad_lazy_resolve("glDepthRangef");
+    glad_glDepthRangef(n, f);
+}
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) {
+    glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)glad_lazy_resolve("glClearDepthf");
+    glad_glClearDepthf(d);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_resolve("glGetProgramBinary");
+    glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)glad_lazy_resolve("glProgramBinary");
+    glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_resolve("glProgramParameteri");
+    glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glad_lazy_resolve("glUseProgramStages");
+    glad_glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glad_lazy_resolve("glActiveShaderProgram");
+    glad_glActiveShaderProgram(pipeline, program);
+}
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glad_lazy_resolve("glCreateShaderProgramv");
+    return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) {
+    glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glad_lazy_resolve("glBindProgramPipeline");
+    glad_glBindProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glad_lazy_resolve("glDeleteProgramPipelines");
+    glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glad_lazy_resolve("glGenProgramPipelines");
+    glad_glGenProgramPipelines(n, pipelines);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) {
+    glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glad_lazy_resolve("glIsProgramPipeline");
+    return glad_glIsProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glad_lazy_resolve("glGetProgramPipelineiv");
+    glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glad_lazy_resolve("glProgramUniform1i");
+    glad_glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glad_lazy_resolve("glProgramUniform1iv");
+    glad_glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glad_lazy_resolve("glProgramUniform1f");
+    glad_glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glad_lazy_resolve("glProgramUniform1fv");
+    glad_glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glad_lazy_resolve("glProgramUniform1d");
+    glad_glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glad_lazy_resolve("glProgramUniform1dv");
+    glad_glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glad_lazy_resolve("glProgramUniform1ui");
+    glad_glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glad_lazy_resolve("glProgramUniform1uiv");
+    glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glad_lazy_resolve("glProgramUniform2i");
+    glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glad_lazy_resolve("glProgramUniform2iv");
+    glad_glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glad_lazy_resolve("glProgramUniform2f");
+    glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glad_lazy_resolve("glProgramUniform2fv");
+    glad_glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glad_lazy_resolve("glProgramUniform2d");
+    glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glad_lazy_resolve("glProgramUniform2dv");
+    glad_glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glad_lazy_resolve("glProgramUniform2ui");
+    glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glad_lazy_resolve("glProgramUniform2uiv");
+    glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glad_lazy_resolve("glProgramUniform3i");
+    glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glad_lazy_resolve("glProgramUniform3iv");
+    glad_glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glad_lazy_resolve("glProgramUniform3f");
+    glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glad_lazy_resolve("glProgramUniform3fv");
+    glad_glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glad_lazy_resolve("glProgramUniform3d");
+    glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glad_lazy_resolve("glProgramUniform3dv");
+    glad_glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glad_lazy_resolve("glProgramUniform3ui");
+    glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glad_lazy_resolve("glProgramUniform3uiv");
+    glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glad_lazy_resolve("glProgramUniform4i");
+    glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glad_lazy_resolve("glProgramUniform4iv");
+    glad_glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glad_lazy_resolve("glProgramUniform4f");
+    glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glad_lazy_resolve("glProgramUniform4fv");
+    glad_glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glad_lazy_resolve("glProgramUniform4d");
+    glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glad_lazy_resolve("glProgramUniform4dv");
+    glad_glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glad_lazy_resolve("glProgramUniform4ui");
+    glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glad_lazy_resolve("glProgramUniform4uiv");
+    glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glProgramUniformMatrix2fv");
+    glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glProgramUniformMatrix3fv");
+    glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glProgramUniformMatrix4fv");
+    glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_lazy_resolve("glProgramUniformMatrix2dv");
+    glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_lazy_resolve("glProgramUniformMatrix3dv");
+    glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_lazy_resolve("glProgramUniformMatrix4dv");
+    glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glProgramUniformMatrix2x3fv");
+    glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glProgramUniformMatrix3x2fv");
+    glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glProgramUniformMatrix2x4fv");
+    glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glProgramUniformMatrix4x2fv");
+    glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glProgramUniformMatrix3x4fv");
+    glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glProgramUniformMatrix4x3fv");
+    glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_lazy_resolve("glProgramUniformMatrix2x3dv");
+    glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_lazy_resolve("glProgramUniformMatrix3x2dv");
+    glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_lazy_resolve("glProgramUniformMatrix2x4dv");
+    glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_lazy_resolve("glProgramUniformMatrix4x2dv");
+    glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_lazy_resolve("glProgramUniformMatrix3x4dv");
+    glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_lazy_resolve("glProgramUniformMatrix4x3dv");
+    glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) {
+    glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_lazy_resolve("glValidateProgramPipeline");
+    glad_glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_lazy_resolve("glGetProgramPipelineInfoLog");
+    glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+    glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glad_lazy_resolve("glVertexAttribL1d");
+    glad_glVertexAttribL1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glad_lazy_resolve("glVertexAttribL2d");
+    glad_glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glad_lazy_resolve("glVertexAttribL3d");
+    glad_glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glad_lazy_resolve("glVertexAttribL4d");
+    glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glad_lazy_resolve("glVertexAttribL1dv");
+    glad_glVertexAttribL1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glad_lazy_resolve("glVertexAttribL2dv");
+    glad_glVertexAttribL2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glad_lazy_resolve("glVertexAttribL3dv");
+    glad_glVertexAttribL3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glad_lazy_resolve("glVertexAttribL4dv");
+    glad_glVertexAttribL4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glad_lazy_resolve("glVertexAttribLPointer");
+    glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glad_lazy_resolve("glGetVertexAttribLdv");
+    glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glad_lazy_resolve("glViewportArrayv");
+    glad_glViewportArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glad_lazy_resolve("glViewportIndexedf");
+    glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glad_lazy_resolve("glViewportIndexedfv");
+    glad_glViewportIndexedfv(index, v);
+}
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glad_lazy_resolve("glScissorArrayv");
+    glad_glScissorArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glad_lazy_resolve("glScissorIndexed");
+    glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+    glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glad_lazy_resolve("glScissorIndexedv");
+    glad_glScissorIndexedv(index, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glad_lazy_resolve("glDepthRangeArrayv");
+    glad_glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glad_lazy_resolve("glDepthRangeIndexed");
+    glad_glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)glad_lazy_resolve("glGetFloati_v");
+    glad_glGetFloati_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glad_lazy_resolve("glGetDoublei_v");
+    glad_glGetDoublei_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve("glDrawArraysInstancedBaseInstance");
+    glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve("glDrawElementsInstancedBaseInstance");
+    glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertexBaseInstance");
+    glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glad_lazy_resolve("glGetInternalformativ");
+    glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_lazy_resolve("glGetActiveAtomicCounterBufferiv");
+    glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glad_lazy_resolve("glBindImageTexture");
+    glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) {
+    glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glad_lazy_resolve("glMemoryBarrier");
+    glad_glMemoryBarrier(barriers);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glad_lazy_resolve("glTexStorage1D");
+    glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glad_lazy_resolve("glTexStorage2D");
+    glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glad_lazy_resolve("glTexStorage3D");
+    glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_lazy_resolve("glDrawTransformFeedbackInstanced");
+    glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_lazy_resolve("glDrawTransformFeedbackStreamInstanced");
+    glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glad_lazy_resolve("glClearBufferData");
+    glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glad_lazy_resolve("glClearBufferSubData");
+    glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glad_lazy_resolve("glDispatchCompute");
+    glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) {
+    glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_lazy_resolve("glDispatchComputeIndirect");
+    glad_glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glad_lazy_resolve("glCopyImageSubData");
+    glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glad_lazy_resolve("glFramebufferParameteri");
+    glad_glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferParameteriv");
+    glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+    glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glad_lazy_resolve("glGetInternalformati64v");
+    glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_resolve("glInvalidateTexSubImage");
+    glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+    glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_resolve("glInvalidateTexImage");
+    glad_glInvalidateTexImage(texture, level);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_resolve("glInvalidateBufferSubData");
+    glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+    glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_resolve("glInvalidateBufferData");
+    glad_glInvalidateBufferData(buffer);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_resolve("glInvalidateFramebuffer");
+    glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_resolve("glInvalidateSubFramebuffer");
+    glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_resolve("glMultiDrawArraysIndirect");
+    glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve("glMultiDrawElementsIndirect");
+    glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glad_lazy_resolve("glGetProgramInterfaceiv");
+    glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_lazy_resolve("glGetProgramResourceIndex");
+    return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glad_lazy_resolve("glGetProgramResourceName");
+    glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glad_lazy_resolve("glGetProgramResourceiv");
+    glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_lazy_resolve("glGetProgramResourceLocation");
+    return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_lazy_resolve("glGetProgramResourceLocationIndex");
+    return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_lazy_resolve("glShaderStorageBlockBinding");
+    glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glad_lazy_resolve("glTexBufferRange");
+    glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexStorage2DMultisample");
+    glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexStorage3DMultisample");
+    glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    glad_glTextureView = (PFNGLTEXTUREVIEWPROC)glad_lazy_resolve("glTextureView");
+    glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glad_lazy_resolve("glBindVertexBuffer");
+    glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glad_lazy_resolve("glVertexAttribFormat");
+    glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glad_lazy_resolve("glVertexAttribIFormat");
+    glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glad_lazy_resolve("glVertexAttribLFormat");
+    glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glad_lazy_resolve("glVertexAttribBinding");
+    glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glad_lazy_resolve("glVertexBindingDivisor");
+    glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_resolve("glDebugMessageControl");
+    glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_resolve("glDebugMessageInsert");
+    glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_resolve("glDebugMessageCallback");
+    glad_glDebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_resolve("glGetDebugMessageLog");
+    return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glad_lazy_resolve("glPushDebugGroup");
+    glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+    glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glad_lazy_resolve("glPopDebugGroup");
+    glad_glPopDebugGroup();
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    glad_glObjectLabel = (PFNGLOBJECTLABELPROC)glad_lazy_resolve("glObjectLabel");
+    glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glad_lazy_resolve("glGetObjectLabel");
+    glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glad_lazy_resolve("glObjectPtrLabel");
+    glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glad_lazy_resolve("glGetObjectPtrLabel");
+    glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glad_lazy_resolve("glBufferStorage");
+    glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)glad_lazy_resolve("glClearTexImage");
+    glad_glClearTexImage(texture, level, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)glad_lazy_resolve("glClearTexSubImage");
+    glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY glad_lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)glad_lazy_resolve("glBindBuffersBase");
+    glad_glBindBuffersBase(target, first, count, buffers);
+}
+static void APIENTRY glad_lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+    glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)glad_lazy_resolve("glBindBuffersRange");
+    glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY glad_lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    glad_glBindTextures = (PFNGLBINDTEXTURESPROC)glad_lazy_resolve("glBindTextures");
+    glad_glBindTextures(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+    glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)glad_lazy_resolve("glBindSamplers");
+    glad_glBindSamplers(first, count, samplers);
+}
+static void APIENTRY glad_lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)glad_lazy_resolve("glBindImageTextures");
+    glad_glBindImageTextures(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)glad_lazy_resolve("glBindVertexBuffers");
+    glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glClipControl(GLenum origin, GLenum depth) {
+    glad_glClipControl = (PFNGLCLIPCONTROLPROC)glad_lazy_resolve("glClipControl");
+    glad_glClipControl(origin, depth);
+}
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+    glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_lazy_resolve("glCreateTransformFeedbacks");
+    glad_glCreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_lazy_resolve("glTransformFeedbackBufferBase");
+    glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_lazy_resolve("glTransformFeedbackBufferRange");
+    glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+    glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_lazy_resolve("glGetTransformFeedbackiv");
+    glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+    glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_lazy_resolve("glGetTransformFeedbacki_v");
+    glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+    glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_lazy_resolve("glGetTransformFeedbacki64_v");
+    glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+    glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glad_lazy_resolve("glCreateBuffers");
+    glad_glCreateBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_resolve("glNamedBufferStorage");
+    glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glad_lazy_resolve("glNamedBufferData");
+    glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glNamedBufferSubData");
+    glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyNamedBufferSubData");
+    glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glad_lazy_resolve("glClearNamedBufferData");
+    glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glClearNamedBufferSubData");
+    glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void * APIENTRY glad_lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glad_lazy_resolve("glMapNamedBuffer");
+    return glad_glMapNamedBuffer(buffer, access);
+}
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_resolve("glMapNamedBufferRange");
+    return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) {
+    glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_resolve("glUnmapNamedBuffer");
+    return glad_glUnmapNamedBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedNamedBufferRange");
+    glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+    glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedBufferParameteriv");
+    glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+    glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetNamedBufferParameteri64v");
+    glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+    glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_lazy_resolve("glGetNamedBufferPointerv");
+    glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+    glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve("glGetNamedBufferSubData");
+    glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+    glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glad_lazy_resolve("glCreateFramebuffers");
+    glad_glCreateFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glNamedFramebufferRenderbuffer");
+    glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_lazy_resolve("glNamedFramebufferParameteri");
+    glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glNamedFramebufferTexture");
+    glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glNamedFramebufferTextureLayer");
+    glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_lazy_resolve("glNamedFramebufferDrawBuffer");
+    glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+    glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_lazy_resolve("glNamedFramebufferDrawBuffers");
+    glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_lazy_resolve("glNamedFramebufferReadBuffer");
+    glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+    glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_lazy_resolve("glInvalidateNamedFramebufferData");
+    glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_lazy_resolve("glInvalidateNamedFramebufferSubData");
+    glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+    glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_lazy_resolve("glClearNamedFramebufferiv");
+    glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_lazy_resolve("glClearNamedFramebufferuiv");
+    glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_lazy_resolve("glClearNamedFramebufferfv");
+    glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_lazy_resolve("glClearNamedFramebufferfi");
+    glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_lazy_resolve("glBlitNamedFramebuffer");
+    glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckNamedFramebufferStatus");
+    return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+    glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedFramebufferParameteriv");
+    glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+    glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetNamedFramebufferAttachmentParameteriv");
+    glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glad_lazy_resolve("glCreateRenderbuffers");
+    glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glNamedRenderbufferStorage");
+    glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glNamedRenderbufferStorageMultisample");
+    glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+    glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetNamedRenderbufferParameteriv");
+    glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+    glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)glad_lazy_resolve("glCreateTextures");
+    glad_glCreateTextures(target, n, textures);
+}
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glad_lazy_resolve("glTextureBuffer");
+    glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glad_lazy_resolve("glTextureBufferRange");
+    glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glad_lazy_resolve("glTextureStorage1D");
+    glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glad_lazy_resolve("glTextureStorage2D");
+    glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glad_lazy_resolve("glTextureStorage3D");
+    glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTextureStorage2DMultisample");
+    glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTextureStorage3DMultisample");
+    glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glTextureSubImage1D");
+    glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glTextureSubImage2D");
+    glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glTextureSubImage3D");
+    glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTextureSubImage1D");
+    glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTextureSubImage2D");
+    glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTextureSubImage3D");
+    glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_lazy_resolve("glCopyTextureSubImage1D");
+    glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_lazy_resolve("glCopyTextureSubImage2D");
+    glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_lazy_resolve("glCopyTextureSubImage3D");
+    glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glad_lazy_resolve("glTextureParameterf");
+    glad_glTextureParameterf(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+    glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glad_lazy_resolve("glTextureParameterfv");
+    glad_glTextureParameterfv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glad_lazy_resolve("glTextureParameteri");
+    glad_glTextureParameteri(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+    glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glad_lazy_resolve("glTextureParameterIiv");
+    glad_glTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+    glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve("glTextureParameterIuiv");
+    glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+    glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glad_lazy_resolve("glTextureParameteriv");
+    glad_glTextureParameteriv(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) {
+    glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_resolve("glGenerateTextureMipmap");
+    glad_glGenerateTextureMipmap(texture);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+    glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glad_lazy_resolve("glBindTextureUnit");
+    glad_glBindTextureUnit(unit, texture);
+}
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glad_lazy_resolve("glGetTextureImage");
+    glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+    glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_lazy_resolve("glGetCompressedTextureImage");
+    glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+    glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTextureLevelParameterfv");
+    glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+    glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTextureLevelParameteriv");
+    glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+    glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glad_lazy_resolve("glGetTextureParameterfv");
+    glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+    glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glad_lazy_resolve("glGetTextureParameterIiv");
+    glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+    glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve("glGetTextureParameterIuiv");
+    glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+    glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glad_lazy_resolve("glGetTextureParameteriv");
+    glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+    glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glad_lazy_resolve("glCreateVertexArrays");
+    glad_glCreateVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve("glDisableVertexArrayAttrib");
+    glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve("glEnableVertexArrayAttrib");
+    glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_lazy_resolve("glVertexArrayElementBuffer");
+    glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_lazy_resolve("glVertexArrayVertexBuffer");
+    glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_lazy_resolve("glVertexArrayVertexBuffers");
+    glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_lazy_resolve("glVertexArrayAttribBinding");
+    glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_lazy_resolve("glVertexArrayAttribFormat");
+    glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_lazy_resolve("glVertexArrayAttribIFormat");
+    glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_lazy_resolve("glVertexArrayAttribLFormat");
+    glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_lazy_resolve("glVertexArrayBindingDivisor");
+    glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+    glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glad_lazy_resolve("glGetVertexArrayiv");
+    glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+    glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_lazy_resolve("glGetVertexArrayIndexediv");
+    glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+    glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_lazy_resolve("glGetVertexArrayIndexed64iv");
+    glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+    glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glad_lazy_resolve("glCreateSamplers");
+    glad_glCreateSamplers(n, samplers);
+}
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+    glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glad_lazy_resolve("glCreateProgramPipelines");
+    glad_glCreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY glad_lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+    glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)glad_lazy_resolve("glCreateQueries");
+    glad_glCreateQueries(target, n, ids);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_lazy_resolve("glGetQueryBufferObjecti64v");
+    glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_lazy_resolve("glGetQueryBufferObjectiv");
+    glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_lazy_resolve("glGetQueryBufferObjectui64v");
+    glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_lazy_resolve("glGetQueryBufferObjectuiv");
+    glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glMemoryBarrierByRegion(GLbitfield barriers) {
+    glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)glad_lazy_resolve("glMemoryBarrierByRegion");
+    glad_glMemoryBarrierByRegion(barriers);
+}
+static void APIENTRY glad_lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)glad_lazy_resolve("glGetTextureSubImage");
+    glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+    glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_lazy_resolve("glGetCompressedTextureSubImage");
+    glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLenum APIENTRY glad_lazy_glGetGraphicsResetStatus(void) {
+    glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)glad_lazy_resolve("glGetGraphicsResetStatus");
+    return glad_glGetGraphicsResetStatus();
+}
+static void APIENTRY glad_lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+    glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetnCompressedTexImage");
+    glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)glad_lazy_resolve("glGetnTexImage");
+    glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+    glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)glad_lazy_resolve("glGetnUniformdv");
+    glad_glGetnUniformdv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)glad_lazy_resolve("glGetnUniformfv");
+    glad_glGetnUniformfv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)glad_lazy_resolve("glGetnUniformiv");
+    glad_glGetnUniformiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)glad_lazy_resolve("glGetnUniformuiv");
+    glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    glad_glReadnPixels = (PFNGLREADNPIXELSPROC)glad_lazy_resolve("glReadnPixels");
+    glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY glad_lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+    glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)glad_lazy_resolve("glGetnMapdv");
+    glad_glGetnMapdv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+    glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)glad_lazy_resolve("glGetnMapfv");
+    glad_glGetnMapfv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+    glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)glad_lazy_resolve("glGetnMapiv");
+    glad_glGetnMapiv(target, query, bufSize, v);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+    glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)glad_lazy_resolve("glGetnPixelMapfv");
+    glad_glGetnPixelMapfv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+    glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)glad_lazy_resolve("glGetnPixelMapuiv");
+    glad_glGetnPixelMapuiv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+    glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)glad_lazy_resolve("glGetnPixelMapusv");
+    glad_glGetnPixelMapusv(map, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+    glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)glad_lazy_resolve("glGetnPolygonStipple");
+    glad_glGetnPolygonStipple(bufSize, pattern);
+}
+static void APIENTRY glad_lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+    glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)glad_lazy_resolve("glGetnColorTable");
+    glad_glGetnColorTable(target, format, type, bufSize, table);
+}
+static void APIENTRY glad_lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+    glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)glad_lazy_resolve("glGetnConvolutionFilter");
+    glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+}
+static void APIENTRY glad_lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+    glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)glad_lazy_resolve("glGetnSeparableFilter");
+    glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY glad_lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)glad_lazy_resolve("glGetnHistogram");
+    glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)glad_lazy_resolve("glGetnMinmax");
+    glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY glad_lazy_glTextureBarrier(void) {
+    glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)glad_lazy_resolve("glTextureBarrier");
+    glad_glTextureBarrier();
+}
+static void APIENTRY glad_lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+    glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)glad_lazy_resolve("glSpecializeShader");
+    glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glad_lazy_resolve("glMultiDrawArraysIndirectCount");
+    glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glad_lazy_resolve("glMultiDrawElementsIndirectCount");
+    glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY glad_lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)glad_lazy_resolve("glPolygonOffsetClamp");
+    glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+    const char* version;
+    int major = 0, minor = 0;
+
+    lazyLoad = load;
+    GLVersion.major = 0; GLVersion.minor = 0;
+
+    glad_glCullFace = glad_lazy_glCullFace;
+    glad_glFrontFace = glad_lazy_glFrontFace;
+    glad_glHint = glad_lazy_glHint;
+    glad_glLineWidth = glad_lazy_glLineWidth;
+    glad_glPointSize = glad_lazy_glPointSize;
+    glad_glPolygonMode = glad_lazy_glPolygonMode;
+    glad_glScissor = glad_lazy_glScissor;
+    glad_glTexParameterf = glad_lazy_glTexParameterf;
+    glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+    glad_glTexParameteri = glad_lazy_glTexParameteri;
+    glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+    glad_glTexImage1D = glad_lazy_glTexImage1D;
+    glad_glTexImage2D = glad_lazy_glTexImage2D;
+    glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+    glad_glClear = glad_lazy_glClear;
+    glad_glClearColor = glad_lazy_glClearColor;
+    glad_glClearStencil = glad_lazy_glClearStencil;
+    glad_glClearDepth = glad_lazy_glClearDepth;
+    glad_glStencilMask = glad_lazy_glStencilMask;
+    glad_glColorMask = glad_lazy_glColorMask;
+    glad_glDepthMask = glad_lazy_glDepthMask;
+    glad_glDisable = glad_lazy_glDisable;
+    glad_glEnable = glad_lazy_glEnable;
+    glad_glFinish = glad_lazy_glFinish;
+    glad_glFlush = glad_lazy_glFlush;
+    glad_glBlendFunc = glad_lazy_glBlendFunc;
+    glad_glLogicOp = glad_lazy_glLogicOp;
+    glad_glStencilFunc = glad_lazy_glStencilFunc;
+    glad_glStencilOp = glad_lazy_glStencilOp;
+    glad_glDepthFunc = glad_lazy_glDepthFunc;
+    glad_glPixelStoref = glad_lazy_glPixelStoref;
+    glad_glPixelStorei = glad_lazy_glPixelStorei;
+    glad_glReadBuffer = glad_lazy_glReadBuffer;
+    glad_glReadPixels = glad_lazy_glReadPixels;
+    glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+    glad_glGetDoublev = glad_lazy_glGetDoublev;
+    glad_glGetError = glad_lazy_glGetError;
+    glad_glGetFloatv = glad_lazy_glGetFloatv;
+    glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+    glad_glGetString = glad_lazy_glGetString;
+    glad_glGetTexImage = glad_lazy_glGetTexImage;
+    glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+    glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+    glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+    glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+    glad_glIsEnabled = glad_lazy_glIsEnabled;
+    glad_glDepthRange = glad_lazy_glDepthRange;
+    glad_glViewport = glad_lazy_glViewport;
+    glad_glNewList = glad_lazy_glNewList;
+    glad_glEndList = glad_lazy_glEndList;
+    glad_glCallList = glad_lazy_glCallList;
+    glad_glCallLists = glad_lazy_glCallLists;
+    glad_glDeleteLists = glad_lazy_glDeleteLists;
+    glad_glGenLists = glad_lazy_glGenLists;
+    glad_glListBase = glad_lazy_glListBase;
+    glad_glBegin = glad_lazy_glBegin;
+    glad_glBitmap = glad_lazy_glBitmap;
+    glad_glColor3b = glad_lazy_glColor3b;
+    glad_glColor3bv = glad_lazy_glColor3bv;
+    glad_glColor3d = glad_lazy_glColor3d;
+    glad_glColor3dv = glad_lazy_glColor3dv;
+    glad_glColor3f = glad_lazy_glColor3f;
+    glad_glColor3fv = glad_lazy_glColor3fv;
+    glad_glColor3i = glad_lazy_glColor3i;
+    glad_glColor3iv = glad_lazy_glColor3iv;
+    glad_glColor3s = glad_lazy_glColor3s;
+    glad_glColor3sv = glad_lazy_glColor3sv;
+    glad_glColor3ub = glad_lazy_glColor3ub;
+    glad_glColor3ubv = glad_lazy_glColor3ubv;
+    glad_glColor3ui = glad_lazy_glColor3ui;
+    glad_glColor3uiv = glad_lazy_glColor3uiv;
+    glad_glColor3us = glad_lazy_glColor3us;
+    glad_glColor3usv = glad_lazy_glColor3usv;
+    glad_glColor4b = glad_lazy_glColor4b;
+    glad_glColor4bv = glad_lazy_glColor4bv;
+    glad_glColor4d = glad_lazy_glColor4d;
+    glad_glColor4dv = glad_lazy_glColor4dv;
+    glad_glColor4f = glad_lazy_glColor4f;
+    glad_glColor4fv = glad_lazy_glColor4fv;
+    glad_glColor4i = glad_lazy_glColor4i;
+    glad_glColor4iv = glad_lazy_glColor4iv;
+    glad_glColor4s = glad_lazy_glColor4s;
+    glad_glColor4sv = glad_lazy_glColor4sv;
+    glad_glColor4ub = glad_lazy_glColor4ub;
+    glad_glColor4ubv = glad_lazy_glColor4ubv;
+    glad_glColor4ui = glad_lazy_glColor4ui;
+    glad_glColor4uiv = glad_lazy_glColor4uiv;
+    glad_glColor4us = glad_lazy_glColor4us;
+    glad_glColor4usv = glad_lazy_glColor4usv;
+    glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+    glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+    glad_glEnd = glad_lazy_glEnd;
+    glad_glIndexd = glad_lazy_glIndexd;
+    glad_glIndexdv = glad_lazy_glIndexdv;
+    glad_glIndexf = glad_lazy_glIndexf;
+    glad_glIndexfv = glad_lazy_glIndexfv;
+    glad_glIndexi = glad_lazy_glIndexi;
+    glad_glIndexiv = glad_lazy_glIndexiv;
+    glad_glIndexs = glad_lazy_glIndexs;
+    glad_glIndexsv = glad_lazy_glIndexsv;
+    glad_glNormal3b = glad_lazy_glNormal3b;
+    glad_glNormal3bv = glad_lazy_glNormal3bv;
+    glad_glNormal3d = glad_lazy_glNormal3d;
+    glad_glNormal3dv = glad_lazy_glNormal3dv;
+    glad_glNormal3f = glad_lazy_glNormal3f;
+    glad_glNormal3fv = glad_lazy_glNormal3fv;
+    glad_glNormal3i = glad_lazy_glNormal3i;
+    glad_glNormal3iv = glad_lazy_glNormal3iv;
+    glad_glNormal3s = glad_lazy_glNormal3s;
+    glad_glNormal3sv = glad_lazy_glNormal3sv;
+    glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+    glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+    glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+    glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+    glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+    glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+    glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+    glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+    glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+    glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+    glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+    glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+    glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+    glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+    glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+    glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+    glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+    glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+    glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+    glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+    glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+    glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+    glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+    glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+    glad_glRectd = glad_lazy_glRectd;
+    glad_glRectdv = glad_lazy_glRectdv;
+    glad_glRectf = glad_lazy_glRectf;
+    glad_glRectfv = glad_lazy_glRectfv;
+    glad_glRecti = glad_lazy_glRecti;
+    glad_glRectiv = glad_lazy_glRectiv;
+    glad_glRects = glad_lazy_glRects;
+    glad_glRectsv = glad_lazy_glRectsv;
+    glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+    glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+    glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+    glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+    glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+    glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+    glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+    glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+    glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+    glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+    glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+    glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+    glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+    glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+    glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+    glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+    glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+    glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+    glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+    glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+    glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+    glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+    glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+    glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+    glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+    glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+    glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+    glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+    glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+    glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+    glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+    glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+    glad_glVertex2d = glad_lazy_glVertex2d;
+    glad_glVertex2dv = glad_lazy_glVertex2dv;
+    glad_glVertex2f = glad_lazy_glVertex2f;
+    glad_glVertex2fv = glad_lazy_glVertex2fv;
+    glad_glVertex2i = glad_lazy_glVertex2i;
+    glad_glVertex2iv = glad_lazy_glVertex2iv;
+    glad_glVertex2s = glad_lazy_glVertex2s;
+    glad_glVertex2sv = glad_lazy_glVertex2sv;
+    glad_glVertex3d = glad_lazy_glVertex3d;
+    glad_glVertex3dv = glad_lazy_glVertex3dv;
+    glad_glVertex3f = glad_lazy_glVertex3f;
+    glad_glVertex3fv = glad_lazy_glVertex3fv;
+    glad_glVertex3i = glad_lazy_glVertex3i;
+    glad_glVertex3iv = glad_lazy_glVertex3iv;
+    glad_glVertex3s = glad_lazy_glVertex3s;
+    glad_glVertex3sv = glad_lazy_glVertex3sv;
+    glad_glVertex4d = glad_lazy_glVertex4d;
+    glad_glVertex4dv = glad_lazy_glVertex4dv;
+    glad_glVertex4f = glad_lazy_glVertex4f;
+    glad_glVertex4fv = glad_lazy_glVertex4fv;
+    glad_glVertex4i = glad_lazy_glVertex4i;
+    glad_glVertex4iv = glad_lazy_glVertex4iv;
+    glad_glVertex4s = glad_lazy_glVertex4s;
+    glad_glVertex4sv = glad_lazy_glVertex4sv;
+    glad_glClipPlane = glad_lazy_glClipPlane;
+    glad_glColorMaterial = glad_lazy_glColorMaterial;
+    glad_glFogf = glad_lazy_glFogf;
+    glad_glFogfv = glad_lazy_glFogfv;
+    glad_glFogi = glad_lazy_glFogi;
+    glad_glFogiv = glad_lazy_glFogiv;
+    glad_glLightf = glad_lazy_glLightf;
+    glad_glLightfv = glad_lazy_glLightfv;
+    glad_glLighti = glad_lazy_glLighti;
+    glad_glLightiv = glad_lazy_glLightiv;
+    glad_glLightModelf = glad_lazy_glLightModelf;
+    glad_glLightModelfv = glad_lazy_glLightModelfv;
+    glad_glLightModeli = glad_lazy_glLightModeli;
+    glad_glLightModeliv = glad_lazy_glLightModeliv;
+    glad_glLineStipple = glad_lazy_glLineStipple;
+    glad_glMaterialf = glad_lazy_glMaterialf;
+    glad_glMaterialfv = glad_lazy_glMaterialfv;
+    glad_glMateriali = glad_lazy_glMateriali;
+    glad_glMaterialiv = glad_lazy_glMaterialiv;
+    glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+    glad_glShadeModel = glad_lazy_glShadeModel;
+    glad_glTexEnvf = glad_lazy_glTexEnvf;
+    glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+    glad_glTexEnvi = glad_lazy_glTexEnvi;
+    glad_glTexEnviv = glad_lazy_glTexEnviv;
+    glad_glTexGend = glad_lazy_glTexGend;
+    glad_glTexGendv = glad_lazy_glTexGendv;
+    glad_glTexGenf = glad_lazy_glTexGenf;
+    glad_glTexGenfv = glad_lazy_glTexGenfv;
+    glad_glTexGeni = glad_lazy_glTexGeni;
+    glad_glTexGeniv = glad_lazy_glTexGeniv;
+    glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+    glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+    glad_glRenderMode = glad_lazy_glRenderMode;
+    glad_glInitNames = glad_lazy_glInitNames;
+    glad_glLoadName = glad_lazy_glLoadName;
+    glad_glPassThrough = glad_lazy_glPassThrough;
+    glad_glPopName = glad_lazy_glPopName;
+    glad_glPushName = glad_lazy_glPushName;
+    glad_glClearAccum = glad_lazy_glClearAccum;
+    glad_glClearIndex = glad_lazy_glClearIndex;
+    glad_glIndexMask = glad_lazy_glIndexMask;
+    glad_glAccum = glad_lazy_glAccum;
+    glad_glPopAttrib = glad_lazy_glPopAttrib;
+    glad_glPushAttrib = glad_lazy_glPushAttrib;
+    glad_glMap1d = glad_lazy_glMap1d;
+    glad_glMap1f = glad_lazy_glMap1f;
+    glad_glMap2d = glad_lazy_glMap2d;
+    glad_glMap2f = glad_lazy_glMap2f;
+    glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+    glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+    glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+    glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+    glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+    glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+    glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+    glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+    glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+    glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+    glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+    glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+    glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+    glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+    glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+    glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+    glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+    glad_glPixelZoom = glad_lazy_glPixelZoom;
+    glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+    glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+    glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+    glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+    glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+    glad_glCopyPixels = glad_lazy_glCopyPixels;
+    glad_glDrawPixels = glad_lazy_glDrawPixels;
+    glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+    glad_glGetLightfv = glad_lazy_glGetLightfv;
+    glad_glGetLightiv = glad_lazy_glGetLightiv;
+    glad_glGetMapdv = glad_lazy_glGetMapdv;
+    glad_glGetMapfv = glad_lazy_glGetMapfv;
+    glad_glGetMapiv = glad_lazy_glGetMapiv;
+    glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+    glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+    glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+    glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+    glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+    glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+    glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+    glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+    glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+    glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+    glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+    glad_glIsList = glad_lazy_glIsList;
+    glad_glFrustum = glad_lazy_glFrustum;
+    glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+    glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+    glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+    glad_glMatrixMode = glad_lazy_glMatrixMode;
+    glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+    glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+    glad_glOrtho = glad_lazy_glOrtho;
+    glad_glPopMatrix = glad_lazy_glPopMatrix;
+    glad_glPushMatrix = glad_lazy_glPushMatrix;
+    glad_glRotated = glad_lazy_glRotated;
+    glad_glRotatef = glad_lazy_glRotatef;
+    glad_glScaled = glad_lazy_glScaled;
+    glad_glScalef = glad_lazy_glScalef;
+    glad_glTranslated = glad_lazy_glTranslated;
+    glad_glTranslatef = glad_lazy_glTranslatef;
+    glad_glDrawArrays = glad_lazy_glDrawArrays;
+    glad_glDrawElements = glad_lazy_glDrawElements;
+    glad_glGetPointerv = glad_lazy_glGetPointerv;
+    glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+    glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+    glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+    glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+    glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+    glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+    glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+    glad_glBindTexture = glad_lazy_glBindTexture;
+    glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+    glad_glGenTextures = glad_lazy_glGenTextures;
+    glad_glIsTexture = glad_lazy_glIsTexture;
+    glad_glArrayElement = glad_lazy_glArrayElement;
+    glad_glColorPointer = glad_lazy_glColorPointer;
+    glad_glDisableClientState = glad_lazy_glDisableClientState;
+    glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+    glad_glEnableClientState = glad_lazy_glEnableClientState;
+    glad_glIndexPointer = glad_lazy_glIndexPointer;
+    glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+    glad_glNormalPointer = glad_lazy_glNormalPointer;
+    glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+    glad_glVertexPointer = glad_lazy_glVertexPointer;
+    glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+    glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+    glad_glIndexub = glad_lazy_glIndexub;
+    glad_glIndexubv = glad_lazy_glIndexubv;
+    glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+    glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+    glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+    glad_glTexImage3D = glad_lazy_glTexImage3D;
+    glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+    glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+    glad_glActiveTexture = glad_lazy_glActiveTexture;
+    glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+    glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+    glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+    glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+    glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+    glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+    glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+    glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+    glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+    glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+    glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+    glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+    glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+    glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+    glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+    glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+    glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+    glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+    glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+    glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+    glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+    glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+    glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+    glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+    glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+    glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+    glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+    glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+    glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+    glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+    glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+    glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+    glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+    glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+    glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+    glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+    glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+    glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+    glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+    glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+    glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+    glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+    glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+    glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+    glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+    glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+    glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+    glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+    glad_glPointParameterf = glad_lazy_glPointParameterf;
+    glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+    glad_glPointParameteri = glad_lazy_glPointParameteri;
+    glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+    glad_glFogCoordf = glad_lazy_glFogCoordf;
+    glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+    glad_glFogCoordd = glad_lazy_glFogCoordd;
+    glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+    glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+    glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+    glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+    glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+    glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+    glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+    glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+    glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+    glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+    glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+    glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+    glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+    glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+    glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+    glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+    glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+    glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+    glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+    glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+    glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+    glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+    glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+    glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+    glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+    glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+    glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+    glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+    glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+    glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+    glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+    glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+    glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+    glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+    glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+    glad_glBlendColor = glad_lazy_glBlendColor;
+    glad_glBlendEquation = glad_lazy_glBlendEquation;
+    glad_glGenQueries = glad_lazy_glGenQueries;
+    glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+    glad_glIsQuery = glad_lazy_glIsQuery;
+    glad_glBeginQuery = glad_lazy_glBeginQuery;
+    glad_glEndQuery = glad_lazy_glEndQuery;
+    glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+    glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+    glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+    glad_glBindBuffer = glad_lazy_glBindBuffer;
+    glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+    glad_glGenBuffers = glad_lazy_glGenBuffers;
+    glad_glIsBuffer = glad_lazy_glIsBuffer;
+    glad_glBufferData = glad_lazy_glBufferData;
+    glad_glBufferSubData = glad_lazy_glBufferSubData;
+    glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+    glad_glMapBuffer = glad_lazy_glMapBuffer;
+    glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+    glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+    glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+    glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+    glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+    glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+    glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+    glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+    glad_glAttachShader = glad_lazy_glAttachShader;
+    glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+    glad_glCompileShader = glad_lazy_glCompileShader;
+    glad_glCreateProgram = glad_lazy_glCreateProgram;
+    glad_glCreateShader = glad_lazy_glCreateShader;
+    glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+    glad_glDeleteShader = glad_lazy_glDeleteShader;
+    glad_glDetachShader = glad_lazy_glDetachShader;
+    glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+    glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+    glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+    glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+    glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+    glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+    glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+    glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+    glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+    glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+    glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+    glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+    glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+    glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+    glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+    glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+    glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+    glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+    glad_glIsProgram = glad_lazy_glIsProgram;
+    glad_glIsShader = glad_lazy_glIsShader;
+    glad_glLinkProgram = glad_lazy_glLinkProgram;
+    glad_glShaderSource = glad_lazy_glShaderSource;
+    glad_glUseProgram = glad_lazy_glUseProgram;
+    glad_glUniform1f = glad_lazy_glUniform1f;
+    glad_glUniform2f = glad_lazy_glUniform2f;
+    glad_glUniform3f = glad_lazy_glUniform3f;
+    glad_glUniform4f = glad_lazy_glUniform4f;
+    glad_glUniform1i = glad_lazy_glUniform1i;
+    glad_glUniform2i = glad_lazy_glUniform2i;
+    glad_glUniform3i = glad_lazy_glUniform3i;
+    glad_glUniform4i = glad_lazy_glUniform4i;
+    glad_glUniform1fv = glad_lazy_glUniform1fv;
+    glad_glUniform2fv = glad_lazy_glUniform2fv;
+    glad_glUniform3fv = glad_lazy_glUniform3fv;
+    glad_glUniform4fv = glad_lazy_glUniform4fv;
+    glad_glUniform1iv = glad_lazy_glUniform1iv;
+    glad_glUniform2iv = glad_lazy_glUniform2iv;
+    glad_glUniform3iv = glad_lazy_glUniform3iv;
+    glad_glUniform4iv = glad_lazy_glUniform4iv;
+    glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+    glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+    glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+    glad_glValidateProgram = glad_lazy_glValidateProgram;
+    glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+    glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+    glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+    glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+    glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+    glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+    glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+    glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+    glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+    glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+    glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+    glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+    glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+    glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+    glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+    glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+    glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+    glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+    glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+    glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+    glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+    glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+    glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+    glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+    glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+    glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+    glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+    glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+    glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+    glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+    glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+    glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+    glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+    glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+    glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+    glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+    glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+    glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+    glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+    glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+    glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+    glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+    glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+    glad_glColorMaski = glad_lazy_glColorMaski;
+    glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+    glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+    glad_glEnablei = glad_lazy_glEnablei;
+    glad_glDisablei = glad_lazy_glDisablei;
+    glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+    glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+    glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+    glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+    glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+    glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+    glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+    glad_glClampColor = glad_lazy_glClampColor;
+    glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+    glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+    glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+    glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+    glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+    glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+    glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+    glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+    glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+    glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+    glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+    glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+    glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+    glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+    glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+    glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+    glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+    glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+    glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+    glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+    glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+    glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+    glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+    glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+    glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+    glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+    glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+    glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+    glad_glUniform1ui = glad_lazy_glUniform1ui;
+    glad_glUniform2ui = glad_lazy_glUniform2ui;
+    glad_glUniform3ui = glad_lazy_glUniform3ui;
+    glad_glUniform4ui = glad_lazy_glUniform4ui;
+    glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+    glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+    glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+    glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+    glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+    glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+    glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+    glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+    glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+    glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+    glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+    glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+    glad_glGetStringi = glad_lazy_glGetStringi;
+    glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+    glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+    glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+    glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+    glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+    glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+    glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+    glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+    glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+    glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+    glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+    glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+    glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+    glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+    glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+    glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+    glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+    glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+    glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+    glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+    glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+    glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+    glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+    glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+    glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+    glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+    glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+    glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+    glad_glTexBuffer = glad_lazy_glTexBuffer;
+    glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+    glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+    glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+    glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+    glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+    glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+    glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+    glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+    glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+    glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+    glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+    glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+    glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+    glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+    glad_glFenceSync = glad_lazy_glFenceSync;
+    glad_glIsSync = glad_lazy_glIsSync;
+    glad_glDeleteSync = glad_lazy_glDeleteSync;
+    glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+    glad_glWaitSync = glad_lazy_glWaitSync;
+    glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+    glad_glGetSynciv = glad_lazy_glGetSynciv;
+    glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+    glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+    glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+    glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+    glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+    glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+    glad_glSampleMaski = glad_lazy_glSampleMaski;
+    glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+    glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+    glad_glGenSamplers = glad_lazy_glGenSamplers;
+    glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+    glad_glIsSampler = glad_lazy_glIsSampler;
+    glad_glBindSampler = glad_lazy_glBindSampler;
+    glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+    glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+    glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+    glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+    glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+    glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+    glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+    glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+    glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+    glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+    glad_glQueryCounter = glad_lazy_glQueryCounter;
+    glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+    glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+    glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+    glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+    glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+    glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+    glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+    glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+    glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+    glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+    glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+    glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+    glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+    glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+    glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+    glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+    glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+    glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+    glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+    glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+    glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+    glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+    glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+    glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+    glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+    glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+    glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+    glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+    glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+    glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+    glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+    glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+    glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+    glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+    glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+    glad_glColorP3ui = glad_lazy_glColorP3ui;
+    glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+    glad_glColorP4ui = glad_lazy_glColorP4ui;
+    glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+    glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+    glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+    glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+    glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+    glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+    glad_glBlendFunci = glad_lazy_glBlendFunci;
+    glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+    glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+    glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+    glad_glUniform1d = glad_lazy_glUniform1d;
+    glad_glUniform2d = glad_lazy_glUniform2d;
+    glad_glUniform3d = glad_lazy_glUniform3d;
+    glad_glUniform4d = glad_lazy_glUniform4d;
+    glad_glUniform1dv = glad_lazy_glUniform1dv;
+    glad_glUniform2dv = glad_lazy_glUniform2dv;
+    glad_glUniform3dv = glad_lazy_glUniform3dv;
+    glad_glUniform4dv = glad_lazy_glUniform4dv;
+    glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+    glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+    glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+    glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+    glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+    glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+    glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+    glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+    glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+    glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+    glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+    glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+    glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+    glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+    glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+    glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+    glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+    glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+    glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+    glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+    glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+    glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+    glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+    glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+    glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+    glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+    glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+    glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+    glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+    glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+    glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+    glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+    glad_glShaderBinary = glad_lazy_glShaderBinary;
+    glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+    glad_glDepthRangef = glad_lazy_glDepthRangef;
+    glad_glClearDepthf = glad_lazy_glClearDepthf;
+    glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+    glad_glProgramBinary = glad_lazy_glProgramBinary;
+    glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+    glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+    glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+    glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+    glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+    glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+    glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+    glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+    glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+    glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+    glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+    glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+    glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+    glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+    glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+    glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+    glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+    glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+    glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+    glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+    glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+    glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+    glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+    glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+    glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+    glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+    glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+    glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+    glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+    glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+    glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+    glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+    glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+    glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+    glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+    glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+    glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+    glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+    glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+    glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+    glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+    glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+    glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+    glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+    glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+    glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+    glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+    glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+    glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+    glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+    glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+    glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+    glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+    glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+    glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+    glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+    glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+    glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+    glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+    glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+    glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+    glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+    glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+    glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+    glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+    glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+    glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+    glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+    glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+    glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+    glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+    glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+    glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+    glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+    glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+    glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+    glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+    glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+    glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+    glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+    glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+    glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+    glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+    glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+    glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+    glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+    glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+    glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+    glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+    glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+    glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+    glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+    glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+    glad_glClearBufferData = glad_lazy_glClearBufferData;
+    glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+    glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+    glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+    glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+    glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+    glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+    glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+    glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+    glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+    glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+    glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+    glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+    glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+    glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+    glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+    glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+    glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+    glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+    glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+    glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+    glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+    glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+    glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+    glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+    glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+    glad_glTextureView = glad_lazy_glTextureView;
+    glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+    glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+    glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+    glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+    glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+    glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+    glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+    glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+    glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+    glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+    glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+    glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+    glad_glObjectLabel = glad_lazy_glObjectLabel;
+    glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+    glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+    glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+    glad_glBufferStorage = glad_lazy_glBufferStorage;
+    glad_glClearTexImage = glad_lazy_glClearTexImage;
+    glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+    glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+    glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+    glad_glBindTextures = glad_lazy_glBindTextures;
+    glad_glBindSamplers = glad_lazy_glBindSamplers;
+    glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+    glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+    glad_glClipControl = glad_lazy_glClipControl;
+    glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+    glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+    glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+    glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+    glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+    glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+    glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+    glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+    glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+    glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+    glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+    glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+    glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+    glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+    glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+    glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+    glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+    glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+    glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+    glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+    glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+    glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+    glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+    glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+    glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+    glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+    glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+    glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+    glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+    glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+    glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+    glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+    glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+    glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+    glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+    glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+    glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+    glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+    glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+    glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+    glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+    glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+    glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+    glad_glCreateTextures = glad_lazy_glCreateTextures;
+    glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+    glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+    glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+    glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+    glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+    glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+    glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+    glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+    glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+    glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+    glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+    glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+    glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+    glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+    glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+    glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+    glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+    glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+    glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+    glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+    glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+    glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+    glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+    glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+    glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+    glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+    glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+    glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+    glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+    glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+    glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+    glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+    glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+    glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+    glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+    glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+    glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+    glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+    glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+    glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+    glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+    glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+    glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+    glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+    glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+    glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+    glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+    glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+    glad_glCreateQueries = glad_lazy_glCreateQueries;
+    glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+    glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+    glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+    glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+    glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+    glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+    glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+    glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+    glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+    glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+    glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+    glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+    glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+    glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+    glad_glReadnPixels = glad_lazy_glReadnPixels;
+    glad_glGetnMapdv = glad_lazy_glGetnMapdv;
+    glad_glGetnMapfv = glad_lazy_glGetnMapfv;
+    glad_glGetnMapiv = glad_lazy_glGetnMapiv;
+    glad_glGetnPixelMapfv = glad_lazy_glGetnPixelMapfv;
+    glad_glGetnPixelMapuiv = glad_lazy_glGetnPixelMapuiv;
+    glad_glGetnPixelMapusv = glad_lazy_glGetnPixelMapusv;
+    glad_glGetnPolygonStipple = glad_lazy_glGetnPolygonStipple;
+    glad_glGetnColorTable = glad_lazy_glGetnColorTable;
+    glad_glGetnConvolutionFilter = glad_lazy_glGetnConvolutionFilter;
+    glad_glGetnSeparableFilter = glad_lazy_glGetnSeparableFilter;
+    glad_glGetnHistogram = glad_lazy_glGetnHistogram;
+    glad_glGetnMinmax = glad_lazy_glGetnMinmax;
+    glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+    glad_glSpecializeShader = glad_lazy_glSpecializeShader;
+    glad_glMultiDrawArraysIndirectCount = glad_lazy_glMultiDrawArraysIndirectCount;
+    glad_glMultiDrawElementsIndirectCount = glad_lazy_glMultiDrawElementsIndirectCount;
+    glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+
+    /* Resolve glGetString now, a missing one means there is no usable context */
+    glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if (glad_glGetString == NULL) return 0;
+
+    version = (const char*)glad_glGetString(GL_VERSION);
+    if (version == NULL) return 0;
+
+    /* Skip a prefix like "OpenGL ES " before the version number */
+    while (*version && (*version < '0' || *version > '9')) version++;
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+    GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+    GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+    GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+    GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+    GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+    GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+    GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+    GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+    GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+    GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+    GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+    GLAD_GL_VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+    GLAD_GL_VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+    GLAD_GL_VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+    GLAD_GL_VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+    GLAD_GL_VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+    GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+    GLAD_GL_VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
+
+    return GLVersion.major != 0 || GLVersion.minor != 0;
+}
@@ -0,0 +1,137 @@
+#include <opengl-module/hash.h>
+#include <cstring>
+
+static const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t rotl(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+// Reads unaligned words with memcpy, which compiles to a plain load
+static inline uint64_t read64(const unsigned char* p)
+{
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint32_t read32(const unsigned char* p)
+{
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+static inline uint64_t accumulate(uint64_t accumulator, uint64_t input)
+{
+  accumulator += input * PRIME2;
+  accumulator = rotl(accumulator, 31);
+  return accumulator * PRIME1;
+}
+
+static inline uint64_t mergeRound(uint64_t accumulator, uint64_t value)
+{
+  accumulator ^= accumulate(0, value);
+  return accumulator * PRIME1 + PRIME4;
+}
+
+/**
+ * Hashes a block of memory
+ *
+ * @param data: The bytes to hash
+ * @param size: The number of bytes
+ * @param seed: Gives a different hash for the same bytes, to chain hashes or separate uses
+ *
+ * @returns: The hash
+ */
+uint64_t Hash::compute(const void* data, size_t size, uint64_t seed)
+{
+  const unsigned char* p = (const unsigned char*)data;
+  const unsigned char* end = p + size;
+  uint64_t hash;
+
+  if (size >= 32)
+  {
+    // Four independent lanes, so the multiplies overlap
+    uint64_t v1 = seed + PRIME1 + PRIME2;
+    uint64_t v2 = seed + PRIME2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - PRIME1;
+
+    const unsigned char* limit = end - 32;
+    do
+    {
+      v1 = accumulate(v1, read64(p));
+      v2 = accumulate(v2, read64(p + 8));
+      v3 = accumulate(v3, read64(p + 16));
+      v4 = accumulate(v4, read64(p + 24));
+      p += 32;
+    } while (p <= limit);
+
+    hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    hash = mergeRound(hash, v1);
+    hash = mergeRound(hash, v2);
+    hash = mergeRound(hash, v3);
+    hash = mergeRound(hash, v4);
+  }
+  else
+    hash = seed + PRIME5;
+
+  hash += (uint64_t)size;
+
+  for (; p + 8 <= end; p += 8)
+    hash = rotl(hash ^ accumulate(0, read64(p)), 27) * PRIME1 + PRIME4;
+
+  if (p + 4 <= end)
+  {
+    hash = rotl(hash ^ (read32(p) * PRIME1), 23) * PRIME2 + PRIME3;
+    p += 4;
+  }
+
+  for (; p < end; p++)
+    hash = rotl(hash ^ (*p * PRIME5), 11) * PRIME1;
+
+  // Avalanche, so every input bit affects every output bit
+  hash ^= hash >> 33;
+  hash *= PRIME2;
+  hash ^= hash >> 29;
+  hash *= PRIME3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+/**
+ * Mixes a value into a hash, for keys made of several fields
+ *
+ * @param hash:  The hash so far
+ * @param value: The value to mix in
+ *
+ * @returns: The new hash
+ */
+uint64_t Hash::combine(uint64_t hash, uint64_t value)
+{
+  return compute(&value, sizeof(value), hash);
+}
+
+/**
+ * Formats a hash as 16 hex digits, for file names
+ *
+ * @param hash: The hash
+ *
+ * @returns: The hex digits
+ */
+std::string Hash::toHex(uint64_t hash)
+{
+  static const char digits[] = "0123456789abcdef";
+
+  std::string hex(16, '0');
+  for (int i = 15; i >= 0; i--, hash >>= 4)
+    hex[i] = digits[hash & 0xF];
+
+  return hex;
+}
@@ -0,0 +1,139 @@
+#include <opengl-module/image.h>
+#include <stb/stb_image.h>
+#include <iostream>
+#include <utility>
+
+// Takes the other image's pixels
+Image::Image(Image&& other)
+{
+  *this = std::move(other);
+}
+
+// Takes the other image's pixels
+Image& Image::operator=(Image&& other)
+{
+  if (this != &other)
+  {
+    free();
+    std::swap(_pixels, other._pixels);
+    std::swap(_width, other._width);
+    std::swap(_height, other._height);
+    std::swap(_channels, other._channels);
+    std::swap(_mapping, other._mapping);
+  }
+
+  return *this;
+}
+
+// Frees the pixels
+Image::~Image()
+{
+  free();
+}
+
+/**
+ * Decodes an image file
+ * Any format stb_image supports can be loaded
+ *
+ * @param path:     The path to the file
+ * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+ * @param channels: The channels to convert to, or 0 to keep the file's
+ *
+ * @returns: True if the image was decoded
+ */
+bool Image::load(const std::string& path, bool flip, int channels)
+{
+  free();
+
+  // The thread's own flag, so images can be decoded on several threads at once
+  stbi_set_flip_vertically_on_load_thread(flip ? 1 : 0);
+
+  int fileChannels = 0;
+  _pixels = stbi_load(path.c_str(), &_width, &_height, &fileChannels, channels);
+  if (!_pixels)
+  {
+    std::cerr << "ERROR::IMAGE::LOAD_FAILED: " << path << ": " << stbi_failure_reason() << "\n";
+    _width = _height = 0;
+    return false;
+  }
+
+  _channels = channels ? channels : fileChannels;
+  return true;
+}
+
+/**
+ * Decodes an image already in memory
+ *
+ * @param data:     The encoded file
+ * @param size:     The size of the file, in bytes
+ * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+ * @param channels: The channels to convert to, or 0 to keep the file's
+ *
+ * @returns: True if the image was decoded
+ */
+bool Image::loadFromMemory(const unsigned char* data, size_t size, bool flip, int channels)
+{
+  free();
+
+  stbi_set_flip_vertically_on_load_thread(flip ? 1 : 0);
+
+  int fileChannels = 0;
+  _pixels = stbi_load_from_memory(data, (int)size, &_width, &_height, &fileChannels, channels);
+  if (!_pixels)
+  {
+    std::cerr << "ERROR::IMAGE::DECODE_FAILED: " << stbi_failure_reason() << "\n";
+    _width = _height = 0;
+    return false;
+  }
+
+  _channels = channels ? channels : fileChannels;
+  return true;
+}
+
+/**
+ * Uses pixels already decoded into a mapped file, like ImageCache's, without copying them
+ * The file stays mapped until the image is freed
+ *
+ * @param mapping:  The mapped file
+ * @param offset:   Where the pixels start in the file, rows tightly packed
+ * @param width:    The width, in pixels
+ * @param height:   The height, in pixels
+ * @param channels: The channels per pixel, 1 to 4
+ *
+ * @returns: True if the file holds that many pixels past the offset
+ */
+bool Image::loadFromMapping(std::unique_ptr<MappedFile> mapping, size_t offset, int width, int height, int channels)
+{
+  free();
+
+  if (!mapping || !mapping->isOpen() || width <= 0 || height <= 0 || channels < 1 || channels > 4 || offset > mapping->getSize() ||
+      (size_t)width * height * channels > mapping->getSize() - offset)
+  {
+    std::cerr << "ERROR::IMAGE::MAPPING_TOO_SMALL\n";
+    return false;
+  }
+
+  _mapping = std::move(mapping);
+  _pixels = _mapping->getData() + offset;
+  _width = width;
+  _height = height;
+  _channels = channels;
+  return true;
+}
+
+/**
+ * Frees the pixels
+ */
+void Image::free()
+{
+  // Mapped pixels are released by unmapping the file
+  if (_mapping)
+    _mapping.reset();
+  else if (_pixels)
+    stbi_image_free(const_cast<unsigned char*>(_pixels));
+
+  _pixels = nullptr;
+  _width = 0;
+  _height = 0;
+  _channels = 0;
+}
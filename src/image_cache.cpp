@@ -0,0 +1,367 @@
+#include <opengl-module/image_cache.h>
+#include <opengl-module/hash.h>
+#include <opengl-module/image.h>
+#include <opengl-module/mapped_file.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// Starts every cache file, followed by the pixels with rows tightly packed
+struct PixelHeader
+{
+  char magic[4];     // "GLPX"
+  uint32_t version;  // ImageCache::VERSION
+  uint64_t key;      // The key, checked in case two keys ever share a file name
+  uint32_t width;    // The width, in pixels
+  uint32_t height;   // The height, in pixels
+  uint32_t channels; // The channels per pixel
+  uint32_t reserved; // Keeps the pixels 32 byte aligned in the mapping
+};
+
+// Starts the index file, followed by an IndexEntry per cache file
+struct IndexHeader
+{
+  char magic[4];    // "GLIX"
+  uint32_t version; // The index layout, independent of ImageCache::VERSION so old files are still trimmed
+  uint64_t clock;   // The use counter when the index was saved
+  uint64_t count;   // The number of entries
+};
+
+// One cache file in the index
+struct IndexEntry
+{
+  uint64_t key;      // The key the file is stored under
+  uint64_t size;     // The size of the file, in bytes
+  uint64_t lastUsed; // The use counter when the file was last read or written
+};
+
+/**
+ * Gets a temporary file name next to a path, to write to before renaming it into place
+ * Unique across processes as well as threads, so two writers never share a partial file
+ *
+ * @param path: The file that will be replaced
+ */
+static std::string temporaryPath(const std::string& path)
+{
+  static std::atomic<uint64_t> counter(0);
+  uint64_t index = counter.fetch_add(1, std::memory_order_relaxed);
+  return path + "." + Hash::toHex((uint64_t)getpid()) + "." + Hash::toHex(index) + ".tmp";
+}
+
+// Saves the index
+ImageCache::~ImageCache()
+{
+  save();
+}
+
+/**
+ * Sets where decoded images are cached and reads the index stored there
+ *
+ * @param directory: An existing directory to store decoded images in, or empty to not cache them
+ * @param maxBytes:  The size the cache is trimmed to, least recently used images first
+ */
+void ImageCache::init(const std::string& directory, size_t maxBytes)
+{
+  // Keep what the old directory's index learned
+  save();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _directory = directory;
+  if (!_directory.empty() && _directory.back() != '/' && _directory.back() != '\\')
+    _directory += '/';
+
+  _maxBytes = maxBytes;
+  _entries.clear();
+  _totalBytes = 0;
+  _clock = 0;
+  _dirty = false;
+
+  if (_directory.empty())
+    return;
+
+  FILE* file = fopen((_directory + "index.glix").c_str(), "rb");
+  if (!file)
+    return;
+
+  IndexHeader header;
+  if (fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "GLIX", 4) == 0 && header.version == 1)
+  {
+    _clock = header.clock;
+
+    IndexEntry entry;
+    for (uint64_t i = 0; i < header.count && fread(&entry, sizeof(entry), 1, file) == 1; i++)
+    {
+      _entries[entry.key] = { entry.size, entry.lastUsed };
+      _totalBytes += entry.size;
+    }
+  }
+
+  fclose(file);
+
+  // The limit may have shrunk since the index was saved
+  trim();
+}
+
+/**
+ * Loads an image, mapping its pixels from the cache if it was decoded before
+ * Behaves like Image::load() when caching is off
+ *
+ * @param path:     The image file to load
+ * @param image:    Filled with the pixels
+ * @param flip:     Flip the rows, so the first row is the bottom of the image like GL expects
+ * @param channels: The channels to convert to, or 0 to keep the file's
+ *
+ * @returns: True if the image was mapped or decoded
+ */
+bool ImageCache::load(const std::string& path, Image& image, bool flip, int channels)
+{
+  if (_directory.empty())
+    return image.load(path, flip, channels);
+
+  GL_TRACE_ZONE("ImageCache::load");
+
+  // The source is mapped to hash it, and decoded from the same mapping on a miss
+  MappedFile source;
+  if (!source.open(path))
+    return false;
+
+  uint64_t key = Hash::compute(source.getData(), source.getSize(), VERSION);
+  key = Hash::combine(key, flip);
+  key = Hash::combine(key, (uint64_t)channels);
+
+  if (read(key, image))
+  {
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  {
+    GL_TRACE_ZONE("ImageCache::decode");
+
+    if (!image.loadFromMemory(source.getData(), source.getSize(), flip, channels))
+    {
+      std::cerr << "ERROR::IMAGE_CACHE::DECODE_FAILED: " << path << "\n";
+      return false;
+    }
+  }
+
+  _misses.fetch_add(1, std::memory_order_relaxed);
+  write(key, image);
+  return true;
+}
+
+/**
+ * Writes the index, if it changed
+ * Called when the cache is destroyed, call it sooner to keep the index if the process may not exit cleanly
+ */
+void ImageCache::save()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (!_dirty || _directory.empty())
+    return;
+
+  std::string path = _directory + "index.glix";
+  std::string temporary = temporaryPath(path);
+
+  FILE* file = fopen(temporary.c_str(), "wb");
+  if (!file)
+  {
+    std::cerr << "ERROR::IMAGE_CACHE::INDEX_WRITE_FAILED: " << path << "\n";
+    return;
+  }
+
+  IndexHeader header;
+  memcpy(header.magic, "GLIX", 4);
+  header.version = 1;
+  header.clock = _clock;
+  header.count = _entries.size();
+
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+  for (const std::pair<const uint64_t, Entry>& entry : _entries)
+  {
+    IndexEntry stored = { entry.first, entry.second.size, entry.second.lastUsed };
+    written = written && fwrite(&stored, sizeof(stored), 1, file) == 1;
+  }
+
+  written = fclose(file) == 0 && written;
+
+  if (!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+  {
+    std::cerr << "ERROR::IMAGE_CACHE::INDEX_WRITE_FAILED: " << path << "\n";
+    std::remove(temporary.c_str());
+    return;
+  }
+
+  _dirty = false;
+}
+
+/**
+ * Gets the size of the cache
+ *
+ * @returns: The size of every cache file in the index, in bytes
+ */
+uint64_t ImageCache::getSize()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _totalBytes;
+}
+
+/**
+ * Gets the cache file for a key
+ *
+ * @param key: The key
+ */
+std::string ImageCache::cachePath(uint64_t key) const
+{
+  return _directory + Hash::toHex(key) + ".glpx";
+}
+
+/**
+ * Maps a cached image
+ *
+ * @param key:   The key it was stored under
+ * @param image: Filled with the pixels
+ *
+ * @returns: True if the file existed and was complete
+ */
+bool ImageCache::read(uint64_t key, Image& image)
+{
+  // Only files in the index are looked for, so a miss costs no failed open
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_entries.find(key) == _entries.end())
+      return false;
+  }
+
+  std::unique_ptr<MappedFile> file(new MappedFile());
+  bool valid = file->open(cachePath(key)) && file->getSize() >= sizeof(PixelHeader);
+
+  if (valid)
+  {
+    PixelHeader header;
+    memcpy(&header, file->getData(), sizeof(header));
+
+    valid = memcmp(header.magic, "GLPX", 4) == 0 && header.version == VERSION && header.key == key &&
+            image.loadFromMapping(std::move(file), sizeof(header), (int)header.width, (int)header.height, (int)header.channels);
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  std::unordered_map<uint64_t, Entry>::iterator entry = _entries.find(key);
+  if (entry == _entries.end())
+    return valid;
+
+  // A missing or damaged file is dropped, and written again once the image is decoded
+  if (valid)
+    entry->second.lastUsed = ++_clock;
+  else
+  {
+    _totalBytes -= entry->second.size;
+    _entries.erase(entry);
+  }
+
+  _dirty = true;
+  return valid;
+}
+
+/**
+ * Stores a decoded image and trims the cache
+ * Written to a temporary file first, so other threads and processes never read a partial one
+ *
+ * @param key:   The key to store it under
+ * @param image: The decoded image
+ */
+void ImageCache::write(uint64_t key, const Image& image)
+{
+  // It would be trimmed straight away
+  if (sizeof(PixelHeader) + image.getSize() > _maxBytes)
+    return;
+
+  GL_TRACE_ZONE("ImageCache::write");
+
+  std::string path = cachePath(key);
+  std::string temporary = temporaryPath(path);
+
+  FILE* file = fopen(temporary.c_str(), "wb");
+  if (!file)
+  {
+    std::cerr << "ERROR::IMAGE_CACHE::CACHE_WRITE_FAILED: " << path << "\n";
+    return;
+  }
+
+  PixelHeader header;
+  memcpy(header.magic, "GLPX", 4);
+  header.version = VERSION;
+  header.key = key;
+  header.width = (uint32_t)image.getWidth();
+  header.height = (uint32_t)image.getHeight();
+  header.channels = (uint32_t)image.getChannels();
+  header.reserved = 0;
+
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+  written = written && fwrite(image.getPixels(), 1, image.getSize(), file) == image.getSize();
+  written = fclose(file) == 0 && written;
+
+  // Renaming fails on some platforms if another thread stored the same image first, which is just as good
+  if (!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+  {
+    std::remove(temporary.c_str());
+
+    if (!written)
+    {
+      std::cerr << "ERROR::IMAGE_CACHE::CACHE_WRITE_FAILED: " << path << "\n";
+      return;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  Entry& entry = _entries[key];
+  _totalBytes -= entry.size;
+  entry.size = sizeof(header) + image.getSize();
+  entry.lastUsed = ++_clock;
+  _totalBytes += entry.size;
+  _dirty = true;
+
+  trim();
+}
+
+/**
+ * Deletes the least recently used files until the cache fits its limit
+ * The mutex must be held
+ */
+void ImageCache::trim()
+{
+  if (_totalBytes <= _maxBytes)
+    return;
+
+  std::vector<std::pair<uint64_t, uint64_t>> byAge;
+  byAge.reserve(_entries.size());
+  for (const std::pair<const uint64_t, Entry>& entry : _entries)
+    byAge.push_back(std::make_pair(entry.second.lastUsed, entry.first));
+
+  std::sort(byAge.begin(), byAge.end());
+
+  // Images still using a file keep it mapped, it is only freed once they let go of it
+  for (size_t i = 0; i < byAge.size() && _totalBytes > _maxBytes; i++)
+  {
+    std::remove(cachePath(byAge[i].second).c_str());
+    _totalBytes -= _entries[byAge[i].second].size;
+    _entries.erase(byAge[i].second);
+  }
+
+  _dirty = true;
+}
@@ -0,0 +1,141 @@
+#include <opengl-module/latency.h>
+#include <GLFW/glfw3.h>
+
+/**
+ * Creates the timestamp queries and calibrates the GPU clock
+ * Must be called with a current context
+ */
+void LatencyTracker::init()
+{
+  if (_init)
+    return;
+
+  for (Frame& frame : _frames)
+  {
+    glGenQueries(1, &frame.query);
+    frame.fence = nullptr;
+  }
+
+  calibrate();
+  _init = true;
+}
+
+/**
+ * Deletes the queries and any fences still pending
+ * Must be called with a current context
+ */
+void LatencyTracker::destroy()
+{
+  if (!_init)
+    return;
+
+  for (Frame& frame : _frames)
+  {
+    if (frame.fence)
+      glDeleteSync(frame.fence);
+
+    glDeleteQueries(1, &frame.query);
+    frame = Frame();
+  }
+
+  _init = false;
+}
+
+/**
+ * Records the end of the current frame
+ * Should be called right after glfwSwapBuffers returns
+ * Resolves any older frames whose fence has signaled
+ *
+ * @param inputTime: The glfwGetTime() when input was last sampled for this frame
+ */
+void LatencyTracker::endFrame(double inputTime)
+{
+  if (!_init)
+    return;
+
+  double swapTime = glfwGetTime();
+
+  // Resolve every frame the GPU has finished, without waiting on the rest
+  // The slot about to be reused holds the oldest frame, so walking from it keeps the samples in frame order,
+  // and the GPU finishes frames in order, so the first unfinished one ends the walk
+  for (int i = 0; i < FRAMES_IN_FLIGHT; i++)
+  {
+    Frame& pending = _frames[(_current + i) % FRAMES_IN_FLIGHT];
+    if (!pending.fence)
+      continue;
+
+    GLenum status = glClientWaitSync(pending.fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+      break;
+
+    resolve(pending);
+  }
+
+  Frame& frame = _frames[_current];
+
+  // The GPU is more than FRAMES_IN_FLIGHT frames behind, so wait for the oldest frame
+  if (frame.fence)
+  {
+    glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    resolve(frame);
+  }
+
+  frame.inputTime = inputTime;
+  frame.swapTime = swapTime;
+  glQueryCounter(frame.query, GL_TIMESTAMP);
+  frame.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  _current = (_current + 1) % FRAMES_IN_FLIGHT;
+
+  if (++_framesSinceCalibration >= CALIBRATION_INTERVAL)
+    calibrate();
+}
+
+/**
+ * Reads back a frame's GPU timestamp and updates the statistics
+ *
+ * @param frame: The frame to resolve, its fence must have signaled
+ */
+void LatencyTracker::resolve(Frame& frame)
+{
+  GLuint64 gpuTime = 0;
+  glGetQueryObjectui64v(frame.query, GL_QUERY_RESULT, &gpuTime);
+
+  glDeleteSync(frame.fence);
+  frame.fence = nullptr;
+
+  double completeTime = gpuTime * 1e-9 + _gpuToCpuOffset;
+
+  _inputToSwap = frame.swapTime - frame.inputTime;
+  _inputToGpu = completeTime - frame.inputTime;
+
+  // Seed the averages with the first sample so they don't ramp up from zero
+  if (_samples == 0)
+  {
+    _avgInputToSwap = _inputToSwap;
+    _avgInputToGpu = _inputToGpu;
+  }
+  else
+  {
+    _avgInputToSwap += (_inputToSwap - _avgInputToSwap) * AVERAGE_WEIGHT;
+    _avgInputToGpu += (_inputToGpu - _avgInputToGpu) * AVERAGE_WEIGHT;
+  }
+
+  if (_inputToGpu > _maxInputToGpu)
+    _maxInputToGpu = _inputToGpu;
+
+  _samples++;
+}
+
+/**
+ * Measures the offset between the GPU and CPU clocks
+ */
+void LatencyTracker::calibrate()
+{
+  GLint64 gpuNow = 0;
+  glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+  double cpuNow = glfwGetTime();
+
+  _gpuToCpuOffset = cpuNow - gpuNow * 1e-9;
+  _framesSinceCalibration = 0;
+}
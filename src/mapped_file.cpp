@@ -0,0 +1,121 @@
+#include <opengl-module/mapped_file.h>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Unmaps the file
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+/**
+ * Maps a file, unmapping the one mapped before
+ *
+ * @param path: The file to map
+ *
+ * @returns: True if the file was mapped
+ */
+bool MappedFile::open(const std::string& path)
+{
+  close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::OPEN_FAILED: " << path << "\n";
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::EMPTY: " << path << "\n";
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  if (!data)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::MAP_FAILED: " << path << "\n";
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  _file = file;
+  _mapping = mapping;
+  _data = (const unsigned char*)data;
+  _size = (size_t)size.QuadPart;
+#else
+  int file = ::open(path.c_str(), O_RDONLY);
+  if (file < 0)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::OPEN_FAILED: " << path << "\n";
+    return false;
+  }
+
+  struct stat info;
+  if (fstat(file, &info) != 0 || info.st_size == 0)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::EMPTY: " << path << "\n";
+    ::close(file);
+    return false;
+  }
+
+  void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+  // The mapping keeps the file alive on its own
+  ::close(file);
+
+  if (data == MAP_FAILED)
+  {
+    std::cerr << "ERROR::MAPPED_FILE::MAP_FAILED: " << path << "\n";
+    return false;
+  }
+
+  // The file is read front to back, so ask for read ahead
+  madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+  _data = (const unsigned char*)data;
+  _size = (size_t)info.st_size;
+#endif
+
+  return true;
+}
+
+/**
+ * Unmaps the file
+ * Pointers into the mapping are invalid afterwards
+ */
+void MappedFile::close()
+{
+  if (!_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(_data);
+  CloseHandle(_mapping);
+  CloseHandle(_file);
+  _mapping = nullptr;
+  _file = nullptr;
+#else
+  munmap((void*)_data, _size);
+#endif
+
+  _data = nullptr;
+  _size = 0;
+}
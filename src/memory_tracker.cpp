@@ -0,0 +1,431 @@
+#include <opengl-module/memory_tracker.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+// A tag and the totals it was at when the frame started
+struct MemoryCategory
+{
+  MemoryUsage usage;       // The tag's usage
+  int64_t frameStart = 0;  // The tag's total when the frame started
+  bool overBudget = false; // Tracks if the budget error has been printed
+};
+
+// Every tag, guarded by trackerMutex
+static std::mutex trackerMutex;
+static std::vector<MemoryCategory> categories;
+static std::map<std::string, int> tagIds;
+static int64_t trackerTotal = 0;
+static int64_t trackerHighWater = 0;
+
+static thread_local int currentTag = 0;
+
+/**
+ * Gets the id of a tag, creating it the first time
+ * trackerMutex must be held
+ *
+ * @param name: The tag's name
+ */
+static int getTagLocked(const std::string& name)
+{
+  std::map<std::string, int>::iterator it = tagIds.find(name);
+  if (it != tagIds.end())
+    return it->second;
+
+  MemoryCategory category;
+  category.usage.tag = name;
+  categories.push_back(category);
+
+  int id = (int)categories.size() - 1;
+  tagIds[name] = id;
+  return id;
+}
+
+/**
+ * Gets a tag's category, making sure the untagged category exists
+ * trackerMutex must be held
+ *
+ * @param tag: The tag's id
+ */
+static MemoryCategory& getCategoryLocked(int tag)
+{
+  if (categories.empty())
+    getTagLocked("untagged");
+
+  if (tag < 0 || tag >= (int)categories.size())
+    tag = 0;
+
+  return categories[tag];
+}
+
+/**
+ * Prints a size in the largest unit that keeps it above 1
+ *
+ * @param out:   The stream to print to
+ * @param bytes: The size, in bytes
+ */
+static void printBytes(std::ostream& out, int64_t bytes)
+{
+  double value = (double)bytes;
+  const char* unit = "B";
+
+  if (value >= 1024.0 * 1024.0 * 1024.0 || value <= -1024.0 * 1024.0 * 1024.0)
+  {
+    value /= 1024.0 * 1024.0 * 1024.0;
+    unit = "GB";
+  }
+  else if (value >= 1024.0 * 1024.0 || value <= -1024.0 * 1024.0)
+  {
+    value /= 1024.0 * 1024.0;
+    unit = "MB";
+  }
+  else if (value >= 1024.0 || value <= -1024.0)
+  {
+    value /= 1024.0;
+    unit = "KB";
+  }
+
+  out << std::fixed << std::setprecision(2) << std::setw(11) << value << " " << std::setw(2) << unit;
+}
+
+/**
+ * Gets the id of a tag, creating it the first time
+ * Tag 0 is "untagged", used when no tag has been set
+ *
+ * @param name: The tag's name
+ */
+int MemoryTracker::getTag(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  if (categories.empty())
+    getTagLocked("untagged");
+
+  return getTagLocked(name);
+}
+
+/**
+ * Gets the calling thread's current tag
+ */
+int MemoryTracker::getCurrentTag()
+{
+  return currentTag;
+}
+
+/**
+ * Sets the calling thread's current tag
+ * Objects created on this thread are counted under it
+ *
+ * @param tag: The tag's id, from getTag()
+ */
+void MemoryTracker::setCurrentTag(int tag)
+{
+  currentTag = tag;
+}
+
+/**
+ * Counts an allocation
+ * Safe to call from any thread
+ *
+ * @param kind:  The kind of object
+ * @param tag:   The tag to count it under
+ * @param bytes: The size of the allocation
+ */
+void MemoryTracker::allocate(MemoryKind kind, int tag, int64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  MemoryCategory& category = getCategoryLocked(tag);
+  MemoryUsage& usage = category.usage;
+  usage.bytes[(int)kind] += bytes;
+  usage.total += bytes;
+  usage.highWater = std::max(usage.highWater, usage.total);
+
+  trackerTotal += bytes;
+  trackerHighWater = std::max(trackerHighWater, trackerTotal);
+
+  if (usage.budget && usage.total > usage.budget && !category.overBudget)
+  {
+    std::cerr << "ERROR::MEMORY_TRACKER::BUDGET_EXCEEDED: " << usage.tag << " is using " << usage.total << " of its " << usage.budget
+              << " byte budget\n";
+    category.overBudget = true;
+  }
+}
+
+/**
+ * Counts a release
+ * Safe to call from any thread
+ *
+ * @param kind:  The kind of object
+ * @param tag:   The tag it was counted under
+ * @param bytes: The size of the allocation
+ */
+void MemoryTracker::release(MemoryKind kind, int tag, int64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  MemoryCategory& category = getCategoryLocked(tag);
+  category.usage.bytes[(int)kind] -= bytes;
+  category.usage.total -= bytes;
+  trackerTotal -= bytes;
+
+  if (category.usage.total <= category.usage.budget)
+    category.overBudget = false;
+}
+
+/**
+ * Sets a budget for a tag
+ * An error is printed the first time the tag goes over it, and again if it drops back under and goes over again
+ *
+ * @param name:  The tag's name
+ * @param bytes: The budget, 0 for none
+ */
+void MemoryTracker::setBudget(const std::string& name, int64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  if (categories.empty())
+    getTagLocked("untagged");
+
+  MemoryCategory& category = categories[getTagLocked(name)];
+  category.usage.budget = bytes;
+  category.overBudget = false;
+}
+
+/**
+ * Ends the frame for the per frame deltas
+ * Called by GL every frame
+ */
+void MemoryTracker::endFrame()
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  for (MemoryCategory& category : categories)
+  {
+    category.usage.frameDelta = category.usage.total - category.frameStart;
+    category.frameStart = category.usage.total;
+  }
+}
+
+/**
+ * Gets the memory used by every tag
+ */
+std::vector<MemoryUsage> MemoryTracker::getUsage()
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+
+  std::vector<MemoryUsage> usage;
+  for (const MemoryCategory& category : categories)
+    usage.push_back(category.usage);
+
+  return usage;
+}
+
+/**
+ * Gets the bytes currently allocated under every tag
+ */
+int64_t MemoryTracker::getTotal()
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+  return trackerTotal;
+}
+
+/**
+ * Gets the most bytes allocated at once under every tag
+ */
+int64_t MemoryTracker::getHighWater()
+{
+  std::lock_guard<std::mutex> lock(trackerMutex);
+  return trackerHighWater;
+}
+
+/**
+ * Prints the memory used by every tag
+ *
+ * @param out: The stream to print to
+ */
+void MemoryTracker::printReport(std::ostream& out)
+{
+  std::vector<MemoryUsage> usage = getUsage();
+
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+
+  out << "GL memory by tag:\n";
+  out << "  " << std::left << std::setw(20) << "tag" << std::right << std::setw(14) << "buffers" << std::setw(14) << "textures"
+      << std::setw(14) << "renderbuffers" << std::setw(14) << "programs" << std::setw(14) << "total" << std::setw(14) << "high water"
+      << std::setw(14) << "last frame" << std::setw(14) << "budget" << "\n";
+
+  for (const MemoryUsage& tag : usage)
+  {
+    out << "  " << std::left << std::setw(20) << tag.tag << std::right;
+    for (int kind = 0; kind < (int)MemoryKind::Count; kind++)
+      printBytes(out, tag.bytes[kind]);
+
+    printBytes(out, tag.total);
+    printBytes(out, tag.highWater);
+    printBytes(out, tag.frameDelta);
+    printBytes(out, tag.budget);
+    out << (tag.budget && tag.total > tag.budget ? "  OVER BUDGET" : "") << "\n";
+  }
+
+  out << "  total ";
+  printBytes(out, getTotal());
+  out << ", high water ";
+  printBytes(out, getHighWater());
+  out << "\n";
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+/**
+ * Computes the size of a texture's storage
+ *
+ * @param internalFormat: The sized internal format
+ * @param width:          The width of the base level, in pixels
+ * @param height:         The height of the base level, in pixels
+ * @param levels:         The number of mip levels
+ * @param layers:         The number of array layers or cube faces
+ *
+ * @returns: The size, in bytes
+ */
+int64_t MemoryTracker::textureBytes(GLenum internalFormat, int width, int height, int levels, int layers)
+{
+  int bitsPerPixel = 0; // For uncompressed formats
+  int blockBytes = 0;   // For formats compressed in 4x4 blocks
+
+  switch (internalFormat)
+  {
+    case GL_R8:
+    case GL_R8_SNORM:
+    case GL_R8I:
+    case GL_R8UI:
+    case GL_STENCIL_INDEX8:
+      bitsPerPixel = 8;
+      break;
+
+    case GL_RG8:
+    case GL_RG8_SNORM:
+    case GL_R16:
+    case GL_R16F:
+    case GL_R16I:
+    case GL_R16UI:
+    case GL_RGB565:
+    case GL_RGBA4:
+    case GL_RGB5_A1:
+    case GL_DEPTH_COMPONENT16:
+      bitsPerPixel = 16;
+      break;
+
+    case GL_RGB8:
+    case GL_SRGB8:
+    case GL_DEPTH_COMPONENT24:
+      bitsPerPixel = 24;
+      break;
+
+    case GL_RGBA8:
+    case GL_RGBA8_SNORM:
+    case GL_SRGB8_ALPHA8:
+    case GL_RGB10_A2:
+    case GL_R11F_G11F_B10F:
+    case GL_RGB9_E5:
+    case GL_RG16:
+    case GL_RG16F:
+    case GL_R32F:
+    case GL_R32I:
+    case GL_R32UI:
+    case GL_RGBA8I:
+    case GL_RGBA8UI:
+    case GL_DEPTH24_STENCIL8:
+    case GL_DEPTH_COMPONENT32:
+    case GL_DEPTH_COMPONENT32F:
+      bitsPerPixel = 32;
+      break;
+
+    case GL_DEPTH32F_STENCIL8:
+    case GL_RGBA16:
+    case GL_RGBA16F:
+    case GL_RG32F:
+    case GL_RGBA16I:
+    case GL_RGBA16UI:
+      bitsPerPixel = 64;
+      break;
+
+    case GL_RGB16F:
+      bitsPerPixel = 48;
+      break;
+
+    case GL_RGB32F:
+      bitsPerPixel = 96;
+      break;
+
+    case GL_RGBA32F:
+    case GL_RGBA32I:
+    case GL_RGBA32UI:
+      bitsPerPixel = 128;
+      break;
+
+    // BC1 and BC4, the S3TC enums aren't in the core profile headers
+    case 0x83F0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    case 0x83F1: // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    case 0x8C4C: // GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+    case 0x8C4D: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1:
+    case GL_COMPRESSED_RGB8_ETC2:
+    case GL_COMPRESSED_SRGB8_ETC2:
+      blockBytes = 8;
+      break;
+
+    // BC2, BC3, BC5 and BC7
+    case 0x83F2: // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+    case 0x83F3: // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    case 0x8C4E: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT
+    case 0x8C4F: // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+    case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+    case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+    case GL_COMPRESSED_RGBA8_ETC2_EAC:
+    case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+      blockBytes = 16;
+      break;
+
+    default:
+      // Assume the most common size rather than not counting it at all
+      bitsPerPixel = 32;
+      break;
+  }
+
+  int64_t bytes = 0;
+  for (int level = 0; level < levels; level++)
+  {
+    int64_t levelWidth = std::max(1, width >> level);
+    int64_t levelHeight = std::max(1, height >> level);
+
+    if (blockBytes)
+      bytes += ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * blockBytes;
+    else
+      bytes += (levelWidth * levelHeight * bitsPerPixel + 7) / 8;
+  }
+
+  return bytes * layers;
+}
+
+/**
+ * Gets the size of a linked program's binary, as an estimate of the memory it uses
+ * Must be called with a current context
+ *
+ * @param program: The program
+ */
+int64_t MemoryTracker::programBytes(GLuint program)
+{
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  return length;
+}
@@ -0,0 +1,510 @@
+#include <opengl-module/mipmap.h>
+#include <opengl-module/image.h>
+#include <opengl-module/thread_pool.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// Pick the widest vector instructions the compiler was allowed to use, see OPENGL_MODULE_AVX2
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MIPMAP_AVX2
+#define MIPMAP_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MIPMAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MIPMAP_NEON
+#endif
+
+// The Kaiser filter's half width, in pixels of the smaller level
+static const float KAISER_RADIUS = 3.0f;
+
+// The Kaiser window's shape, higher trades sharpness for less ringing
+static const double KAISER_ALPHA = 4.0;
+
+// Rows of a level given to each task when a level is split across the pool
+static const int ROWS_PER_TASK = 32;
+
+// Converts between sRGB and linear values
+struct SrgbTables
+{
+  uint16_t toLinear[256];         // sRGB to linear, 16 bit fixed point
+  float toLinearFloat[256];       // sRGB to linear, 0 to 1
+  unsigned char fromLinear[4096]; // Linear to sRGB, indexed by the top 12 bits of a 16 bit linear value
+
+  SrgbTables()
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      double c = i / 255.0;
+      double linear = c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+      toLinear[i] = (uint16_t)std::lround(linear * 65535.0);
+      toLinearFloat[i] = (float)linear;
+    }
+
+    for (int i = 0; i < 4096; i++)
+    {
+      // Sample the middle of each bucket
+      double linear = (i + 0.5) / 4096.0;
+      double c = linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+      fromLinear[i] = (unsigned char)std::lround(std::min(std::max(c, 0.0), 1.0) * 255.0);
+    }
+  }
+};
+
+// Gets the sRGB tables, built on first use
+static const SrgbTables& srgbTables()
+{
+  static const SrgbTables tables;
+  return tables;
+}
+
+/**
+ * Box filters the start of a row of a 4 channel, non sRGB level with vector instructions
+ *
+ * @param row0:     The first source row
+ * @param row1:     The second source row
+ * @param dst:      The destination row
+ * @param dstWidth: The width of the destination, every source pixel it reads must exist
+ *
+ * @returns: The number of destination pixels written
+ */
+static int boxRowSimd(const unsigned char* row0, const unsigned char* row1, unsigned char* dst, int dstWidth)
+{
+  int x = 0;
+
+#ifdef MIPMAP_AVX2
+  const __m256i zero256 = _mm256_setzero_si256();
+  const __m256i two256 = _mm256_set1_epi16(2);
+
+  // 8 source pixels into 4, the unpacks work within each 128 bit lane
+  for (; x + 4 <= dstWidth; x += 4)
+  {
+    __m256i a = _mm256_loadu_si256((const __m256i*)(row0 + x * 8));
+    __m256i b = _mm256_loadu_si256((const __m256i*)(row1 + x * 8));
+
+    __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero256), _mm256_unpacklo_epi8(b, zero256));
+    __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero256), _mm256_unpackhi_epi8(b, zero256));
+    __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+    sum = _mm256_srli_epi16(_mm256_add_epi16(sum, two256), 2);
+
+    // Each lane holds two results twice, gather one copy of each into the low half
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128((__m128i*)(dst + x * 4), _mm256_castsi256_si128(packed));
+  }
+#endif
+
+#ifdef MIPMAP_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i two = _mm_set1_epi16(2);
+
+  // 4 source pixels into 2
+  for (; x + 2 <= dstWidth; x += 2)
+  {
+    __m128i a = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+    __m128i b = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+
+    // Sum the rows as 16 bit values, then add each pixel to its right neighbor
+    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+    sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+
+    _mm_storel_epi64((__m128i*)(dst + x * 4), _mm_packus_epi16(sum, sum));
+  }
+#endif
+
+#ifdef MIPMAP_NEON
+  // 16 source pixels into 8, deinterleaved so each channel is summed in pairs
+  for (; x + 8 <= dstWidth; x += 8)
+  {
+    uint8x16x4_t a = vld4q_u8(row0 + x * 8);
+    uint8x16x4_t b = vld4q_u8(row1 + x * 8);
+    uint8x8x4_t out;
+
+    out.val[0] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[0]), vpaddlq_u8(b.val[0])), 2);
+    out.val[1] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[1]), vpaddlq_u8(b.val[1])), 2);
+    out.val[2] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[2]), vpaddlq_u8(b.val[2])), 2);
+    out.val[3] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[3]), vpaddlq_u8(b.val[3])), 2);
+
+    vst4_u8(dst + x * 4, out);
+  }
+#endif
+
+  (void)row0;
+  (void)row1;
+  (void)dst;
+  return x;
+}
+
+/**
+ * Box filters one row of a level from the level above it
+ * Odd sizes drop the last row or column, a size of 1 reuses its only row or column
+ *
+ * @param src:       The level above
+ * @param srcWidth:  Its width, in pixels
+ * @param srcHeight: Its height, in pixels
+ * @param channels:  The channels per pixel
+ * @param srgb:      Average the color channels in linear space
+ * @param dst:       The level being built
+ * @param dstWidth:  Its width, in pixels
+ * @param y:         The row to build
+ */
+static void boxRow(const unsigned char* src, int srcWidth, int srcHeight, int channels, bool srgb, unsigned char* dst, int dstWidth, int y)
+{
+  size_t srcPitch = (size_t)srcWidth * channels;
+  const unsigned char* row0 = src + std::min(2 * y, srcHeight - 1) * srcPitch;
+  const unsigned char* row1 = src + std::min(2 * y + 1, srcHeight - 1) * srcPitch;
+  unsigned char* out = dst + (size_t)y * dstWidth * channels;
+
+  int colorChannels = srgb && channels >= 3 ? 3 : 0;
+
+  int x = 0;
+  if (colorChannels == 0 && channels == 4 && srcWidth >= 2)
+    x = boxRowSimd(row0, row1, out, dstWidth);
+
+  const SrgbTables& tables = srgbTables();
+
+  for (; x < dstWidth; x++)
+  {
+    int x0 = std::min(2 * x, srcWidth - 1) * channels;
+    int x1 = std::min(2 * x + 1, srcWidth - 1) * channels;
+
+    for (int c = 0; c < channels; c++)
+    {
+      if (c < colorChannels)
+      {
+        uint32_t sum = tables.toLinear[row0[x0 + c]] + tables.toLinear[row0[x1 + c]] + tables.toLinear[row1[x0 + c]] + tables.toLinear[row1[x1 + c]];
+        out[x * channels + c] = tables.fromLinear[((sum + 2) >> 2) >> 4];
+      }
+      else
+      {
+        int sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+        out[x * channels + c] = (unsigned char)((sum + 2) >> 2);
+      }
+    }
+  }
+}
+
+/**
+ * Computes the zeroth order modified Bessel function of the first kind, for the Kaiser window
+ *
+ * @param x: The argument
+ */
+static double besselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; k < 32; k++)
+  {
+    double factor = x / (2.0 * k);
+    term *= factor * factor;
+    sum += term;
+    if (term < sum * 1e-12)
+      break;
+  }
+
+  return sum;
+}
+
+// The taps of a 1D Kaiser filter, from one size to a smaller one
+struct FilterTaps
+{
+  int count = 0;              // Taps per destination pixel
+  std::vector<int> indices;   // The source pixel of each tap, clamped to the edges
+  std::vector<float> weights; // The weight of each tap, normalized per destination pixel
+};
+
+/**
+ * Builds the Kaiser windowed sinc taps for resampling along one axis
+ *
+ * @param srcSize: The size of the larger level
+ * @param dstSize: The size of the smaller level
+ */
+static FilterTaps kaiserTaps(int srcSize, int dstSize)
+{
+  FilterTaps taps;
+  double scale = (double)srcSize / dstSize;
+  double support = KAISER_RADIUS * scale;
+  double windowScale = 1.0 / besselI0(KAISER_ALPHA);
+  const double pi = 3.14159265358979323846;
+
+  taps.count = (int)std::ceil(2.0 * support) + 1;
+  taps.indices.resize((size_t)dstSize * taps.count);
+  taps.weights.resize((size_t)dstSize * taps.count);
+
+  for (int d = 0; d < dstSize; d++)
+  {
+    double center = (d + 0.5) * scale;
+    int first = (int)std::floor(center - support);
+    double total = 0.0;
+
+    for (int i = 0; i < taps.count; i++)
+    {
+      int s = first + i;
+
+      // Distance from the center, in pixels of the smaller level
+      double t = (s + 0.5 - center) / scale;
+      double weight = 0.0;
+      if (std::fabs(t) < KAISER_RADIUS)
+      {
+        double ratio = t / KAISER_RADIUS;
+        double sinc = t == 0.0 ? 1.0 : std::sin(pi * t) / (pi * t);
+        weight = sinc * besselI0(KAISER_ALPHA * std::sqrt(1.0 - ratio * ratio)) * windowScale;
+      }
+
+      taps.indices[(size_t)d * taps.count + i] = std::min(std::max(s, 0), srcSize - 1);
+      taps.weights[(size_t)d * taps.count + i] = (float)weight;
+      total += weight;
+    }
+
+    for (int i = 0; i < taps.count; i++)
+      taps.weights[(size_t)d * taps.count + i] = (float)(taps.weights[(size_t)d * taps.count + i] / total);
+  }
+
+  return taps;
+}
+
+/**
+ * Filters one row along x
+ * The channel count is a template argument, so the compiler unrolls and vectorizes the channels of each tap
+ *
+ * @param in:       The source row, as linear floats
+ * @param out:      The destination row
+ * @param dstWidth: The width of the destination, in pixels
+ * @param taps:     The filter taps from the source width to dstWidth
+ */
+template <int CHANNELS>
+static void kaiserRow(const float* in, float* out, int dstWidth, const FilterTaps& taps)
+{
+  for (int x = 0; x < dstWidth; x++)
+  {
+    const int* indices = &taps.indices[(size_t)x * taps.count];
+    const float* weights = &taps.weights[(size_t)x * taps.count];
+
+    float sum[CHANNELS] = {};
+    for (int i = 0; i < taps.count; i++)
+    {
+      const float* pixel = in + indices[i] * CHANNELS;
+      float weight = weights[i];
+      for (int c = 0; c < CHANNELS; c++)
+        sum[c] += pixel[c] * weight;
+    }
+
+    for (int c = 0; c < CHANNELS; c++)
+      out[x * CHANNELS + c] = sum[c];
+  }
+}
+
+/**
+ * Builds a mip chain with a separable Kaiser filter
+ * Levels are filtered in floating point from the unquantized level above, so errors don't build up down the chain
+ *
+ * @param pixels:   The top level
+ * @param width:    Its width, in pixels
+ * @param height:   Its height, in pixels
+ * @param channels: The channels per pixel
+ * @param srgb:     Filter the color channels in linear space
+ * @param pool:     The pool to split rows across, or nullptr
+ * @param levels:   Filled with the levels below the top one
+ */
+static void kaiserChain(const unsigned char* pixels, int width, int height, int channels, bool srgb, ThreadPool* pool, std::vector<MipLevel>& levels)
+{
+  const SrgbTables& tables = srgbTables();
+  int colorChannels = srgb && channels >= 3 ? 3 : 0;
+
+  // The level being filtered, as linear floats
+  std::vector<float> source((size_t)width * height * channels);
+  ThreadPool::parallelFor(pool, height, ROWS_PER_TASK, [&](int start, int end) {
+    for (size_t p = (size_t)start * width; p < (size_t)end * width; p++)
+    {
+      for (int c = 0; c < channels; c++)
+      {
+        size_t i = p * channels + c;
+        source[i] = c < colorChannels ? tables.toLinearFloat[pixels[i]] : pixels[i] / 255.0f;
+      }
+    }
+  });
+
+  std::vector<float> horizontal;
+  std::vector<float> destination;
+
+  int srcWidth = width;
+  int srcHeight = height;
+
+  for (MipLevel& level : levels)
+  {
+    int dstWidth = level.width;
+    int dstHeight = level.height;
+
+    FilterTaps columns = kaiserTaps(srcWidth, dstWidth);
+    FilterTaps rows = kaiserTaps(srcHeight, dstHeight);
+
+    // Filter along x, keeping every source row
+    horizontal.assign((size_t)dstWidth * srcHeight * channels, 0.0f);
+    ThreadPool::parallelFor(pool, srcHeight, ROWS_PER_TASK, [&](int start, int end) {
+      for (int y = start; y < end; y++)
+      {
+        const float* in = &source[(size_t)y * srcWidth * channels];
+        float* out = &horizontal[(size_t)y * dstWidth * channels];
+
+        switch (channels)
+        {
+        case 1:
+          kaiserRow<1>(in, out, dstWidth, columns);
+          break;
+        case 2:
+          kaiserRow<2>(in, out, dstWidth, columns);
+          break;
+        case 3:
+          kaiserRow<3>(in, out, dstWidth, columns);
+          break;
+        default:
+          kaiserRow<4>(in, out, dstWidth, columns);
+          break;
+        }
+      }
+    });
+
+    // Filter along y, then quantize
+    destination.assign((size_t)dstWidth * dstHeight * channels, 0.0f);
+    level.pixels.resize(destination.size());
+    ThreadPool::parallelFor(pool, dstHeight, ROWS_PER_TASK, [&](int start, int end) {
+      size_t pitch = (size_t)dstWidth * channels;
+
+      for (int y = start; y < end; y++)
+      {
+        const int* indices = &rows.indices[(size_t)y * rows.count];
+        const float* weights = &rows.weights[(size_t)y * rows.count];
+        float* out = &destination[y * pitch];
+
+        for (int i = 0; i < rows.count; i++)
+        {
+          const float* in = &horizontal[indices[i] * pitch];
+          float weight = weights[i];
+          for (size_t j = 0; j < pitch; j++)
+            out[j] += in[j] * weight;
+        }
+
+        unsigned char* quantized = &level.pixels[y * pitch];
+        for (size_t j = 0; j < pitch; j += channels)
+        {
+          for (int c = 0; c < channels; c++)
+          {
+            // The negative lobes can overshoot
+            float value = std::min(std::max(out[j + c], 0.0f), 1.0f);
+            if (c < colorChannels)
+              quantized[j + c] = tables.fromLinear[std::min((int)(value * 4096.0f), 4095)];
+            else
+              quantized[j + c] = (unsigned char)(value * 255.0f + 0.5f);
+          }
+        }
+      }
+    });
+
+    source.swap(destination);
+    srcWidth = dstWidth;
+    srcHeight = dstHeight;
+  }
+}
+
+/**
+ * Builds every level below the top one, down to 1x1
+ * Each level is half the size of the one above it, rounded down
+ *
+ * @param pixels:   The top level, 8 bits per channel with rows tightly packed
+ * @param width:    The width of the top level, in pixels
+ * @param height:   The height of the top level, in pixels
+ * @param channels: The channels per pixel, 1 to 4
+ * @param srgb:     Filter the color channels in linear space, for sRGB images with 3 or 4 channels
+ * @param filter:   The filter to use
+ * @param pool:     Splits each level's rows across the pool, or nullptr to do it all on the calling thread
+ *                  Must be nullptr when called from one of the pool's tasks
+ *
+ * @returns: The levels, from the largest to 1x1
+ */
+std::vector<MipLevel> MipGenerator::generate(const unsigned char* pixels, int width, int height, int channels, bool srgb, MipFilter filter, ThreadPool* pool)
+{
+  GL_TRACE_ZONE("MipGenerator::generate");
+
+  std::vector<MipLevel> levels;
+  if (!pixels || width < 1 || height < 1 || channels < 1 || channels > 4)
+    return levels;
+
+  // Size every level up front, the same chain glTextureStorage2D allocates
+  for (int w = width, h = height; w > 1 || h > 1;)
+  {
+    w = std::max(1, w / 2);
+    h = std::max(1, h / 2);
+
+    MipLevel level;
+    level.width = w;
+    level.height = h;
+    levels.push_back(std::move(level));
+  }
+
+  if (filter == MipFilter::Kaiser)
+  {
+    kaiserChain(pixels, width, height, channels, srgb, pool, levels);
+    return levels;
+  }
+
+  const unsigned char* src = pixels;
+  int srcWidth = width;
+  int srcHeight = height;
+
+  for (MipLevel& level : levels)
+  {
+    level.pixels.resize((size_t)level.width * level.height * channels);
+    unsigned char* dst = level.pixels.data();
+    int dstWidth = level.width;
+
+    ThreadPool::parallelFor(pool, level.height, ROWS_PER_TASK, [&](int start, int end) {
+      for (int y = start; y < end; y++)
+        boxRow(src, srcWidth, srcHeight, channels, srgb, dst, dstWidth, y);
+    });
+
+    src = dst;
+    srcWidth = level.width;
+    srcHeight = level.height;
+  }
+
+  return levels;
+}
+
+/**
+ * Builds every level below an image, down to 1x1
+ *
+ * @param image:  The top level
+ * @param srgb:   Filter the color channels in linear space, for sRGB images with 3 or 4 channels
+ * @param filter: The filter to use
+ * @param pool:   Splits each level's rows across the pool, or nullptr to do it all on the calling thread
+ *                Must be nullptr when called from one of the pool's tasks
+ *
+ * @returns: The levels, from the largest to 1x1
+ */
+std::vector<MipLevel> MipGenerator::generate(const Image& image, bool srgb, MipFilter filter, ThreadPool* pool)
+{
+  return generate(image.getPixels(), image.getWidth(), image.getHeight(), image.getChannels(), srgb, filter, pool);
+}
+
+/**
+ * Gets the instruction set the box filter was compiled for
+ *
+ * @returns: "AVX2", "SSE2", "NEON" or "scalar"
+ */
+const char* MipGenerator::getSimdName()
+{
+#if defined(MIPMAP_AVX2)
+  return "AVX2";
+#elif defined(MIPMAP_SSE2)
+  return "SSE2";
+#elif defined(MIPMAP_NEON)
+  return "NEON";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,213 @@
+#include <opengl-module/render_targets.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/state_cache.h>
+#include <iostream>
+
+/**
+ * Adds a render target
+ * It is allocated on the next call to update()
+ *
+ * @param name: The name to look the target up by
+ * @param desc: How to allocate the target
+ *
+ * @returns: A handle that can be passed to get()
+ */
+int RenderTargets::add(const std::string& name, const RenderTargetDesc& desc)
+{
+  Entry entry;
+  entry.name = name;
+  entry.desc = desc;
+  entry.memoryTag = MemoryTracker::getCurrentTag();
+  _entries.push_back(entry);
+
+  return (int)_entries.size() - 1;
+}
+
+/**
+ * Gets a render target by name
+ *
+ * @param name: The name given to add()
+ *
+ * @returns: The render target, or nullptr if there is none with that name
+ */
+const RenderTarget* RenderTargets::get(const std::string& name) const
+{
+  for (const Entry& entry : _entries)
+  {
+    if (entry.name == name)
+      return &entry.target;
+  }
+
+  return nullptr;
+}
+
+/**
+ * Records a new framebuffer size
+ * The targets are not reallocated until the size has settled
+ *
+ * @param width:  The new framebuffer width, in pixels
+ * @param height: The new framebuffer height, in pixels
+ */
+void RenderTargets::resize(int width, int height)
+{
+  if (width == _pendingWidth && height == _pendingHeight)
+    return;
+
+  _pendingWidth = width;
+  _pendingHeight = height;
+  _stableFrames = 0;
+}
+
+/**
+ * Allocates new targets and reallocates existing ones once a resize has settled
+ * Called by GL every frame before the render callback
+ */
+void RenderTargets::update()
+{
+  bool sizeChanged = _pendingWidth != _width || _pendingHeight != _height;
+
+  if (sizeChanged)
+  {
+    // Nothing has been allocated yet, so there is no reason to wait
+    bool firstSize = _width == 0 && _height == 0;
+
+    if (!firstSize && _stableFrames++ < _settleFrames)
+      return;
+
+    // A minimized window has a zero sized framebuffer, keep the old targets
+    if (_pendingWidth <= 0 || _pendingHeight <= 0)
+      return;
+
+    _width = _pendingWidth;
+    _height = _pendingHeight;
+
+    for (Entry& entry : _entries)
+      allocate(entry);
+
+    _reallocations++;
+    return;
+  }
+
+  // Allocate any targets added since the last update
+  for (Entry& entry : _entries)
+  {
+    if (!entry.target.framebuffer && _width > 0 && _height > 0)
+      allocate(entry);
+  }
+}
+
+/**
+ * Deletes all of the targets
+ * Must be called with a current context
+ */
+void RenderTargets::destroy()
+{
+  for (Entry& entry : _entries)
+    release(entry);
+
+  _entries.clear();
+  _width = _height = 0;
+}
+
+/**
+ * Allocates the GL objects for a target at the current size
+ *
+ * @param entry: The target to allocate, any existing objects are deleted first
+ */
+void RenderTargets::allocate(Entry& entry)
+{
+  release(entry);
+
+  RenderTarget& target = entry.target;
+  target.width = (int)(_width * entry.desc.scale);
+  target.height = (int)(_height * entry.desc.scale);
+
+  if (target.width < 1)
+    target.width = 1;
+  if (target.height < 1)
+    target.height = 1;
+
+  glCreateFramebuffers(1, &target.framebuffer);
+
+  if (entry.desc.colorFormat)
+  {
+    glCreateTextures(GL_TEXTURE_2D, 1, &target.color);
+    glTextureStorage2D(target.color, 1, entry.desc.colorFormat, target.width, target.height);
+    MemoryTracker::allocate(MemoryKind::Texture, entry.memoryTag,
+                            MemoryTracker::textureBytes(entry.desc.colorFormat, target.width, target.height));
+    glTextureParameteri(target.color, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(target.color, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(target.color, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(target.color, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glNamedFramebufferTexture(target.framebuffer, GL_COLOR_ATTACHMENT0, target.color, 0);
+  }
+  else
+  {
+    glNamedFramebufferDrawBuffer(target.framebuffer, GL_NONE);
+    glNamedFramebufferReadBuffer(target.framebuffer, GL_NONE);
+  }
+
+  if (entry.desc.depthFormat)
+  {
+    // Pick the attachment point that matches the format
+    GLenum attachment = GL_DEPTH_ATTACHMENT;
+    if (entry.desc.depthFormat == GL_DEPTH24_STENCIL8 || entry.desc.depthFormat == GL_DEPTH32F_STENCIL8)
+      attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+    else if (entry.desc.depthFormat == GL_STENCIL_INDEX8)
+      attachment = GL_STENCIL_ATTACHMENT;
+
+    glCreateRenderbuffers(1, &target.depth);
+    glNamedRenderbufferStorage(target.depth, entry.desc.depthFormat, target.width, target.height);
+    MemoryTracker::allocate(MemoryKind::Renderbuffer, entry.memoryTag,
+                            MemoryTracker::textureBytes(entry.desc.depthFormat, target.width, target.height));
+    glNamedFramebufferRenderbuffer(target.framebuffer, attachment, GL_RENDERBUFFER, target.depth);
+  }
+
+  if (Capture::isActive())
+  {
+    Capture::record(CaptureOp::CreateRenderTarget, { target.framebuffer, target.color, target.depth, (uint32_t)target.width, (uint32_t)target.height,
+                                                     entry.desc.colorFormat, entry.desc.depthFormat });
+  }
+
+  GLenum status = glCheckNamedFramebufferStatus(target.framebuffer, GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE)
+  {
+    std::cerr << "ERROR::RENDER_TARGETS::INCOMPLETE_FRAMEBUFFER: " << entry.name
+              << " (status 0x" << std::hex << status << std::dec << ")\n";
+  }
+}
+
+/**
+ * Deletes the GL objects for a target
+ *
+ * @param entry: The target to release
+ */
+void RenderTargets::release(Entry& entry)
+{
+  RenderTarget& target = entry.target;
+
+  StateCache& cache = StateCache::current();
+  cache.forgetFramebuffer(target.framebuffer);
+  cache.forgetTexture(target.color);
+
+  if (target.framebuffer && Capture::isActive())
+    Capture::record(CaptureOp::DeleteRenderTarget, { target.framebuffer, target.color, target.depth });
+
+  if (target.framebuffer)
+    glDeleteFramebuffers(1, &target.framebuffer);
+  if (target.color)
+  {
+    glDeleteTextures(1, &target.color);
+    MemoryTracker::release(MemoryKind::Texture, entry.memoryTag,
+                           MemoryTracker::textureBytes(entry.desc.colorFormat, target.width, target.height));
+  }
+  if (target.depth)
+  {
+    glDeleteRenderbuffers(1, &target.depth);
+    MemoryTracker::release(MemoryKind::Renderbuffer, entry.memoryTag,
+                           MemoryTracker::textureBytes(entry.desc.depthFormat, target.width, target.height));
+  }
+
+  target = RenderTarget();
+}
@@ -0,0 +1,265 @@
+#include <opengl-module/resource_loader.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/state_cache.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <iostream>
+
+// Deletes the fence if it was never waited on
+Upload::~Upload()
+{
+  if (_submitted.load(std::memory_order_acquire) && _fence && glfwGetCurrentContext())
+    glDeleteSync(_fence);
+}
+
+/**
+ * Checks if the upload has finished, without blocking
+ * Must be called on a thread with a context that shares objects with the loader
+ *
+ * @returns: True once the object can be used
+ */
+bool Upload::isReady()
+{
+  if (_ready)
+    return true;
+
+  // The loader thread hasn't run the job yet
+  if (!_submitted.load(std::memory_order_acquire))
+    return false;
+
+  GLenum status = glClientWaitSync(_fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+    return false;
+
+  glDeleteSync(_fence);
+  _fence = nullptr;
+  _ready = true;
+  return true;
+}
+
+/**
+ * Blocks until the upload has finished, returns straight away if it failed
+ * Must be called on a thread with a context that shares objects with the loader
+ */
+void Upload::wait()
+{
+  if (_failed)
+    return;
+
+  while (!_submitted.load(std::memory_order_acquire))
+    std::this_thread::yield();
+
+  if (!_ready)
+  {
+    glClientWaitSync(_fence, 0, GL_TIMEOUT_IGNORED);
+    glDeleteSync(_fence);
+    _fence = nullptr;
+    _ready = true;
+  }
+}
+
+// Stops the loader thread
+ResourceLoader::~ResourceLoader()
+{
+  stop();
+}
+
+/**
+ * Creates the hidden shared context and starts the loader thread
+ * Must be called on the main thread, because GLFW can only create windows there
+ *
+ * @param shareWindow:   The window whose context objects should be shared with
+ * @param windowVisible: The GLFW_VISIBLE hint to restore afterwards, so later windows are shown or hidden like the main one
+ *
+ * @returns: True if the loader started
+ */
+bool ResourceLoader::start(GLFWwindow* shareWindow, bool windowVisible)
+{
+  if (_context)
+    return true;
+
+  // The window is never shown, it only exists to own the context
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  _context = glfwCreateWindow(1, 1, "", NULL, shareWindow);
+  glfwWindowHint(GLFW_VISIBLE, windowVisible ? GLFW_TRUE : GLFW_FALSE);
+
+  if (!_context)
+  {
+    std::cerr << "ERROR::RESOURCE_LOADER::CONTEXT_CREATION_FAILED: Could not create the loader context\n";
+    return false;
+  }
+
+  _stop = false;
+  _thread = std::thread(&ResourceLoader::threadMain, this);
+  return true;
+}
+
+/**
+ * Finishes the queued jobs, stops the loader thread and destroys its context
+ * Must be called on the main thread
+ */
+void ResourceLoader::stop()
+{
+  if (!_context)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _wake.notify_one();
+  _thread.join();
+
+  glfwDestroyWindow(_context);
+  _context = nullptr;
+}
+
+/**
+ * Queues a job to run on the loader thread
+ * Fails if the loader isn't running, since nothing would ever run the job
+ * The job's GL calls are not recorded by Capture, unlike uploadBuffer() and uploadTexture2D()
+ *
+ * @param job: A function that creates and fills a GL object, returning its name
+ *
+ * @returns: A handle to check when the object is ready to be used, marked failed if the loader isn't running
+ */
+std::shared_ptr<Upload> ResourceLoader::submit(UploadJob job)
+{
+  std::shared_ptr<Upload> upload = std::make_shared<Upload>();
+
+  if (!_context)
+  {
+    std::cerr << "ERROR::RESOURCE_LOADER::NOT_RUNNING: Uploads can only be submitted while the loader is running, see GL::setLoaderThread()\n";
+    upload->_failed = true;
+    return upload;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs.push_back({ job, upload });
+  }
+  _wake.notify_one();
+
+  return upload;
+}
+
+/**
+ * Queues the creation of an immutable buffer
+ * Its memory is counted under the calling thread's MemoryTracker tag, and stays counted because the caller deletes it
+ *
+ * @param data:  The contents of the buffer
+ * @param flags: The storage flags passed to glNamedBufferStorage
+ *
+ * @returns: A handle to the buffer
+ */
+std::shared_ptr<Upload> ResourceLoader::uploadBuffer(std::vector<unsigned char> data, GLbitfield flags)
+{
+  // Shared so the lambda stays copyable without copying the data
+  std::shared_ptr<std::vector<unsigned char>> contents = std::make_shared<std::vector<unsigned char>>(std::move(data));
+
+  // Counted under the tag of the thread queueing the upload, not the loader thread's
+  int memoryTag = MemoryTracker::getCurrentTag();
+
+  return submit([contents, flags, memoryTag]() -> GLuint {
+    GLuint buffer;
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, contents->size(), contents->data(), flags);
+
+    // Recorded before the fence is signalled, so the capture creates the buffer before any call that uses it
+    if (Capture::isActive())
+      Capture::record(CaptureOp::CreateBuffer, { buffer, (uint32_t)contents->size(), flags }, contents->data(), (uint32_t)contents->size());
+
+    MemoryTracker::allocate(MemoryKind::Buffer, memoryTag, (int64_t)contents->size());
+    return buffer;
+  });
+}
+
+/**
+ * Queues the creation of a 2D texture with a full mip chain
+ * Its memory is counted under the calling thread's MemoryTracker tag, and stays counted because the caller deletes it
+ *
+ * @param width:          The width of the texture, in pixels
+ * @param height:         The height of the texture, in pixels
+ * @param internalFormat: The sized internal format
+ * @param format:         The format of the pixel data
+ * @param type:           The type of the pixel data
+ * @param pixels:         The pixel data for the top level
+ *
+ * @returns: A handle to the texture
+ */
+std::shared_ptr<Upload> ResourceLoader::uploadTexture2D(int width, int height, GLenum internalFormat, GLenum format, GLenum type, std::vector<unsigned char> pixels)
+{
+  std::shared_ptr<std::vector<unsigned char>> contents = std::make_shared<std::vector<unsigned char>>(std::move(pixels));
+  int memoryTag = MemoryTracker::getCurrentTag();
+
+  return submit([=]() -> GLuint {
+    // Enough levels to go down to 1x1
+    int levels = 1;
+    for (int size = std::max(width, height); size > 1; size >>= 1)
+      levels++;
+
+    GLuint texture;
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, levels, internalFormat, width, height);
+    StateCache::current().unpackAlignment(1);
+    glTextureSubImage2D(texture, 0, 0, 0, width, height, format, type, contents->data());
+    glGenerateTextureMipmap(texture);
+
+    if (Capture::isActive())
+    {
+      Capture::record(CaptureOp::CreateTexture2D, { texture, (uint32_t)levels, internalFormat, (uint32_t)width, (uint32_t)height });
+      Capture::record(CaptureOp::TextureSubImage2D, { texture, 0, 0, 0, (uint32_t)width, (uint32_t)height, format, type },
+                      contents->data(), (uint32_t)contents->size());
+      Capture::record(CaptureOp::GenerateMipmap, { texture });
+    }
+
+    MemoryTracker::allocate(MemoryKind::Texture, memoryTag, MemoryTracker::textureBytes(internalFormat, width, height, levels));
+    return texture;
+  });
+}
+
+/**
+ * Runs jobs on the loader thread until the loader is stopped
+ */
+void ResourceLoader::threadMain()
+{
+  Trace::setThreadName("Loader");
+
+  glfwMakeContextCurrent(_context);
+
+  // The loader's context has its own state
+  StateCache stateCache;
+  stateCache.makeCurrent();
+
+  while (true)
+  {
+    Job job;
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wake.wait(lock, [this] { return _stop || !_jobs.empty(); });
+
+      // Only exit once every queued job has been run
+      if (_jobs.empty())
+        break;
+
+      job = _jobs.front();
+      _jobs.pop_front();
+    }
+
+    {
+      GL_TRACE_ZONE("ResourceLoader::upload");
+      job.upload->_object = job.job ? job.job() : 0;
+    }
+
+    job.upload->_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    // Flush so the fence reaches the GPU, other contexts can't flush it for us
+    glFlush();
+
+    job.upload->_submitted.store(true, std::memory_order_release);
+  }
+
+  glfwMakeContextCurrent(NULL);
+}
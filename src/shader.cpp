@@ -1,6 +1,10 @@
 #include "opengl-module/gl.h"
 #include <string.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/memory_tracker.h>
 #include <opengl-module/shader.h>
+#include <opengl-module/state_cache.h>
+#include <opengl-module/trace.h>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -26,16 +30,7 @@ Shader::Shader(const char* vertexPath, const char* fragmentPath)
  */
 void Shader::init(const char* vertexPath, const char* fragmentPath)
 {
-  if (!GL::getInstance().isInitialized())
-  {
-    std::cerr << "ERROR::SHADER::GL_NOT_RUNNING: \n"
-              << "Attemping to create or initialize an instance of Shader when GL is not running\n\n"
-              << "Possible causes of this error:\n"
-              << "\t-Global instances of Shader using non-default contstructor\n"
-              << "\t-Calls to Shader::init() outside of a callback from GL\n\n"
-              << "It is recommended to put Shader::init() calls in the GL::run() initCallback function\n\n";
-    throw std::runtime_error("Cannot initialize Shader: GL is not running.");
-  }
+  GL_TRACE_ZONE("Shader::init");
 
   // retrieve the vertex/fragment source code from filePath
   std::string vertexCode;
@@ -86,18 +81,51 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
       std::cerr << "Failed to open fragment shader: " << fragmentPath << "\n";
   }
 
+  initFromSource(vertexCode, fragmentCode);
+}
+
+/**
+ * Initializes the shader from source code instead of files
+ * Compile the vertex and fragment shaders
+ * Attaches them to a shader program and links it
+ *
+ * @param vertexCode:   The source of the vertex shader
+ * @param fragmentCode: The source of the fragment shader
+ */
+void Shader::initFromSource(const std::string& vertexCode, const std::string& fragmentCode)
+{
+  StateCache::checkContext("Shader::initFromSource");
+
+  GL_TRACE_ZONE("Shader::compile");
+
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
+  if (!GL::getInstance().isInitialized())
+  {
+    std::cerr << "ERROR::SHADER::GL_NOT_RUNNING: \n"
+              << "Attemping to create or initialize an instance of Shader when GL is not running\n\n"
+              << "Possible causes of this error:\n"
+              << "\t-Global instances of Shader using non-default contstructor\n"
+              << "\t-Calls to Shader::init() outside of a callback from GL\n\n"
+              << "It is recommended to put Shader::init() calls in the GL::run() initCallback function\n\n";
+    throw std::runtime_error("Cannot initialize Shader: GL is not running.");
+  }
+#endif
+
   const char* vShaderCode = vertexCode.c_str();
   const char* fShaderCode = fragmentCode.c_str();
 
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
   // Store error info
   int success;
   char infoLog[512];
+#endif
 
   // Create the vertex shader
   GLuint vShader = glCreateShader(GL_VERTEX_SHADER);
   glShaderSource(vShader, 1, &vShaderCode, nullptr);
   glCompileShader(vShader);
 
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
   // Check for vertex shader compile errors
   glGetShaderiv(vShader, GL_COMPILE_STATUS, &success);
   if (!success)
@@ -106,12 +134,14 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
     std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
               << infoLog << "\n";
   }
+#endif
 
   // Create the fragment shader
   GLuint fShader = glCreateShader(GL_FRAGMENT_SHADER);
   glShaderSource(fShader, 1, &fShaderCode, nullptr);
   glCompileShader(fShader);
 
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
   // Check for fragment shader compile errors
   glGetShaderiv(fShader, GL_COMPILE_STATUS, &success);
   if (!success)
@@ -120,6 +150,7 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
     std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
               << infoLog << "\n";
   }
+#endif
 
   // Create the shader program
   _id = glCreateProgram();
@@ -127,6 +158,8 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
   glAttachShader(_id, fShader);
   glLinkProgram(_id);
 
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
+  // Querying the link status waits for the driver to finish linking
   glGetProgramiv(_id, GL_LINK_STATUS, &success);
   if (!success)
   {
@@ -134,11 +167,28 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
     std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
               << infoLog << "\n";
   }
+#endif
 
   // Delete the shaders after the program has been linked
   glDeleteShader(vShader);
   glDeleteShader(fShader);
 
+#ifdef OPENGL_MODULE_NO_ERROR_CHECKS
+  // Querying the program's size waits for the link too, so it is counted when the program is first used
+  _memoryTag = MemoryTracker::getCurrentTag();
+  _memoryCounted = false;
+#else
+  // Shader doesn't delete its program, so the memory stays counted
+  MemoryTracker::allocate(MemoryKind::Program, MemoryTracker::getCurrentTag(), MemoryTracker::programBytes(_id));
+#endif
+
+  // Record both sources back to back, so the replay can compile the same program
+  if (Capture::isActive())
+  {
+    std::string sources = vertexCode + fragmentCode;
+    Capture::record(CaptureOp::CreateProgram, { _id, (uint32_t)vertexCode.size() }, sources.data(), (uint32_t)sources.size());
+  }
+
   _init = true;
   _initErrorPrinted = false;
 }
@@ -148,6 +198,9 @@ void Shader::init(const char* vertexPath, const char* fragmentPath)
  */
 void Shader::use()
 {
+  StateCache::checkContext("Shader::use");
+
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
   if (!_init)
   {
     // If an error message hasn't been printed, print one
@@ -161,9 +214,20 @@ void Shader::use()
     // Return to avoid using an uninitialized shader program
     return;
   }
+#endif
 
   // Otherwise, set OpenGL to use the program
-  glUseProgram(_id);
+  // The state cache skips the call if the program is already in use
+  StateCache::current().useProgram(_id);
+
+#ifdef OPENGL_MODULE_NO_ERROR_CHECKS
+  // Drawing with the program needs the link finished anyway
+  if (!_memoryCounted)
+  {
+    MemoryTracker::allocate(MemoryKind::Program, _memoryTag, MemoryTracker::programBytes(_id));
+    _memoryCounted = true;
+  }
+#endif
 }
 
 /**
@@ -174,8 +238,15 @@ void Shader::use()
  */
 void Shader::setBool(const std::string& name, bool value) const
 {
-  if (_init)
-    glUniform1i(glGetUniformLocation(_id, name.c_str()), (int)value);
+  StateCache::checkContext("Shader::setBool");
+
+  if (!_init)
+    return;
+
+  glUniform1i(glGetUniformLocation(_id, name.c_str()), (int)value);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::Uniform1i, { _id, (uint32_t)value }, name.data(), (uint32_t)name.size());
 }
 
 /**
@@ -186,8 +257,15 @@ void Shader::setBool(const std::string& name, bool value) const
  */
 void Shader::setInt(const std::string& name, int value) const
 {
-  if (_init)
-    glUniform1i(glGetUniformLocation(_id, name.c_str()), value);
+  StateCache::checkContext("Shader::setInt");
+
+  if (!_init)
+    return;
+
+  glUniform1i(glGetUniformLocation(_id, name.c_str()), value);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::Uniform1i, { _id, (uint32_t)value }, name.data(), (uint32_t)name.size());
 }
 
 /**
@@ -198,6 +276,13 @@ void Shader::setInt(const std::string& name, int value) const
  */
 void Shader::setFloat(const std::string& name, float value) const
 {
-  if (_init)
-    glUniform1f(glGetUniformLocation(_id, name.c_str()), value);
+  StateCache::checkContext("Shader::setFloat");
+
+  if (!_init)
+    return;
+
+  glUniform1f(glGetUniformLocation(_id, name.c_str()), value);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::Uniform1f, { _id, Capture::floatBits(value) }, name.data(), (uint32_t)name.size());
 }
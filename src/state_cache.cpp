@@ -0,0 +1,573 @@
+#include <opengl-module/state_cache.h>
+#include <opengl-module/capture.h>
+#include <GLFW/glfw3.h>
+#include <iostream>
+
+// The cache for the context current on each thread
+static thread_local StateCache* currentCache = nullptr;
+
+// StateCache Constructor
+// Starts with all state unknown
+StateCache::StateCache()
+{
+  invalidate();
+}
+
+/**
+ * Gets the cache for the context current on this thread
+ * If none has been made current, a per-thread cache is used
+ */
+StateCache& StateCache::current()
+{
+  checkContext("StateCache::current");
+
+  if (!currentCache)
+  {
+    static thread_local StateCache fallback;
+    currentCache = &fallback;
+  }
+
+  return *currentCache;
+}
+
+/**
+ * Makes this the cache used by current() on this thread
+ * Should be called whenever this cache's context is made current
+ */
+void StateCache::makeCurrent()
+{
+  currentCache = this;
+}
+
+#ifndef OPENGL_MODULE_NO_ERROR_CHECKS
+/**
+ * Prints an error the first time a thread without a current context tries to use GL
+ * The wrappers call this before touching GL, because while the submission thread owns the context
+ * only commands enqueued on it may use them
+ *
+ * @param caller: The function about to call GL, named in the error
+ */
+void StateCache::checkContext(const char* caller)
+{
+  // Once per thread, a frame recorded on the wrong thread would otherwise print thousands of times
+  static thread_local bool errorPrinted = false;
+
+  if (errorPrinted || glfwGetCurrentContext())
+    return;
+
+  std::cerr << "ERROR::STATE_CACHE::NO_CONTEXT: " << caller << " was called on a thread with no current context\n"
+            << "While the submission thread is running, GL and the wrappers may only be used in commands enqueued on it\n";
+  errorPrinted = true;
+}
+#endif
+
+/**
+ * Forgets all tracked state
+ * Call this after changing state with raw GL calls
+ */
+void StateCache::invalidate()
+{
+  _program = UNKNOWN;
+  _vertexArray = UNKNOWN;
+  _drawFramebuffer = UNKNOWN;
+  _readFramebuffer = UNKNOWN;
+
+  for (GLuint& buffer : _buffers)
+    buffer = UNKNOWN;
+  for (int i = 0; i < MAX_BUFFER_BINDINGS; i++)
+    _uniformBuffers[i] = _storageBuffers[i] = UNKNOWN;
+  for (int i = 0; i < MAX_TEXTURE_UNITS; i++)
+    _textures[i] = _samplers[i] = UNKNOWN;
+  for (GLuint& capability : _capabilities)
+    capability = UNKNOWN;
+
+  _blendSource = _blendDestination = UNKNOWN;
+  _depthFunc = UNKNOWN;
+  _depthMask = UNKNOWN;
+  _cullFace = UNKNOWN;
+  _unpackAlignment = UNKNOWN;
+  _viewportKnown = false;
+}
+
+/**
+ * Binds a shader program
+ *
+ * @param program: The program to use
+ */
+void StateCache::useProgram(GLuint program)
+{
+  if (change(_program, program))
+  {
+    glUseProgram(program);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::UseProgram, { program });
+  }
+}
+
+/**
+ * Binds a vertex array
+ *
+ * @param vertexArray: The vertex array to bind
+ */
+void StateCache::bindVertexArray(GLuint vertexArray)
+{
+  if (change(_vertexArray, vertexArray))
+  {
+    glBindVertexArray(vertexArray);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindVertexArray, { vertexArray });
+
+    // The element array binding is part of the vertex array's state
+    _buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+  }
+}
+
+/**
+ * Binds a buffer to a target
+ *
+ * @param target: The target to bind to
+ * @param buffer: The buffer to bind
+ */
+void StateCache::bindBuffer(GLenum target, GLuint buffer)
+{
+  int index = bufferTargetIndex(target);
+
+  if (index < 0)
+  {
+    _issued++;
+    glBindBuffer(target, buffer);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindBuffer, { target, buffer });
+    return;
+  }
+
+  if (change(_buffers[index], buffer))
+  {
+    glBindBuffer(target, buffer);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindBuffer, { target, buffer });
+  }
+}
+
+/**
+ * Binds a buffer to an indexed uniform or shader storage binding point
+ *
+ * @param target: GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+ * @param index:  The binding index
+ * @param buffer: The buffer to bind
+ */
+void StateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+  GLuint* bindings = nullptr;
+  if (target == GL_UNIFORM_BUFFER)
+    bindings = _uniformBuffers;
+  else if (target == GL_SHADER_STORAGE_BUFFER)
+    bindings = _storageBuffers;
+
+  // glBindBufferBase also binds the generic target
+  int generic = bufferTargetIndex(target);
+  if (generic >= 0)
+    _buffers[generic] = buffer;
+
+  if (!bindings || index >= (GLuint)MAX_BUFFER_BINDINGS)
+  {
+    _issued++;
+    glBindBufferBase(target, index, buffer);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindBufferBase, { target, index, buffer });
+    return;
+  }
+
+  if (change(bindings[index], buffer))
+  {
+    glBindBufferBase(target, index, buffer);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindBufferBase, { target, index, buffer });
+  }
+}
+
+/**
+ * Binds a texture to a texture unit
+ *
+ * @param unit:    The texture unit
+ * @param texture: The texture to bind
+ */
+void StateCache::bindTexture(GLuint unit, GLuint texture)
+{
+  if (unit >= (GLuint)MAX_TEXTURE_UNITS)
+  {
+    _issued++;
+    glBindTextureUnit(unit, texture);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindTexture, { unit, texture });
+    return;
+  }
+
+  if (change(_textures[unit], texture))
+  {
+    glBindTextureUnit(unit, texture);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindTexture, { unit, texture });
+  }
+}
+
+/**
+ * Binds a sampler to a texture unit
+ *
+ * @param unit:    The texture unit
+ * @param sampler: The sampler to bind
+ */
+void StateCache::bindSampler(GLuint unit, GLuint sampler)
+{
+  if (unit >= (GLuint)MAX_TEXTURE_UNITS)
+  {
+    _issued++;
+    glBindSampler(unit, sampler);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindSampler, { unit, sampler });
+    return;
+  }
+
+  if (change(_samplers[unit], sampler))
+  {
+    glBindSampler(unit, sampler);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::BindSampler, { unit, sampler });
+  }
+}
+
+/**
+ * Binds a framebuffer
+ *
+ * @param target:      GL_FRAMEBUFFER, GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER
+ * @param framebuffer: The framebuffer to bind
+ */
+void StateCache::bindFramebuffer(GLenum target, GLuint framebuffer)
+{
+  if (target == GL_DRAW_FRAMEBUFFER)
+  {
+    if (change(_drawFramebuffer, framebuffer))
+    {
+      glBindFramebuffer(target, framebuffer);
+      if (Capture::isActive())
+        Capture::record(CaptureOp::BindFramebuffer, { target, framebuffer });
+    }
+    return;
+  }
+
+  if (target == GL_READ_FRAMEBUFFER)
+  {
+    if (change(_readFramebuffer, framebuffer))
+    {
+      glBindFramebuffer(target, framebuffer);
+      if (Capture::isActive())
+        Capture::record(CaptureOp::BindFramebuffer, { target, framebuffer });
+    }
+    return;
+  }
+
+  // GL_FRAMEBUFFER binds both, so it can only be skipped if both already match
+  if (_drawFramebuffer == framebuffer && _readFramebuffer == framebuffer)
+  {
+    _elided++;
+    return;
+  }
+
+  _issued++;
+  _drawFramebuffer = _readFramebuffer = framebuffer;
+  glBindFramebuffer(target, framebuffer);
+  if (Capture::isActive())
+    Capture::record(CaptureOp::BindFramebuffer, { target, framebuffer });
+}
+
+/**
+ * Enables a capability
+ *
+ * @param capability: The capability, like GL_BLEND or GL_DEPTH_TEST
+ */
+void StateCache::enable(GLenum capability)
+{
+  int index = capabilityIndex(capability);
+
+  if (index < 0)
+  {
+    _issued++;
+    glEnable(capability);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::Enable, { capability });
+    return;
+  }
+
+  if (change(_capabilities[index], 1))
+  {
+    glEnable(capability);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::Enable, { capability });
+  }
+}
+
+/**
+ * Disables a capability
+ *
+ * @param capability: The capability, like GL_BLEND or GL_DEPTH_TEST
+ */
+void StateCache::disable(GLenum capability)
+{
+  int index = capabilityIndex(capability);
+
+  if (index < 0)
+  {
+    _issued++;
+    glDisable(capability);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::Disable, { capability });
+    return;
+  }
+
+  if (change(_capabilities[index], 0))
+  {
+    glDisable(capability);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::Disable, { capability });
+  }
+}
+
+/**
+ * Sets the blend factors
+ *
+ * @param source:      The source factor
+ * @param destination: The destination factor
+ */
+void StateCache::blendFunc(GLenum source, GLenum destination)
+{
+  if (_blendSource == source && _blendDestination == destination)
+  {
+    _elided++;
+    return;
+  }
+
+  _issued++;
+  _blendSource = source;
+  _blendDestination = destination;
+  glBlendFunc(source, destination);
+  if (Capture::isActive())
+    Capture::record(CaptureOp::BlendFunc, { source, destination });
+}
+
+/**
+ * Sets the depth comparison function
+ *
+ * @param func: The comparison function
+ */
+void StateCache::depthFunc(GLenum func)
+{
+  if (change(_depthFunc, func))
+  {
+    glDepthFunc(func);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::DepthFunc, { func });
+  }
+}
+
+/**
+ * Sets if depth is written
+ *
+ * @param write: True to write depth
+ */
+void StateCache::depthMask(bool write)
+{
+  if (change(_depthMask, write ? 1 : 0))
+  {
+    glDepthMask(write ? GL_TRUE : GL_FALSE);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::DepthMask, { write ? 1u : 0u });
+  }
+}
+
+/**
+ * Sets which faces are culled
+ *
+ * @param mode: GL_FRONT, GL_BACK or GL_FRONT_AND_BACK
+ */
+void StateCache::cullFace(GLenum mode)
+{
+  if (change(_cullFace, mode))
+  {
+    glCullFace(mode);
+    if (Capture::isActive())
+      Capture::record(CaptureOp::CullFace, { mode });
+  }
+}
+
+/**
+ * Sets the viewport
+ *
+ * @param x:      The left edge, in pixels
+ * @param y:      The bottom edge, in pixels
+ * @param width:  The width, in pixels
+ * @param height: The height, in pixels
+ */
+void StateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  if (_viewportKnown && _viewport[0] == x && _viewport[1] == y && _viewport[2] == width && _viewport[3] == height)
+  {
+    _elided++;
+    return;
+  }
+
+  _issued++;
+  _viewport[0] = x;
+  _viewport[1] = y;
+  _viewport[2] = width;
+  _viewport[3] = height;
+  _viewportKnown = true;
+  glViewport(x, y, width, height);
+  if (Capture::isActive())
+    Capture::record(CaptureOp::Viewport, { (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height });
+}
+
+/**
+ * Sets the row alignment of pixel data read from client memory or the unpack buffer
+ * Not recorded in captures, their payloads are tightly packed and replayed with an alignment of 1
+ *
+ * @param alignment: 1, 2, 4 or 8
+ */
+void StateCache::unpackAlignment(GLint alignment)
+{
+  if (change(_unpackAlignment, (GLuint)alignment))
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+}
+
+// Forgets a program about to be deleted, so its name can be reused safely
+void StateCache::forgetProgram(GLuint program)
+{
+  if (_program == program)
+    _program = UNKNOWN;
+}
+
+// Forgets a vertex array about to be deleted, so its name can be reused safely
+void StateCache::forgetVertexArray(GLuint vertexArray)
+{
+  if (_vertexArray == vertexArray)
+    _vertexArray = UNKNOWN;
+}
+
+// Forgets a buffer about to be deleted, so its name can be reused safely
+void StateCache::forgetBuffer(GLuint buffer)
+{
+  for (GLuint& bound : _buffers)
+  {
+    if (bound == buffer)
+      bound = UNKNOWN;
+  }
+
+  for (int i = 0; i < MAX_BUFFER_BINDINGS; i++)
+  {
+    if (_uniformBuffers[i] == buffer)
+      _uniformBuffers[i] = UNKNOWN;
+    if (_storageBuffers[i] == buffer)
+      _storageBuffers[i] = UNKNOWN;
+  }
+}
+
+// Forgets a texture about to be deleted, so its name can be reused safely
+void StateCache::forgetTexture(GLuint texture)
+{
+  for (GLuint& bound : _textures)
+  {
+    if (bound == texture)
+      bound = UNKNOWN;
+  }
+}
+
+// Forgets a framebuffer about to be deleted, so its name can be reused safely
+void StateCache::forgetFramebuffer(GLuint framebuffer)
+{
+  if (_drawFramebuffer == framebuffer)
+    _drawFramebuffer = UNKNOWN;
+  if (_readFramebuffer == framebuffer)
+    _readFramebuffer = UNKNOWN;
+}
+
+/**
+ * Updates a tracked value and counts the call
+ *
+ * @param slot:  The tracked value
+ * @param value: The new value
+ *
+ * @returns: True if the value changed and the call should be issued
+ */
+bool StateCache::change(GLuint& slot, GLuint value)
+{
+  if (slot == value)
+  {
+    _elided++;
+    return false;
+  }
+
+  _issued++;
+  slot = value;
+  return true;
+}
+
+/**
+ * Gets the slot for a non-indexed buffer target
+ *
+ * @returns: The index into _buffers, or -1 if the target isn't tracked
+ */
+int StateCache::bufferTargetIndex(GLenum target)
+{
+  switch (target)
+  {
+  case GL_ARRAY_BUFFER:
+    return 0;
+  case GL_ELEMENT_ARRAY_BUFFER:
+    return 1;
+  case GL_UNIFORM_BUFFER:
+    return 2;
+  case GL_SHADER_STORAGE_BUFFER:
+    return 3;
+  case GL_PIXEL_UNPACK_BUFFER:
+    return 4;
+  case GL_PIXEL_PACK_BUFFER:
+    return 5;
+  case GL_DRAW_INDIRECT_BUFFER:
+    return 6;
+  case GL_COPY_WRITE_BUFFER:
+    return 7;
+  default:
+    return -1;
+  }
+}
+
+/**
+ * Gets the slot for a capability
+ *
+ * @returns: The index into _capabilities, or -1 if the capability isn't tracked
+ */
+int StateCache::capabilityIndex(GLenum capability)
+{
+  switch (capability)
+  {
+  case GL_BLEND:
+    return 0;
+  case GL_DEPTH_TEST:
+    return 1;
+  case GL_CULL_FACE:
+    return 2;
+  case GL_SCISSOR_TEST:
+    return 3;
+  case GL_STENCIL_TEST:
+    return 4;
+  case GL_FRAMEBUFFER_SRGB:
+    return 5;
+  case GL_MULTISAMPLE:
+    return 6;
+  case GL_POLYGON_OFFSET_FILL:
+    return 7;
+  case GL_PROGRAM_POINT_SIZE:
+    return 8;
+  default:
+    return -1;
+  }
+}
@@ -0,0 +1,70 @@
+#include <opengl-module/submission_thread.h>
+#include <opengl-module/state_cache.h>
+#include <opengl-module/trace.h>
+
+// Stops the submission thread
+SubmissionThread::~SubmissionThread()
+{
+  stop();
+}
+
+/**
+ * Moves a window's context to the submission thread
+ * The context must be current on the calling thread, it is released before the thread starts
+ *
+ * @param window:     The window whose context the thread should own
+ * @param stateCache: The state cache of that context
+ */
+void SubmissionThread::start(GLFWwindow* window, StateCache& stateCache)
+{
+  if (_window)
+    return;
+
+  _window = window;
+  _stateCache = &stateCache;
+  _stop.store(false);
+
+  // A context can only be current on one thread at a time
+  glfwMakeContextCurrent(NULL);
+  _thread = std::thread(&SubmissionThread::threadMain, this);
+}
+
+/**
+ * Runs the remaining commands, stops the thread and makes the context current on the calling thread again
+ */
+void SubmissionThread::stop()
+{
+  if (!_window)
+    return;
+
+  _stop.store(true, std::memory_order_release);
+  _ring.wakeConsumer();
+  _thread.join();
+
+  glfwMakeContextCurrent(_window);
+  _stateCache->makeCurrent();
+  _window = nullptr;
+}
+
+/**
+ * Sync point: blocks until every command recorded so far has run
+ */
+void SubmissionThread::finish()
+{
+  _ring.waitForExecuted(_ring.getRecorded());
+}
+
+/**
+ * Makes the context current and replays commands until stopped
+ */
+void SubmissionThread::threadMain()
+{
+  Trace::setThreadName("Submission");
+
+  glfwMakeContextCurrent(_window);
+  _stateCache->makeCurrent();
+
+  _ring.consume(_stop);
+
+  glfwMakeContextCurrent(NULL);
+}
@@ -0,0 +1,705 @@
+#include <opengl-module/texture.h>
+#include <opengl-module/block_compression.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/image.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/mipmap.h>
+#include <opengl-module/state_cache.h>
+#include <iostream>
+
+/**
+ * Sets the unpack alignment for tightly packed rows through the state cache
+ * Rows of 1 and 3 channel images aren't always 4 byte aligned, and the call is skipped
+ * while consecutive uploads need the same alignment
+ *
+ * @param rowBytes: The size of a row, in bytes
+ */
+static void setUnpackAlignment(int rowBytes)
+{
+  StateCache::current().unpackAlignment(rowBytes % 4 != 0 ? 1 : 4);
+}
+
+/**
+ * Uploads tightly packed pixels to part of a mip level, shared by Texture2D and Texture
+ *
+ * @param id:       The texture
+ * @param target:   The texture's target, GL_TEXTURE_2D ignores layer and layers
+ * @param level:    The mip level
+ * @param x:        The left edge of the region, in pixels
+ * @param y:        The bottom edge of the region, in pixels
+ * @param layer:    The first layer
+ * @param width:    The width of the region, in pixels
+ * @param height:   The height of the region, in pixels
+ * @param layers:   The number of layers
+ * @param format:   The format of the pixel data
+ * @param type:     The type of the pixel data
+ * @param source:   Passed to GL, a pointer or an offset into the bound unpack buffer
+ * @param recorded: The pixel data in client memory, recorded in captures
+ */
+static void uploadPixels(GLuint id, GLenum target, int level, int x, int y, int layer, int width, int height, int layers, GLenum format, GLenum type,
+                         const void* source, const void* recorded)
+{
+  int rowBytes = width * Texture2D::pixelBytes(format, type);
+  setUnpackAlignment(rowBytes);
+
+  if (target == GL_TEXTURE_2D)
+    glTextureSubImage2D(id, level, x, y, width, height, format, type, source);
+  else
+    glTextureSubImage3D(id, level, x, y, layer, width, height, layers, format, type, source);
+
+  if (Capture::isActive())
+  {
+    if (target == GL_TEXTURE_2D)
+      Capture::record(CaptureOp::TextureSubImage2D, { id, (uint32_t)level, (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height, format, type },
+                      recorded, (uint32_t)rowBytes * height);
+    else
+      Capture::record(CaptureOp::TextureSubImage3D,
+                      { id, (uint32_t)level, (uint32_t)x, (uint32_t)y, (uint32_t)layer, (uint32_t)width, (uint32_t)height, (uint32_t)layers, format, type },
+                      recorded, (uint32_t)rowBytes * height * layers);
+  }
+}
+
+/**
+ * Uploads blocks to part of a mip level of a block compressed texture, shared by Texture2D and Texture
+ *
+ * @param id:             The texture
+ * @param target:         The texture's target, GL_TEXTURE_2D ignores layer and layers
+ * @param internalFormat: The texture's compressed internal format
+ * @param level:          The mip level
+ * @param x:              The left edge of the region, in pixels, a multiple of 4
+ * @param y:              The bottom edge of the region, in pixels, a multiple of 4
+ * @param layer:          The first layer
+ * @param width:          The width of the region, in pixels
+ * @param height:         The height of the region, in pixels
+ * @param layers:         The number of layers
+ * @param size:           The size of the blocks, in bytes
+ * @param blocks:         The blocks, rows of blocks and layers tightly packed
+ */
+static void uploadBlocks(GLuint id, GLenum target, GLenum internalFormat, int level, int x, int y, int layer, int width, int height, int layers, size_t size,
+                         const void* blocks)
+{
+  if (target == GL_TEXTURE_2D)
+    glCompressedTextureSubImage2D(id, level, x, y, width, height, internalFormat, (GLsizei)size, blocks);
+  else
+    glCompressedTextureSubImage3D(id, level, x, y, layer, width, height, layers, internalFormat, (GLsizei)size, blocks);
+
+  if (Capture::isActive())
+  {
+    if (target == GL_TEXTURE_2D)
+      Capture::record(CaptureOp::CompressedTextureSubImage2D,
+                      { id, (uint32_t)level, (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height, internalFormat }, blocks, (uint32_t)size);
+    else
+      Capture::record(CaptureOp::CompressedTextureSubImage3D,
+                      { id, (uint32_t)level, (uint32_t)x, (uint32_t)y, (uint32_t)layer, (uint32_t)width, (uint32_t)height, (uint32_t)layers, internalFormat },
+                      blocks, (uint32_t)size);
+  }
+}
+
+/**
+ * Sets a pair of texture parameters, like both filters or both wrap modes
+ *
+ * @param id:          The texture
+ * @param first:       The first parameter
+ * @param firstValue:  Its value
+ * @param second:      The second parameter
+ * @param secondValue: Its value
+ */
+static void setParameters(GLuint id, GLenum first, GLenum firstValue, GLenum second, GLenum secondValue)
+{
+  glTextureParameteri(id, first, firstValue);
+  glTextureParameteri(id, second, secondValue);
+
+  if (Capture::isActive())
+  {
+    Capture::record(CaptureOp::TextureParameter, { id, first, firstValue });
+    Capture::record(CaptureOp::TextureParameter, { id, second, secondValue });
+  }
+}
+
+/**
+ * Fills every mip level below the top one from the top level
+ *
+ * @param id: The texture
+ */
+static void generateMipmap(GLuint id)
+{
+  glGenerateTextureMipmap(id);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::GenerateMipmap, { id });
+}
+
+/**
+ * Deletes a texture and stops counting its storage
+ *
+ * @param id:        The texture
+ * @param memoryTag: The MemoryTracker tag its storage is counted under
+ * @param bytes:     The size of its storage
+ */
+static void deleteTexture(GLuint id, int memoryTag, int64_t bytes)
+{
+  StateCache::current().forgetTexture(id);
+  glDeleteTextures(1, &id);
+  MemoryTracker::release(MemoryKind::Texture, memoryTag, bytes);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::DeleteTexture, { id });
+}
+
+/**
+ * Texture2D Constructor
+ *
+ * @param path: The image file to load
+ * @param srgb: Store the color channels as sRGB, for color maps
+ */
+Texture2D::Texture2D(const std::string& path, bool srgb)
+{
+  init(path, srgb);
+}
+
+/**
+ * Initializes the texture from an image file
+ * Decodes it with stb_image, uploads it and generates the mip chain
+ *
+ * @param path: The image file to load
+ * @param srgb: Store the color channels as sRGB, for color maps
+ *
+ * @returns: True if the image was loaded
+ */
+bool Texture2D::init(const std::string& path, bool srgb)
+{
+  Image image;
+  if (!image.load(path))
+    return false;
+
+  return init(image, srgb);
+}
+
+/**
+ * Initializes the texture from a decoded image
+ * Uploads it and generates the mip chain
+ *
+ * @param image: The image to upload
+ * @param srgb:  Store the color channels as sRGB, for color maps
+ *
+ * @returns: True if the image held pixels
+ */
+bool Texture2D::init(const Image& image, bool srgb)
+{
+  if (!image.isLoaded())
+  {
+    std::cerr << "ERROR::TEXTURE::IMAGE_NOT_LOADED\n";
+    return false;
+  }
+
+  init(image.getWidth(), image.getHeight(), internalFormatFor(image.getChannels(), srgb));
+  setData(0, 0, 0, image.getWidth(), image.getHeight(), formatFor(image.getChannels()), GL_UNSIGNED_BYTE, image.getPixels());
+  generateMipmaps();
+  return true;
+}
+
+/**
+ * Initializes the texture from a decoded image and mips built on the CPU
+ * Every level is uploaded as is, nothing is generated on the GPU
+ *
+ * @param image: The top level
+ * @param mips:  The levels below it, from MipGenerator::generate()
+ * @param srgb:  Store the color channels as sRGB, for color maps
+ *
+ * @returns: True if the image held pixels
+ */
+bool Texture2D::init(const Image& image, const std::vector<MipLevel>& mips, bool srgb)
+{
+  if (!image.isLoaded())
+  {
+    std::cerr << "ERROR::TEXTURE::IMAGE_NOT_LOADED\n";
+    return false;
+  }
+
+  GLenum format = formatFor(image.getChannels());
+
+  init(image.getWidth(), image.getHeight(), internalFormatFor(image.getChannels(), srgb), 1 + (int)mips.size());
+  setData(0, 0, 0, image.getWidth(), image.getHeight(), format, GL_UNSIGNED_BYTE, image.getPixels());
+
+  for (size_t i = 0; i < mips.size(); i++)
+    setData((int)i + 1, 0, 0, mips[i].width, mips[i].height, format, GL_UNSIGNED_BYTE, mips[i].pixels.data());
+
+  return true;
+}
+
+/**
+ * Initializes the texture from block compressed levels, from BlockCompressor or TextureCooker
+ * Every level is uploaded as is
+ *
+ * @param levels:         The levels, from the top one down
+ * @param internalFormat: The compressed internal format the levels were encoded to
+ *
+ * @returns: True if there was a level to upload
+ */
+bool Texture2D::init(const std::vector<CompressedLevel>& levels, GLenum internalFormat)
+{
+  if (levels.empty())
+  {
+    std::cerr << "ERROR::TEXTURE::NO_LEVELS\n";
+    return false;
+  }
+
+  init(levels[0].width, levels[0].height, internalFormat, (int)levels.size());
+
+  for (size_t i = 0; i < levels.size(); i++)
+    setCompressedData((int)i, 0, 0, levels[i].width, levels[i].height, levels[i].blocks.size(), levels[i].blocks.data());
+
+  return true;
+}
+
+/**
+ * Initializes the texture with uninitialized storage
+ *
+ * @param width:          The width of the top level, in pixels
+ * @param height:         The height of the top level, in pixels
+ * @param internalFormat: The sized internal format
+ * @param levels:         The number of mip levels, or 0 for a full chain down to 1x1
+ */
+void Texture2D::init(int width, int height, GLenum internalFormat, int levels)
+{
+  StateCache::checkContext("Texture2D::init");
+
+  // Immutable storage can't be resized, so replace the old texture
+  if (_init)
+    destroy();
+
+  if (levels <= 0)
+    levels = mipLevels(width, height);
+
+  glCreateTextures(GL_TEXTURE_2D, 1, &_id);
+  glTextureStorage2D(_id, levels, internalFormat, width, height);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::CreateTexture2D, { _id, (uint32_t)levels, internalFormat, (uint32_t)width, (uint32_t)height });
+
+  _memoryTag = MemoryTracker::getCurrentTag();
+  MemoryTracker::allocate(MemoryKind::Texture, _memoryTag, MemoryTracker::textureBytes(internalFormat, width, height, levels));
+
+  _width = width;
+  _height = height;
+  _levels = levels;
+  _internalFormat = internalFormat;
+  _init = true;
+
+  // Trilinear filtering when there are mips to use
+  setFilter(levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+}
+
+/**
+ * Deletes the texture
+ */
+void Texture2D::destroy()
+{
+  StateCache::checkContext("Texture2D::destroy");
+
+  if (!_init)
+    return;
+
+  deleteTexture(_id, _memoryTag, MemoryTracker::textureBytes(_internalFormat, _width, _height, _levels));
+
+  _id = 0;
+  _width = 0;
+  _height = 0;
+  _levels = 0;
+  _internalFormat = 0;
+  _init = false;
+}
+
+/**
+ * Replaces part of a mip level
+ *
+ * @param level:  The mip level
+ * @param x:      The left edge of the region, in pixels
+ * @param y:      The bottom edge of the region, in pixels
+ * @param width:  The width of the region, in pixels
+ * @param height: The height of the region, in pixels
+ * @param format: The format of the pixel data
+ * @param type:   The type of the pixel data
+ * @param pixels: The pixel data, rows tightly packed
+ */
+void Texture2D::setData(int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels)
+{
+  StateCache::checkContext("Texture2D::setData");
+
+  if (_init)
+    uploadPixels(_id, GL_TEXTURE_2D, level, x, y, 0, width, height, 1, format, type, pixels, pixels);
+}
+
+/**
+ * Replaces part of a mip level from the buffer bound to GL_PIXEL_UNPACK_BUFFER
+ * The copy is done by the GPU, so the call returns without waiting for it
+ *
+ * @param level:  The mip level
+ * @param x:      The left edge of the region, in pixels
+ * @param y:      The bottom edge of the region, in pixels
+ * @param width:  The width of the region, in pixels
+ * @param height: The height of the region, in pixels
+ * @param format: The format of the pixel data
+ * @param type:   The type of the pixel data
+ * @param offset: The offset of the pixel data in the buffer, rows tightly packed
+ * @param mapped: The same pixel data through the buffer's mapping, used to record captures
+ */
+void Texture2D::setDataFromUnpackBuffer(int level, int x, int y, int width, int height, GLenum format, GLenum type, size_t offset, const void* mapped)
+{
+  StateCache::checkContext("Texture2D::setDataFromUnpackBuffer");
+
+  if (_init)
+    uploadPixels(_id, GL_TEXTURE_2D, level, x, y, 0, width, height, 1, format, type, (const void*)offset, mapped);
+}
+
+/**
+ * Replaces part of a mip level of a block compressed texture
+ *
+ * @param level:  The mip level
+ * @param x:      The left edge of the region, in pixels, a multiple of 4
+ * @param y:      The bottom edge of the region, in pixels, a multiple of 4
+ * @param width:  The width of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+ * @param height: The height of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+ * @param size:   The size of the blocks, in bytes
+ * @param blocks: The blocks, rows of blocks tightly packed
+ */
+void Texture2D::setCompressedData(int level, int x, int y, int width, int height, size_t size, const void* blocks)
+{
+  StateCache::checkContext("Texture2D::setCompressedData");
+
+  if (_init)
+    uploadBlocks(_id, GL_TEXTURE_2D, _internalFormat, level, x, y, 0, width, height, 1, size, blocks);
+}
+
+/**
+ * Fills every mip level below the top one from the top level
+ */
+void Texture2D::generateMipmaps()
+{
+  StateCache::checkContext("Texture2D::generateMipmaps");
+
+  if (_init && _levels > 1)
+    generateMipmap(_id);
+}
+
+/**
+ * Sets the texture's filtering
+ *
+ * @param minFilter: The minification filter
+ * @param magFilter: The magnification filter
+ */
+void Texture2D::setFilter(GLenum minFilter, GLenum magFilter)
+{
+  StateCache::checkContext("Texture2D::setFilter");
+
+  if (_init)
+    setParameters(_id, GL_TEXTURE_MIN_FILTER, minFilter, GL_TEXTURE_MAG_FILTER, magFilter);
+}
+
+/**
+ * Sets the texture's wrap modes
+ *
+ * @param wrapS: The wrap mode for the horizontal axis
+ * @param wrapT: The wrap mode for the vertical axis
+ */
+void Texture2D::setWrap(GLenum wrapS, GLenum wrapT)
+{
+  StateCache::checkContext("Texture2D::setWrap");
+
+  if (_init)
+    setParameters(_id, GL_TEXTURE_WRAP_S, wrapS, GL_TEXTURE_WRAP_T, wrapT);
+}
+
+/**
+ * Binds the texture to a texture unit
+ *
+ * @param unit: The texture unit
+ */
+void Texture2D::bind(GLuint unit) const
+{
+  StateCache::checkContext("Texture2D::bind");
+
+  if (_init)
+    StateCache::current().bindTexture(unit, _id);
+}
+
+/**
+ * Counts the mip levels in a full chain down to 1x1
+ *
+ * @param width:  The width of the top level, in pixels
+ * @param height: The height of the top level, in pixels
+ */
+int Texture2D::mipLevels(int width, int height)
+{
+  int levels = 1;
+  for (int size = width > height ? width : height; size > 1; size >>= 1)
+    levels++;
+
+  return levels;
+}
+
+/**
+ * Picks the sized internal format for 8 bit pixels
+ *
+ * @param channels: The channels per pixel, 1 to 4
+ * @param srgb:     Store the color channels as sRGB, only possible with 3 or 4 channels
+ */
+GLenum Texture2D::internalFormatFor(int channels, bool srgb)
+{
+  switch (channels)
+  {
+  case 1:
+    return GL_R8;
+  case 2:
+    return GL_RG8;
+  case 3:
+    return srgb ? GL_SRGB8 : GL_RGB8;
+  default:
+    return srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+  }
+}
+
+/**
+ * Picks the pixel format for a number of channels
+ *
+ * @param channels: The channels per pixel, 1 to 4
+ */
+GLenum Texture2D::formatFor(int channels)
+{
+  switch (channels)
+  {
+  case 1:
+    return GL_RED;
+  case 2:
+    return GL_RG;
+  case 3:
+    return GL_RGB;
+  default:
+    return GL_RGBA;
+  }
+}
+
+/**
+ * Gets the size of one pixel of client data
+ *
+ * @param format: The format of the pixel data
+ * @param type:   The type of the pixel data
+ *
+ * @returns: The size in bytes, or 0 if the format or type isn't known
+ */
+int Texture2D::pixelBytes(GLenum format, GLenum type)
+{
+  int components = 0;
+  switch (format)
+  {
+  case GL_RED:
+  case GL_RED_INTEGER:
+  case GL_DEPTH_COMPONENT:
+    components = 1;
+    break;
+  case GL_RG:
+  case GL_RG_INTEGER:
+    components = 2;
+    break;
+  case GL_RGB:
+  case GL_BGR:
+  case GL_RGB_INTEGER:
+    components = 3;
+    break;
+  case GL_RGBA:
+  case GL_BGRA:
+  case GL_RGBA_INTEGER:
+    components = 4;
+    break;
+  }
+
+  switch (type)
+  {
+  case GL_UNSIGNED_BYTE:
+  case GL_BYTE:
+    return components;
+  case GL_UNSIGNED_SHORT:
+  case GL_SHORT:
+  case GL_HALF_FLOAT:
+    return components * 2;
+  case GL_UNSIGNED_INT:
+  case GL_INT:
+  case GL_FLOAT:
+    return components * 4;
+  case GL_UNSIGNED_INT_8_8_8_8:
+  case GL_UNSIGNED_INT_8_8_8_8_REV:
+  case GL_UNSIGNED_INT_2_10_10_10_REV:
+    return 4;
+  }
+
+  return 0;
+}
+
+/**
+ * Initializes the texture with uninitialized storage
+ *
+ * @param target:         GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_CUBE_MAP_ARRAY
+ * @param width:          The width of the top level, in pixels
+ * @param height:         The height of the top level, in pixels
+ * @param layers:         The number of layers, 6 per cube for cube maps, ignored for 2D textures
+ * @param internalFormat: The sized internal format
+ * @param levels:         The number of mip levels, or 0 for a full chain down to 1x1
+ */
+void Texture::init(GLenum target, int width, int height, int layers, GLenum internalFormat, int levels)
+{
+  StateCache::checkContext("Texture::init");
+
+  // Immutable storage can't be resized, so replace the old texture
+  if (_init)
+    destroy();
+
+  if (levels <= 0)
+    levels = Texture2D::mipLevels(width, height);
+
+  if (target == GL_TEXTURE_2D)
+    layers = 1;
+  else if (target == GL_TEXTURE_CUBE_MAP)
+    layers = 6;
+
+  glCreateTextures(target, 1, &_id);
+
+  // Cube maps take their 6 faces from the target, arrays need the layer count
+  if (target == GL_TEXTURE_2D || target == GL_TEXTURE_CUBE_MAP)
+    glTextureStorage2D(_id, levels, internalFormat, width, height);
+  else
+    glTextureStorage3D(_id, levels, internalFormat, width, height, layers);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::CreateTexture, { _id, target, (uint32_t)levels, internalFormat, (uint32_t)width, (uint32_t)height, (uint32_t)layers });
+
+  _memoryTag = MemoryTracker::getCurrentTag();
+  MemoryTracker::allocate(MemoryKind::Texture, _memoryTag, MemoryTracker::textureBytes(internalFormat, width, height, levels, layers));
+
+  _target = target;
+  _width = width;
+  _height = height;
+  _layers = layers;
+  _levels = levels;
+  _internalFormat = internalFormat;
+  _init = true;
+
+  // Trilinear filtering when there are mips to use
+  setFilter(levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+}
+
+/**
+ * Deletes the texture
+ */
+void Texture::destroy()
+{
+  StateCache::checkContext("Texture::destroy");
+
+  if (!_init)
+    return;
+
+  deleteTexture(_id, _memoryTag, MemoryTracker::textureBytes(_internalFormat, _width, _height, _levels, _layers));
+
+  _id = 0;
+  _target = 0;
+  _width = 0;
+  _height = 0;
+  _layers = 0;
+  _levels = 0;
+  _internalFormat = 0;
+  _init = false;
+}
+
+/**
+ * Replaces part of a mip level, over a range of layers
+ *
+ * @param level:  The mip level
+ * @param x:      The left edge of the region, in pixels
+ * @param y:      The bottom edge of the region, in pixels
+ * @param layer:  The first layer
+ * @param width:  The width of the region, in pixels
+ * @param height: The height of the region, in pixels
+ * @param layers: The number of layers
+ * @param format: The format of the pixel data
+ * @param type:   The type of the pixel data
+ * @param pixels: The pixel data, rows and layers tightly packed
+ */
+void Texture::setData(int level, int x, int y, int layer, int width, int height, int layers, GLenum format, GLenum type, const void* pixels)
+{
+  StateCache::checkContext("Texture::setData");
+
+  if (_init)
+    uploadPixels(_id, _target, level, x, y, layer, width, height, layers, format, type, pixels, pixels);
+}
+
+/**
+ * Replaces part of a mip level of a block compressed texture, over a range of layers
+ *
+ * @param level:  The mip level
+ * @param x:      The left edge of the region, in pixels, a multiple of 4
+ * @param y:      The bottom edge of the region, in pixels, a multiple of 4
+ * @param layer:  The first layer
+ * @param width:  The width of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+ * @param height: The height of the region, in pixels, a multiple of 4 unless it reaches the edge of the level
+ * @param layers: The number of layers
+ * @param size:   The size of the blocks, in bytes
+ * @param blocks: The blocks, rows of blocks and layers tightly packed
+ */
+void Texture::setCompressedData(int level, int x, int y, int layer, int width, int height, int layers, size_t size, const void* blocks)
+{
+  StateCache::checkContext("Texture::setCompressedData");
+
+  if (_init)
+    uploadBlocks(_id, _target, _internalFormat, level, x, y, layer, width, height, layers, size, blocks);
+}
+
+/**
+ * Fills every mip level below the top one from the top level, for every layer
+ */
+void Texture::generateMipmaps()
+{
+  StateCache::checkContext("Texture::generateMipmaps");
+
+  if (_init && _levels > 1)
+    generateMipmap(_id);
+}
+
+/**
+ * Sets the texture's filtering
+ *
+ * @param minFilter: The minification filter
+ * @param magFilter: The magnification filter
+ */
+void Texture::setFilter(GLenum minFilter, GLenum magFilter)
+{
+  StateCache::checkContext("Texture::setFilter");
+
+  if (_init)
+    setParameters(_id, GL_TEXTURE_MIN_FILTER, minFilter, GL_TEXTURE_MAG_FILTER, magFilter);
+}
+
+/**
+ * Sets the texture's wrap modes
+ *
+ * @param wrapS: The wrap mode for the horizontal axis
+ * @param wrapT: The wrap mode for the vertical axis
+ */
+void Texture::setWrap(GLenum wrapS, GLenum wrapT)
+{
+  StateCache::checkContext("Texture::setWrap");
+
+  if (_init)
+    setParameters(_id, GL_TEXTURE_WRAP_S, wrapS, GL_TEXTURE_WRAP_T, wrapT);
+}
+
+/**
+ * Binds the texture to a texture unit
+ *
+ * @param unit: The texture unit
+ */
+void Texture::bind(GLuint unit) const
+{
+  StateCache::checkContext("Texture::bind");
+
+  if (_init)
+    StateCache::current().bindTexture(unit, _id);
+}
@@ -0,0 +1,266 @@
+#include <opengl-module/texture_array_pool.h>
+#include <opengl-module/image.h>
+#include <opengl-module/mipmap.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+/**
+ * Sets how many layers each array holds, arrays are only created as images are added
+ *
+ * @param layersPerArray: The number of layers, clamped to GL_MAX_ARRAY_TEXTURE_LAYERS
+ */
+void TextureArrayPool::init(int layersPerArray)
+{
+  destroy();
+
+  GLint maxLayers = 256;
+  glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+  _layersPerArray = std::max(1, std::min(layersPerArray, (int)maxLayers));
+}
+
+/**
+ * Deletes every array
+ */
+void TextureArrayPool::destroy()
+{
+  for (Array& array : _arrays)
+    array.texture.destroy();
+
+  _arrays.clear();
+  _staging.clear();
+  _staging.shrink_to_fit();
+}
+
+/**
+ * Adds an image to an array of the same kind with a free layer, creating an array if none has one
+ * The pixels are copied, and uploaded by the next flush()
+ *
+ * @param image:   The image to add
+ * @param srgb:    Store the color channels as sRGB, for color maps
+ * @param mipmaps: Give the image a full mip chain, built on the CPU
+ *
+ * @returns: Where the image was placed, with an array of -1 if it holds no pixels
+ */
+TextureLayer TextureArrayPool::add(const Image& image, bool srgb, bool mipmaps)
+{
+  if (!image.isLoaded())
+  {
+    std::cerr << "ERROR::TEXTURE_ARRAY_POOL::IMAGE_NOT_LOADED\n";
+    return TextureLayer();
+  }
+
+  return add(image.getPixels(), image.getWidth(), image.getHeight(), image.getChannels(), srgb, mipmaps);
+}
+
+/**
+ * Adds an image to an array of the same kind with a free layer, creating an array if none has one
+ * The pixels are copied, and uploaded by the next flush()
+ *
+ * @param pixels:   The pixels, 8 bits per channel with rows tightly packed
+ * @param width:    The width, in pixels
+ * @param height:   The height, in pixels
+ * @param channels: The channels per pixel, 1 to 4
+ * @param srgb:     Store the color channels as sRGB, only possible with 3 or 4 channels
+ * @param mipmaps:  Give the image a full mip chain, built on the CPU
+ *
+ * @returns: Where the image was placed, with an array of -1 if the size or channels are invalid
+ */
+TextureLayer TextureArrayPool::add(const unsigned char* pixels, int width, int height, int channels, bool srgb, bool mipmaps)
+{
+  if (_layersPerArray <= 0)
+  {
+    std::cerr << "ERROR::TEXTURE_ARRAY_POOL::NOT_INITIALIZED\n";
+    return TextureLayer();
+  }
+
+  if (width <= 0 || height <= 0 || channels < 1 || channels > 4)
+  {
+    std::cerr << "ERROR::TEXTURE_ARRAY_POOL::INVALID_IMAGE\n";
+    return TextureLayer();
+  }
+
+  // Images of the same kind share the size, internal format and mip count of an array
+  srgb = srgb && channels >= 3;
+  GLenum internalFormat = Texture2D::internalFormatFor(channels, srgb);
+  int levels = mipmaps ? Texture2D::mipLevels(width, height) : 1;
+
+  int index = 0;
+  for (; index < (int)_arrays.size(); index++)
+  {
+    const Array& array = _arrays[index];
+    const Texture& texture = array.texture;
+
+    if (texture.getWidth() == width && texture.getHeight() == height && texture.getInternalFormat() == internalFormat &&
+        texture.getLevels() == levels && (!array.freeLayers.empty() || array.nextLayer < texture.getLayers()))
+      break;
+  }
+
+  if (index == (int)_arrays.size())
+  {
+    _arrays.push_back(Array());
+    _arrays.back().texture.init(GL_TEXTURE_2D_ARRAY, width, height, _layersPerArray, internalFormat, levels);
+    _arrays.back().channels = channels;
+    _arrays.back().srgb = srgb;
+  }
+
+  Array& array = _arrays[index];
+
+  int layer;
+  if (!array.freeLayers.empty())
+  {
+    layer = array.freeLayers.back();
+    array.freeLayers.pop_back();
+  }
+  else
+    layer = array.nextLayer++;
+
+  array.usedLayers++;
+  array.pending.push_back(Pending());
+  array.pending.back().layer = layer;
+  array.pending.back().pixels.assign(pixels, pixels + (size_t)width * height * channels);
+
+  TextureLayer result;
+  result.array = index;
+  result.layer = layer;
+  result.texture = array.texture.getID();
+  return result;
+}
+
+/**
+ * Gives a layer back, so the next image of the same kind can reuse it
+ * An upload still waiting for the layer is dropped
+ * Layers that aren't in use, like ones already released, are rejected
+ *
+ * @param layer: The layer, from add()
+ */
+void TextureArrayPool::release(const TextureLayer& layer)
+{
+  if (layer.array < 0 || layer.array >= (int)_arrays.size())
+    return;
+
+  Array& array = _arrays[layer.array];
+
+  // Releasing a layer twice would hand it out to two images
+  if (layer.layer < 0 || layer.layer >= array.nextLayer ||
+      std::find(array.freeLayers.begin(), array.freeLayers.end(), layer.layer) != array.freeLayers.end())
+  {
+    std::cerr << "ERROR::TEXTURE_ARRAY_POOL::LAYER_NOT_IN_USE: Layer " << layer.layer << " of array " << layer.array << "\n";
+    return;
+  }
+
+  for (size_t i = 0; i < array.pending.size(); i++)
+  {
+    if (array.pending[i].layer == layer.layer)
+    {
+      array.pending.erase(array.pending.begin() + i);
+      break;
+    }
+  }
+
+  array.freeLayers.push_back(layer.layer);
+  array.usedLayers--;
+}
+
+/**
+ * Uploads every queued image
+ * Call it once per frame, before drawing with the pool
+ */
+void TextureArrayPool::flush()
+{
+  GL_TRACE_ZONE("TextureArrayPool::flush");
+
+  for (Array& array : _arrays)
+  {
+    if (array.pending.empty())
+      continue;
+
+    std::sort(array.pending.begin(), array.pending.end(), [](const Pending& a, const Pending& b) { return a.layer < b.layer; });
+
+    // Images going to neighbouring layers are uploaded together
+    size_t first = 0;
+    for (size_t i = 1; i <= array.pending.size(); i++)
+    {
+      if (i == array.pending.size() || array.pending[i].layer != array.pending[i - 1].layer + 1)
+      {
+        uploadRun(array, first, i - first);
+        first = i;
+      }
+    }
+
+    array.pending.clear();
+  }
+}
+
+/**
+ * Binds an array to a texture unit
+ *
+ * @param array: The array
+ * @param unit:  The texture unit
+ */
+void TextureArrayPool::bind(int array, GLuint unit) const
+{
+  _arrays[array].texture.bind(unit);
+}
+
+/**
+ * Counts the images waiting for flush()
+ *
+ * @returns: The number of images
+ */
+size_t TextureArrayPool::getPendingCount() const
+{
+  size_t count = 0;
+  for (const Array& array : _arrays)
+    count += array.pending.size();
+
+  return count;
+}
+
+/**
+ * Uploads a run of neighbouring layers, one call per mip level
+ *
+ * @param array: The array
+ * @param first: The first image of the run in the array's pending list
+ * @param count: The number of images in the run
+ */
+void TextureArrayPool::uploadRun(Array& array, size_t first, size_t count)
+{
+  Texture& texture = array.texture;
+  GLenum format = Texture2D::formatFor(array.channels);
+  int width = texture.getWidth();
+  int height = texture.getHeight();
+  int layer = array.pending[first].layer;
+  size_t imageBytes = (size_t)width * height * array.channels;
+
+  if (count == 1)
+    texture.setData(0, 0, 0, layer, width, height, 1, format, GL_UNSIGNED_BYTE, array.pending[first].pixels.data());
+  else
+  {
+    _staging.resize(imageBytes * count);
+    for (size_t i = 0; i < count; i++)
+      memcpy(&_staging[i * imageBytes], array.pending[first + i].pixels.data(), imageBytes);
+
+    texture.setData(0, 0, 0, layer, width, height, (int)count, format, GL_UNSIGNED_BYTE, _staging.data());
+  }
+
+  if (texture.getLevels() == 1)
+    return;
+
+  std::vector<std::vector<MipLevel>> chains(count);
+  for (size_t i = 0; i < count; i++)
+    chains[i] = MipGenerator::generate(array.pending[first + i].pixels.data(), width, height, array.channels, array.srgb);
+
+  for (int level = 1; level < texture.getLevels() && level - 1 < (int)chains[0].size(); level++)
+  {
+    const MipLevel& mip = chains[0][level - 1];
+    size_t mipBytes = mip.pixels.size();
+
+    _staging.resize(mipBytes * count);
+    for (size_t i = 0; i < count; i++)
+      memcpy(&_staging[i * mipBytes], chains[i][level - 1].pixels.data(), mipBytes);
+
+    texture.setData(level, 0, 0, layer, mip.width, mip.height, (int)count, format, GL_UNSIGNED_BYTE, _staging.data());
+  }
+}
@@ -0,0 +1,379 @@
+#include <opengl-module/texture_atlas.h>
+#include <opengl-module/image.h>
+#include <opengl-module/mipmap.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <iostream>
+
+/**
+ * Sets the size of the area and empties it
+ *
+ * @param width:  The width, in pixels
+ * @param height: The height, in pixels
+ */
+void SkylinePacker::init(int width, int height)
+{
+  _width = width;
+  _height = height;
+  clear();
+}
+
+/**
+ * Empties the area
+ */
+void SkylinePacker::clear()
+{
+  _skyline.clear();
+  _skyline.push_back({ 0, 0, _width });
+  _usedArea = 0;
+}
+
+/**
+ * Places a rectangle where it leaves the skyline lowest, then where it fits the skyline most tightly
+ *
+ * @param width:  The width, in pixels
+ * @param height: The height, in pixels
+ * @param x:      Set to the left edge of the rectangle
+ * @param y:      Set to the bottom edge of the rectangle
+ *
+ * @returns: True if the rectangle fit
+ */
+bool SkylinePacker::insert(int width, int height, int& x, int& y)
+{
+  if (width <= 0 || height <= 0)
+    return false;
+
+  size_t bestIndex = _skyline.size();
+  int bestTop = _height + 1;
+  int bestWidth = _width + 1;
+
+  for (size_t i = 0; i < _skyline.size(); i++)
+  {
+    int bottom = fit(i, width, height);
+    if (bottom < 0)
+      continue;
+
+    int top = bottom + height;
+    if (top < bestTop || (top == bestTop && _skyline[i].width < bestWidth))
+    {
+      bestIndex = i;
+      bestTop = top;
+      bestWidth = _skyline[i].width;
+    }
+  }
+
+  if (bestIndex == _skyline.size())
+    return false;
+
+  x = _skyline[bestIndex].x;
+  y = bestTop - height;
+
+  // The rectangle's top becomes a new segment, covering the segments it sits on
+  _skyline.insert(_skyline.begin() + bestIndex, { x, bestTop, width });
+
+  int right = x + width;
+  size_t next = bestIndex + 1;
+  while (next < _skyline.size() && _skyline[next].x < right)
+  {
+    int covered = right - _skyline[next].x;
+    if (covered < _skyline[next].width)
+    {
+      _skyline[next].x += covered;
+      _skyline[next].width -= covered;
+      break;
+    }
+
+    _skyline.erase(_skyline.begin() + next);
+  }
+
+  // Neighbours at the same height merge, so the skyline stays short
+  for (size_t i = 1; i < _skyline.size();)
+  {
+    if (_skyline[i - 1].y == _skyline[i].y)
+    {
+      _skyline[i - 1].width += _skyline[i].width;
+      _skyline.erase(_skyline.begin() + i);
+    }
+    else
+      i++;
+  }
+
+  _usedArea += (size_t)width * height;
+  return true;
+}
+
+/**
+ * Gets how much of the area is covered
+ *
+ * @returns: The covered fraction, from 0 to 1
+ */
+float SkylinePacker::getOccupancy() const
+{
+  if (_width <= 0 || _height <= 0)
+    return 0.0f;
+
+  return (float)((double)_usedArea / ((double)_width * _height));
+}
+
+/**
+ * Finds where a rectangle would sit if its left edge was at a segment
+ *
+ * @param index:  The segment
+ * @param width:  The width, in pixels
+ * @param height: The height, in pixels
+ *
+ * @returns: The bottom edge, or -1 if it doesn't fit there
+ */
+int SkylinePacker::fit(size_t index, int width, int height) const
+{
+  if (_skyline[index].x + width > _width)
+    return -1;
+
+  // The rectangle rests on the highest segment under it
+  int bottom = 0;
+  int remaining = width;
+  for (size_t i = index; remaining > 0 && i < _skyline.size(); i++)
+  {
+    bottom = std::max(bottom, _skyline[i].y);
+    if (bottom + height > _height)
+      return -1;
+
+    remaining -= _skyline[i].width;
+  }
+
+  return bottom;
+}
+
+/**
+ * Sets up the atlas, pages are only created as images are added
+ * The number of mip levels follows from the padding, 2 pixels gives 2 levels, 4 gives 3, 8 gives 4 and so on
+ *
+ * @param pageSize: The width and height of each page, in pixels
+ * @param padding:  The pixels of padding on each side of an image, 0 for no padding and no mips
+ * @param srgb:     Store the color channels as sRGB, for color maps
+ */
+void TextureAtlas::init(int pageSize, int padding, bool srgb)
+{
+  destroy();
+
+  _pageSize = pageSize;
+  _padding = std::max(0, padding);
+  _srgb = srgb;
+
+  // Each level halves the padding, the last one keeps at least a pixel of it
+  _levels = 1;
+  while ((2 << (_levels - 1)) <= _padding && (1 << _levels) <= _pageSize)
+    _levels++;
+
+  _alignment = 1 << (_levels - 1);
+}
+
+/**
+ * Deletes every page
+ */
+void TextureAtlas::destroy()
+{
+  for (Page& page : _pages)
+    page.texture.destroy();
+
+  _pages.clear();
+  _slot.clear();
+  _slot.shrink_to_fit();
+}
+
+/**
+ * Adds an image to the first page with room for it, creating a page if none has
+ *
+ * @param image:  The image to add
+ * @param region: Set to where the image was placed
+ *
+ * @returns: True if the image was placed, false if it holds no pixels or is larger than a page
+ */
+bool TextureAtlas::add(const Image& image, AtlasRegion& region)
+{
+  if (!image.isLoaded())
+  {
+    std::cerr << "ERROR::TEXTURE_ATLAS::IMAGE_NOT_LOADED\n";
+    return false;
+  }
+
+  return add(image.getPixels(), image.getWidth(), image.getHeight(), image.getChannels(), region);
+}
+
+/**
+ * Adds an image to the first page with room for it, creating a page if none has
+ *
+ * @param pixels:   The pixels, 8 bits per channel with rows tightly packed, the bottom row first
+ * @param width:    The width, in pixels
+ * @param height:   The height, in pixels
+ * @param channels: The channels per pixel, 1 to 4, as stb_image returns them
+ * @param region:   Set to where the image was placed
+ *
+ * @returns: True if the image was placed, false if it is larger than a page
+ */
+bool TextureAtlas::add(const unsigned char* pixels, int width, int height, int channels, AtlasRegion& region)
+{
+  if (_pageSize <= 0)
+  {
+    std::cerr << "ERROR::TEXTURE_ATLAS::NOT_INITIALIZED\n";
+    return false;
+  }
+
+  GL_TRACE_ZONE("TextureAtlas::add");
+
+  // The slot covers whole grid cells, so it is rounded up from the padded image
+  int cellsWide = (width + 2 * _padding + _alignment - 1) / _alignment;
+  int cellsHigh = (height + 2 * _padding + _alignment - 1) / _alignment;
+  int cellsPerPage = _pageSize / _alignment;
+
+  if (width <= 0 || height <= 0 || cellsWide > cellsPerPage || cellsHigh > cellsPerPage)
+  {
+    std::cerr << "ERROR::TEXTURE_ATLAS::IMAGE_TOO_LARGE: " << width << "x" << height << " doesn't fit a " << _pageSize << " pixel page\n";
+    return false;
+  }
+
+  int page = 0;
+  int cellX = 0;
+  int cellY = 0;
+  while (page < (int)_pages.size() && !_pages[page].packer.insert(cellsWide, cellsHigh, cellX, cellY))
+    page++;
+
+  if (page == (int)_pages.size())
+  {
+    _pages.push_back(Page());
+    _pages.back().texture.init(_pageSize, _pageSize, _srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, _levels);
+    _pages.back().texture.setWrap(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+    _pages.back().packer.init(cellsPerPage, cellsPerPage);
+    _pages.back().packer.insert(cellsWide, cellsHigh, cellX, cellY);
+  }
+
+  int slotWidth = cellsWide * _alignment;
+  int slotHeight = cellsHigh * _alignment;
+  fillSlot(pixels, width, height, channels, slotWidth, slotHeight);
+  uploadSlot(page, cellX * _alignment, cellY * _alignment, slotWidth, slotHeight);
+
+  region.page = page;
+  region.x = cellX * _alignment + _padding;
+  region.y = cellY * _alignment + _padding;
+  region.width = width;
+  region.height = height;
+  region.u0 = (float)region.x / _pageSize;
+  region.v0 = (float)region.y / _pageSize;
+  region.u1 = (float)(region.x + width) / _pageSize;
+  region.v1 = (float)(region.y + height) / _pageSize;
+  return true;
+}
+
+/**
+ * Replaces the pixels of an image already in the atlas, for animated or generated sprites
+ *
+ * @param region:   Where the image is, from add()
+ * @param pixels:   The new pixels, the same size as the image, 8 bits per channel with rows tightly packed
+ * @param channels: The channels per pixel, 1 to 4, as stb_image returns them
+ */
+void TextureAtlas::update(const AtlasRegion& region, const unsigned char* pixels, int channels)
+{
+  if (region.page < 0 || region.page >= (int)_pages.size())
+  {
+    std::cerr << "ERROR::TEXTURE_ATLAS::INVALID_REGION\n";
+    return;
+  }
+
+  GL_TRACE_ZONE("TextureAtlas::update");
+
+  // The slot is found again the same way add() sized it
+  int slotWidth = (region.width + 2 * _padding + _alignment - 1) / _alignment * _alignment;
+  int slotHeight = (region.height + 2 * _padding + _alignment - 1) / _alignment * _alignment;
+  fillSlot(pixels, region.width, region.height, channels, slotWidth, slotHeight);
+  uploadSlot(region.page, region.x - _padding, region.y - _padding, slotWidth, slotHeight);
+}
+
+/**
+ * Binds a page to a texture unit
+ *
+ * @param page: The page
+ * @param unit: The texture unit
+ */
+void TextureAtlas::bind(int page, GLuint unit) const
+{
+  _pages[page].texture.bind(unit);
+}
+
+/**
+ * Gets how much of a page is covered by images and their padding
+ *
+ * @param page: The page
+ *
+ * @returns: The covered fraction, from 0 to 1
+ */
+float TextureAtlas::getOccupancy(int page) const
+{
+  return _pages[page].packer.getOccupancy();
+}
+
+/**
+ * Fills the scratch slot with an image, its padding and the rest of its grid cells, repeating its edge pixels
+ *
+ * @param pixels:     The pixels, 8 bits per channel with rows tightly packed
+ * @param width:      The width, in pixels
+ * @param height:     The height, in pixels
+ * @param channels:   The channels per pixel, 1 to 4
+ * @param slotWidth:  The width of the slot, in pixels
+ * @param slotHeight: The height of the slot, in pixels
+ */
+void TextureAtlas::fillSlot(const unsigned char* pixels, int width, int height, int channels, int slotWidth, int slotHeight)
+{
+  _slot.resize((size_t)slotWidth * slotHeight * 4);
+
+  for (int y = 0; y < slotHeight; y++)
+  {
+    int sourceY = std::min(std::max(y - _padding, 0), height - 1);
+    const unsigned char* row = pixels + (size_t)sourceY * width * channels;
+    unsigned char* out = &_slot[(size_t)y * slotWidth * 4];
+
+    for (int x = 0; x < slotWidth; x++, out += 4)
+    {
+      const unsigned char* in = row + (size_t)std::min(std::max(x - _padding, 0), width - 1) * channels;
+
+      // Expanded the way stb_image would, grey for 1 and 2 channels and opaque without alpha
+      if (channels >= 3)
+      {
+        out[0] = in[0];
+        out[1] = in[1];
+        out[2] = in[2];
+        out[3] = channels == 4 ? in[3] : 255;
+      }
+      else
+      {
+        out[0] = out[1] = out[2] = in[0];
+        out[3] = channels == 2 ? in[1] : 255;
+      }
+    }
+  }
+}
+
+/**
+ * Uploads the scratch slot and its mips to a page
+ *
+ * @param page:       The page
+ * @param x:          The left edge of the slot, in pixels
+ * @param y:          The bottom edge of the slot, in pixels
+ * @param slotWidth:  The width of the slot, in pixels
+ * @param slotHeight: The height of the slot, in pixels
+ */
+void TextureAtlas::uploadSlot(int page, int x, int y, int slotWidth, int slotHeight)
+{
+  Texture2D& texture = _pages[page].texture;
+  texture.setData(0, x, y, slotWidth, slotHeight, GL_RGBA, GL_UNSIGNED_BYTE, _slot.data());
+
+  if (_levels == 1)
+    return;
+
+  // The slot is a whole number of grid cells, so its mips line up with the page's and only cover this image
+  std::vector<MipLevel> mips = MipGenerator::generate(_slot.data(), slotWidth, slotHeight, 4, _srgb);
+  for (int level = 1; level < _levels; level++)
+  {
+    const MipLevel& mip = mips[level - 1];
+    texture.setData(level, x >> level, y >> level, mip.width, mip.height, GL_RGBA, GL_UNSIGNED_BYTE, mip.pixels.data());
+  }
+}
@@ -0,0 +1,298 @@
+#include <opengl-module/texture_cooker.h>
+#include <opengl-module/hash.h>
+#include <opengl-module/image.h>
+#include <opengl-module/trace.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// Starts every cache file, followed by each level's width and height as int32s and its blocks
+struct CacheHeader
+{
+  char magic[4];           // "GLBC"
+  uint32_t version;        // TextureCooker::VERSION
+  uint64_t key;            // The key, checked in case two keys ever share a file name
+  uint32_t format;         // The BlockFormat
+  uint32_t internalFormat; // The internal format
+  uint32_t levels;         // The number of levels
+  uint32_t reserved;       // Keeps the header a multiple of 8 bytes
+};
+
+/**
+ * Sets where cooked textures are cached
+ *
+ * @param cacheDirectory: An existing directory to store cooked textures in, or empty to not cache them
+ * @param mipFilter:      The filter the mips are built with
+ */
+void TextureCooker::init(const std::string& cacheDirectory, MipFilter mipFilter)
+{
+  _cacheDirectory = cacheDirectory;
+  if (!_cacheDirectory.empty() && _cacheDirectory.back() != '/' && _cacheDirectory.back() != '\\')
+    _cacheDirectory += '/';
+
+  _mipFilter = mipFilter;
+}
+
+/**
+ * Cooks an image file
+ * The cache is keyed by the file's bytes, so a hit skips decoding as well as encoding
+ *
+ * @param path:        The image file to load
+ * @param srgb:        Store the color channels as sRGB, for color maps
+ * @param highQuality: Use BC7 for color images, see BlockCompressor::formatFor()
+ * @param cooked:      Filled with the texture
+ * @param pool:        Splits the work on each level across the pool, or nullptr to do it all on the calling thread
+ *                     Must be nullptr when called from one of the pool's tasks
+ *
+ * @returns: True if the file could be read and decoded
+ */
+bool TextureCooker::cook(const std::string& path, bool srgb, bool highQuality, CookedTexture& cooked, ThreadPool* pool)
+{
+  GL_TRACE_ZONE("TextureCooker::cook");
+
+  std::vector<unsigned char> file;
+  FILE* input = fopen(path.c_str(), "rb");
+  if (input)
+  {
+    fseek(input, 0, SEEK_END);
+    long size = ftell(input);
+    fseek(input, 0, SEEK_SET);
+
+    if (size > 0)
+    {
+      file.resize((size_t)size);
+      if (fread(file.data(), 1, file.size(), input) != file.size())
+        file.clear();
+    }
+
+    fclose(input);
+  }
+
+  if (file.empty())
+  {
+    std::cerr << "ERROR::TEXTURE_COOKER::READ_FAILED: " << path << "\n";
+    return false;
+  }
+
+  // The seed keeps file keys apart from pixel keys
+  uint64_t key = Hash::compute(file.data(), file.size(), VERSION * 2 + 1);
+  key = Hash::combine(key, srgb);
+  key = Hash::combine(key, highQuality);
+  key = Hash::combine(key, (uint64_t)_mipFilter);
+
+  if (read(key, cooked))
+  {
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  Image image;
+  if (!image.loadFromMemory(file.data(), file.size()))
+    return false;
+
+  _misses.fetch_add(1, std::memory_order_relaxed);
+  encode(image, srgb, BlockCompressor::formatFor(image.getChannels(), highQuality), cooked, pool);
+  write(key, cooked);
+  return true;
+}
+
+/**
+ * Cooks a decoded image
+ * The cache is keyed by the image's pixels
+ *
+ * @param image:  The top level
+ * @param srgb:   Store the color channels as sRGB, for color maps
+ * @param format: The format to encode to
+ * @param cooked: Filled with the texture
+ * @param pool:   Splits the work on each level across the pool, or nullptr to do it all on the calling thread
+ *                Must be nullptr when called from one of the pool's tasks
+ *
+ * @returns: True if the image held pixels
+ */
+bool TextureCooker::cook(const Image& image, bool srgb, BlockFormat format, CookedTexture& cooked, ThreadPool* pool)
+{
+  if (!image.isLoaded())
+  {
+    std::cerr << "ERROR::TEXTURE_COOKER::IMAGE_NOT_LOADED\n";
+    return false;
+  }
+
+  GL_TRACE_ZONE("TextureCooker::cook");
+
+  uint64_t key = Hash::compute(image.getPixels(), image.getSize(), VERSION * 2);
+  key = Hash::combine(key, (uint64_t)image.getWidth() << 32 | (uint32_t)image.getHeight());
+  key = Hash::combine(key, (uint64_t)image.getChannels());
+  key = Hash::combine(key, srgb);
+  key = Hash::combine(key, (uint64_t)format);
+  key = Hash::combine(key, (uint64_t)_mipFilter);
+
+  if (read(key, cooked))
+  {
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  _misses.fetch_add(1, std::memory_order_relaxed);
+  encode(image, srgb, format, cooked, pool);
+  write(key, cooked);
+  return true;
+}
+
+/**
+ * Builds the mips of an image and encodes every level
+ *
+ * @param image:  The top level
+ * @param srgb:   Filter the mips in linear space and store the color channels as sRGB
+ * @param format: The format to encode to
+ * @param cooked: Filled with the texture
+ * @param pool:   Splits the work on each level across the pool, or nullptr
+ */
+void TextureCooker::encode(const Image& image, bool srgb, BlockFormat format, CookedTexture& cooked, ThreadPool* pool) const
+{
+  // BC4 and BC5 have no sRGB variant
+  bool srgbFormat = srgb && format != BlockFormat::BC4 && format != BlockFormat::BC5;
+  std::vector<MipLevel> mips = MipGenerator::generate(image, srgbFormat, _mipFilter, pool);
+
+  cooked.format = format;
+  cooked.internalFormat = BlockCompressor::internalFormatFor(format, srgbFormat);
+  cooked.levels.clear();
+  cooked.levels.reserve(mips.size() + 1);
+
+  cooked.levels.push_back(BlockCompressor::compress(image.getPixels(), image.getWidth(), image.getHeight(), image.getChannels(), format, pool));
+
+  for (const MipLevel& mip : mips)
+    cooked.levels.push_back(BlockCompressor::compress(mip.pixels.data(), mip.width, mip.height, image.getChannels(), format, pool));
+}
+
+/**
+ * Gets the cache file for a key
+ *
+ * @param key: The key
+ *
+ * @returns: The path, or empty if caching is off
+ */
+std::string TextureCooker::cachePath(uint64_t key) const
+{
+  if (_cacheDirectory.empty())
+    return std::string();
+
+  return _cacheDirectory + Hash::toHex(key) + ".bc";
+}
+
+/**
+ * Reads a cooked texture from the cache
+ *
+ * @param key:    The key it was stored under
+ * @param cooked: Filled with the texture
+ *
+ * @returns: True if the file existed and was complete
+ */
+bool TextureCooker::read(uint64_t key, CookedTexture& cooked) const
+{
+  std::string path = cachePath(key);
+  if (path.empty())
+    return false;
+
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file)
+    return false;
+
+  CacheHeader header;
+  bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "GLBC", 4) == 0 && header.version == VERSION &&
+               header.key == key && header.format <= (uint32_t)BlockFormat::BC7 && header.levels > 0 && header.levels <= 32;
+
+  if (valid)
+  {
+    cooked.format = (BlockFormat)header.format;
+    cooked.internalFormat = header.internalFormat;
+    cooked.levels.resize(header.levels);
+
+    for (CompressedLevel& level : cooked.levels)
+    {
+      int32_t size[2];
+      if (fread(size, sizeof(size), 1, file) != 1 || size[0] <= 0 || size[1] <= 0 || size[0] > 65536 || size[1] > 65536)
+      {
+        valid = false;
+        break;
+      }
+
+      level.width = size[0];
+      level.height = size[1];
+      level.blocks.resize(BlockCompressor::compressedSize(cooked.format, level.width, level.height));
+
+      if (fread(level.blocks.data(), 1, level.blocks.size(), file) != level.blocks.size())
+      {
+        valid = false;
+        break;
+      }
+    }
+  }
+
+  fclose(file);
+
+  // A damaged file is encoded again and overwritten
+  if (!valid)
+    cooked.levels.clear();
+
+  return valid;
+}
+
+/**
+ * Stores a cooked texture in the cache
+ * Written to a temporary file first, so other threads and processes never read a partial one
+ *
+ * @param key:    The key to store it under
+ * @param cooked: The texture
+ */
+void TextureCooker::write(uint64_t key, const CookedTexture& cooked) const
+{
+  std::string path = cachePath(key);
+  if (path.empty())
+    return;
+
+  // Unique across processes as well as threads, so two writers never share a partial file
+  static std::atomic<uint64_t> counter(0);
+  uint64_t index = counter.fetch_add(1, std::memory_order_relaxed);
+  std::string temporary = path + "." + Hash::toHex((uint64_t)getpid()) + "." + Hash::toHex(index) + ".tmp";
+
+  FILE* file = fopen(temporary.c_str(), "wb");
+  if (!file)
+  {
+    std::cerr << "ERROR::TEXTURE_COOKER::CACHE_WRITE_FAILED: " << path << "\n";
+    return;
+  }
+
+  CacheHeader header;
+  memcpy(header.magic, "GLBC", 4);
+  header.version = VERSION;
+  header.key = key;
+  header.format = (uint32_t)cooked.format;
+  header.internalFormat = cooked.internalFormat;
+  header.levels = (uint32_t)cooked.levels.size();
+  header.reserved = 0;
+
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+  for (const CompressedLevel& level : cooked.levels)
+  {
+    int32_t size[2] = { level.width, level.height };
+    written = written && fwrite(size, sizeof(size), 1, file) == 1;
+    written = written && fwrite(level.blocks.data(), 1, level.blocks.size(), file) == level.blocks.size();
+  }
+
+  written = fclose(file) == 0 && written;
+
+  // Renaming fails on some platforms if another thread stored the same texture first, which is just as good
+  if (!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+  {
+    if (!written)
+      std::cerr << "ERROR::TEXTURE_COOKER::CACHE_WRITE_FAILED: " << path << "\n";
+    std::remove(temporary.c_str());
+  }
+}
@@ -0,0 +1,597 @@
+#include <opengl-module/texture_file.h>
+#include <opengl-module/block_compression.h>
+#include <opengl-module/texture.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+// Largest width or height accepted, above the GL_MAX_TEXTURE_SIZE of current GPUs
+static const int MAX_SIZE = 65536;
+
+// Most layers accepted, the GL_MAX_ARRAY_TEXTURE_LAYERS every OpenGL 4.5 implementation supports
+static const uint64_t MAX_LAYERS = 2048;
+
+// How the images of a format are laid out and uploaded
+struct FormatInfo
+{
+  GLenum internalFormat = 0; // The sized internal format
+  GLenum format = 0;         // The pixel format, 0 if block compressed
+  GLenum type = 0;           // The pixel type, 0 if block compressed
+  int blockBytes = 0;        // The size of a 4x4 block, 0 if uncompressed
+  int pixelBytes = 0;        // The size of a pixel, 0 if block compressed
+};
+
+// Describes a block compressed format
+static FormatInfo compressedFormat(GLenum internalFormat, int blockBytes)
+{
+  FormatInfo info;
+  info.internalFormat = internalFormat;
+  info.blockBytes = blockBytes;
+  return info;
+}
+
+// Describes an uncompressed format
+static FormatInfo pixelFormat(GLenum internalFormat, GLenum format, GLenum type, int pixelBytes)
+{
+  FormatInfo info;
+  info.internalFormat = internalFormat;
+  info.format = format;
+  info.type = type;
+  info.pixelBytes = pixelBytes;
+  return info;
+}
+
+/**
+ * Looks up a DXGI_FORMAT, used by DDS files with a DX10 header
+ *
+ * @param dxgiFormat: The format
+ * @param info:       Filled with the layout of the format
+ *
+ * @returns: True if the format is supported
+ */
+static bool dxgiFormatInfo(uint32_t dxgiFormat, FormatInfo& info)
+{
+  switch (dxgiFormat)
+  {
+  case 2: info = pixelFormat(GL_RGBA32F, GL_RGBA, GL_FLOAT, 16); return true;
+  case 10: info = pixelFormat(GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8); return true;
+  case 28: info = pixelFormat(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4); return true;
+  case 29: info = pixelFormat(GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4); return true;
+  case 49: info = pixelFormat(GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2); return true;
+  case 61: info = pixelFormat(GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1); return true;
+  case 71: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8); return true;
+  case 72: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 8); return true;
+  case 74: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 16); return true;
+  case 75: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 16); return true;
+  case 77: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 16); return true;
+  case 78: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 16); return true;
+  case 80: info = compressedFormat(GL_COMPRESSED_RED_RGTC1, 8); return true;
+  case 81: info = compressedFormat(GL_COMPRESSED_SIGNED_RED_RGTC1, 8); return true;
+  case 83: info = compressedFormat(GL_COMPRESSED_RG_RGTC2, 16); return true;
+  case 84: info = compressedFormat(GL_COMPRESSED_SIGNED_RG_RGTC2, 16); return true;
+  case 87: info = pixelFormat(GL_RGBA8, GL_BGRA, GL_UNSIGNED_BYTE, 4); return true;
+  case 91: info = pixelFormat(GL_SRGB8_ALPHA8, GL_BGRA, GL_UNSIGNED_BYTE, 4); return true;
+  case 95: info = compressedFormat(GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 16); return true;
+  case 96: info = compressedFormat(GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 16); return true;
+  case 98: info = compressedFormat(GL_COMPRESSED_RGBA_BPTC_UNORM, 16); return true;
+  case 99: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 16); return true;
+  }
+
+  return false;
+}
+
+/**
+ * Looks up a VkFormat, used by KTX2 files
+ *
+ * @param vkFormat: The format
+ * @param info:     Filled with the layout of the format
+ *
+ * @returns: True if the format is supported
+ */
+static bool vkFormatInfo(uint32_t vkFormat, FormatInfo& info)
+{
+  switch (vkFormat)
+  {
+  case 9: info = pixelFormat(GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1); return true;
+  case 16: info = pixelFormat(GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2); return true;
+  case 23: info = pixelFormat(GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3); return true;
+  case 29: info = pixelFormat(GL_SRGB8, GL_RGB, GL_UNSIGNED_BYTE, 3); return true;
+  case 37: info = pixelFormat(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4); return true;
+  case 43: info = pixelFormat(GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4); return true;
+  case 44: info = pixelFormat(GL_RGBA8, GL_BGRA, GL_UNSIGNED_BYTE, 4); return true;
+  case 50: info = pixelFormat(GL_SRGB8_ALPHA8, GL_BGRA, GL_UNSIGNED_BYTE, 4); return true;
+  case 97: info = pixelFormat(GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8); return true;
+  case 109: info = pixelFormat(GL_RGBA32F, GL_RGBA, GL_FLOAT, 16); return true;
+  case 131: info = compressedFormat(GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 8); return true;
+  case 132: info = compressedFormat(GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, 8); return true;
+  case 133: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8); return true;
+  case 134: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 8); return true;
+  case 135: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 16); return true;
+  case 136: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 16); return true;
+  case 137: info = compressedFormat(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 16); return true;
+  case 138: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 16); return true;
+  case 139: info = compressedFormat(GL_COMPRESSED_RED_RGTC1, 8); return true;
+  case 140: info = compressedFormat(GL_COMPRESSED_SIGNED_RED_RGTC1, 8); return true;
+  case 141: info = compressedFormat(GL_COMPRESSED_RG_RGTC2, 16); return true;
+  case 142: info = compressedFormat(GL_COMPRESSED_SIGNED_RG_RGTC2, 16); return true;
+  case 143: info = compressedFormat(GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 16); return true;
+  case 144: info = compressedFormat(GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 16); return true;
+  case 145: info = compressedFormat(GL_COMPRESSED_RGBA_BPTC_UNORM, 16); return true;
+  case 146: info = compressedFormat(GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 16); return true;
+  case 147: info = compressedFormat(GL_COMPRESSED_RGB8_ETC2, 8); return true;
+  case 148: info = compressedFormat(GL_COMPRESSED_SRGB8_ETC2, 8); return true;
+  case 149: info = compressedFormat(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 8); return true;
+  case 150: info = compressedFormat(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, 8); return true;
+  case 151: info = compressedFormat(GL_COMPRESSED_RGBA8_ETC2_EAC, 16); return true;
+  case 152: info = compressedFormat(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, 16); return true;
+  case 153: info = compressedFormat(GL_COMPRESSED_R11_EAC, 8); return true;
+  case 154: info = compressedFormat(GL_COMPRESSED_SIGNED_R11_EAC, 8); return true;
+  case 155: info = compressedFormat(GL_COMPRESSED_RG11_EAC, 16); return true;
+  case 156: info = compressedFormat(GL_COMPRESSED_SIGNED_RG11_EAC, 16); return true;
+  }
+
+  return false;
+}
+
+// Builds a DDS four character code
+static uint32_t fourCC(char a, char b, char c, char d)
+{
+  return (uint32_t)(unsigned char)a | (uint32_t)(unsigned char)b << 8 | (uint32_t)(unsigned char)c << 16 | (uint32_t)(unsigned char)d << 24;
+}
+
+// Reads a little endian value from the file, which may not be aligned
+static uint32_t read32(const unsigned char* p)
+{
+  return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t read64(const unsigned char* p)
+{
+  return (uint64_t)read32(p) | (uint64_t)read32(p + 4) << 32;
+}
+
+/**
+ * Maps a KTX2 or DDS file and finds its images, picking the format from its contents rather than its name
+ * KTX2 files with supercompression aren't supported
+ *
+ * @param path: The file to load
+ * @param srgb: Treat the color channels as sRGB if the file doesn't say, for DDS files without a DX10 header
+ *
+ * @returns: True if the file was mapped and its layout understood
+ */
+bool TextureFile::open(const std::string& path, bool srgb)
+{
+  GL_TRACE_ZONE("TextureFile::open");
+
+  close();
+
+  if (!_file.open(path))
+    return false;
+
+  static const unsigned char KTX2_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+  const unsigned char* data = _file.getData();
+  size_t size = _file.getSize();
+  bool parsed = false;
+
+  if (size >= 4 && memcmp(data, "DDS ", 4) == 0)
+    parsed = parseDDS(srgb);
+  else if (size >= sizeof(KTX2_IDENTIFIER) && memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)
+    parsed = parseKTX2();
+  else
+    std::cerr << "ERROR::TEXTURE_FILE::UNKNOWN_CONTAINER: Only KTX2 and DDS files are supported\n";
+
+  if (!parsed)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::LOAD_FAILED: " << path << "\n";
+    close();
+  }
+
+  return parsed;
+}
+
+/**
+ * Unmaps the file
+ */
+void TextureFile::close()
+{
+  _file.close();
+  _images.clear();
+  _target = 0;
+  _internalFormat = 0;
+  _format = 0;
+  _type = 0;
+  _blockBytes = 0;
+  _pixelBytes = 0;
+  _width = 0;
+  _height = 0;
+  _layers = 0;
+  _levels = 0;
+  _generateMipmaps = false;
+}
+
+/**
+ * Creates a texture from the file, uploading every level from the mapping
+ * The file can be closed afterwards
+ *
+ * @param texture: The texture to initialize
+ *
+ * @returns: True if the file was open
+ */
+bool TextureFile::upload(Texture& texture) const
+{
+  if (!isOpen())
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::NOT_OPEN\n";
+    return false;
+  }
+
+  GL_TRACE_ZONE("TextureFile::upload");
+
+  texture.init(_target, _width, _height, _layers, _internalFormat, _generateMipmaps ? 0 : _levels);
+
+  for (int level = 0; level < _levels; level++)
+  {
+    int width = std::max(1, _width >> level);
+    int height = std::max(1, _height >> level);
+
+    // Layers stored back to back, every layer of a KTX2 level, are uploaded with one call
+    for (int layer = 0; layer < _layers;)
+    {
+      const Subresource& first = _images[level * _layers + layer];
+
+      int count = 1;
+      while (layer + count < _layers && _images[level * _layers + layer + count].data == first.data + count * first.size)
+        count++;
+
+      if (isCompressed())
+        texture.setCompressedData(level, 0, 0, layer, width, height, count, first.size * count, first.data);
+      else
+        texture.setData(level, 0, 0, layer, width, height, count, _format, _type, first.data);
+
+      layer += count;
+    }
+  }
+
+  if (_generateMipmaps)
+    texture.generateMipmaps();
+
+  return true;
+}
+
+/**
+ * Gets one image in the file
+ *
+ * @param level: The mip level
+ * @param layer: The layer, 6 per cube for cube maps
+ * @param size:  Set to the size of the image, in bytes
+ *
+ * @returns: The image, in the mapping, or nullptr if there is no such image
+ */
+const unsigned char* TextureFile::getImage(int level, int layer, size_t& size) const
+{
+  if (level < 0 || level >= _levels || layer < 0 || layer >= _layers)
+  {
+    size = 0;
+    return nullptr;
+  }
+
+  const Subresource& image = _images[level * _layers + layer];
+  size = image.size;
+  return image.data;
+}
+
+/**
+ * Finds the images of a DDS file
+ *
+ * @param srgb: Treat the color channels as sRGB if the file has no DX10 header
+ *
+ * @returns: True if the layout was understood
+ */
+bool TextureFile::parseDDS(bool srgb)
+{
+  // The header's flags and capabilities that matter here
+  static const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+  static const uint32_t DDPF_FOURCC = 0x4;
+  static const uint32_t DDPF_RGB = 0x40;
+  static const uint32_t DDPF_LUMINANCE = 0x20000;
+  static const uint32_t DDSCAPS2_CUBEMAP = 0x200;
+  static const uint32_t DDSCAPS2_VOLUME = 0x200000;
+  static const uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+  static const uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+  const unsigned char* data = _file.getData();
+  size_t fileSize = _file.getSize();
+
+  // The magic, then a 124 byte header
+  if (fileSize < 128 || read32(data + 4) != 124)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::BAD_HEADER\n";
+    return false;
+  }
+
+  const unsigned char* header = data + 4;
+  uint32_t flags = read32(header + 4);
+  uint32_t height = read32(header + 8);
+  uint32_t width = read32(header + 12);
+  uint32_t depth = read32(header + 20);
+  uint32_t mipMapCount = read32(header + 24);
+  const unsigned char* ddsFormat = header + 72;
+  uint32_t formatFlags = read32(ddsFormat + 4);
+  uint32_t code = read32(ddsFormat + 8);
+  uint32_t bitCount = read32(ddsFormat + 12);
+  uint32_t redMask = read32(ddsFormat + 16);
+  uint32_t caps2 = read32(header + 108);
+
+  size_t offset = 128;
+  FormatInfo info;
+  bool known = false;
+  uint32_t arraySize = 1;
+  bool array = false;
+  bool cube = (caps2 & DDSCAPS2_CUBEMAP) != 0;
+
+  if ((caps2 & DDSCAPS2_VOLUME) && depth > 1)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_DIMENSION: Volume textures aren't supported\n";
+    return false;
+  }
+
+  if ((formatFlags & DDPF_FOURCC) && code == fourCC('D', 'X', '1', '0'))
+  {
+    if (fileSize < 148)
+    {
+      std::cerr << "ERROR::TEXTURE_FILE::BAD_HEADER\n";
+      return false;
+    }
+
+    const unsigned char* dx10 = data + 128;
+    if (read32(dx10 + 4) != DDS_DIMENSION_TEXTURE2D)
+    {
+      std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_DIMENSION: Only 2D textures, arrays and cube maps are supported\n";
+      return false;
+    }
+
+    known = dxgiFormatInfo(read32(dx10), info);
+    cube = (read32(dx10 + 8) & DDS_RESOURCE_MISC_TEXTURECUBE) != 0;
+    arraySize = std::max<uint32_t>(1, read32(dx10 + 12));
+    array = arraySize > 1;
+    offset = 148;
+  }
+  else if (formatFlags & DDPF_FOURCC)
+  {
+    // Legacy files have no sRGB flag, so the caller says
+    if (code == fourCC('D', 'X', 'T', '1'))
+      info = compressedFormat(srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8);
+    else if (code == fourCC('D', 'X', 'T', '3'))
+      info = compressedFormat(srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT : GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 16);
+    else if (code == fourCC('D', 'X', 'T', '5'))
+      info = compressedFormat(srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 16);
+    else if (code == fourCC('A', 'T', 'I', '1') || code == fourCC('B', 'C', '4', 'U'))
+      info = compressedFormat(GL_COMPRESSED_RED_RGTC1, 8);
+    else if (code == fourCC('A', 'T', 'I', '2') || code == fourCC('B', 'C', '5', 'U'))
+      info = compressedFormat(GL_COMPRESSED_RG_RGTC2, 16);
+
+    known = info.internalFormat != 0;
+  }
+  else if ((formatFlags & DDPF_RGB) && bitCount == 32)
+  {
+    // Without an alpha mask the fourth byte is padding, but uploading it as alpha is harmless for opaque textures
+    GLenum internalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+    if (redMask == 0x000000FF)
+      info = pixelFormat(internalFormat, GL_RGBA, GL_UNSIGNED_BYTE, 4);
+    else if (redMask == 0x00FF0000)
+      info = pixelFormat(internalFormat, GL_BGRA, GL_UNSIGNED_BYTE, 4);
+
+    known = info.internalFormat != 0;
+  }
+  else if ((formatFlags & DDPF_LUMINANCE) && bitCount == 8)
+  {
+    info = pixelFormat(GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1);
+    known = true;
+  }
+
+  if (!known)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_FORMAT\n";
+    return false;
+  }
+
+  _internalFormat = info.internalFormat;
+  _format = info.format;
+  _type = info.type;
+  _blockBytes = info.blockBytes;
+  _pixelBytes = info.pixelBytes;
+  _width = (int)width;
+  _height = (int)height;
+  _levels = (flags & DDSD_MIPMAPCOUNT) && mipMapCount > 0 ? (int)std::min<uint32_t>(mipMapCount, 32) : 1;
+
+  if (cube)
+    _target = array ? GL_TEXTURE_CUBE_MAP_ARRAY : GL_TEXTURE_CUBE_MAP;
+  else
+    _target = array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+
+  if (!setLayers((uint64_t)arraySize * (cube ? 6 : 1)))
+    return false;
+
+  // DDS files store each layer's whole mip chain before the next layer's
+  _images.resize((size_t)_levels * _layers);
+  for (int layer = 0; layer < _layers; layer++)
+  {
+    for (int level = 0; level < _levels; level++)
+    {
+      size_t size = imageSize(level);
+      if (size > fileSize - offset)
+      {
+        std::cerr << "ERROR::TEXTURE_FILE::TRUNCATED\n";
+        return false;
+      }
+
+      _images[level * _layers + layer] = { data + offset, size };
+      offset += size;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Finds the images of a KTX2 file
+ *
+ * @returns: True if the layout was understood
+ */
+bool TextureFile::parseKTX2()
+{
+  const unsigned char* data = _file.getData();
+  size_t fileSize = _file.getSize();
+
+  // The identifier, a 36 byte header, a 32 byte index of the metadata, then a 24 byte entry per level
+  if (fileSize < 80)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::BAD_HEADER\n";
+    return false;
+  }
+
+  const unsigned char* header = data + 12;
+  uint32_t vkFormat = read32(header);
+  uint32_t width = read32(header + 8);
+  uint32_t height = read32(header + 12);
+  uint32_t depth = read32(header + 16);
+  uint32_t layerCount = read32(header + 20);
+  uint32_t faceCount = read32(header + 24);
+  uint32_t levelCount = read32(header + 28);
+  uint32_t supercompression = read32(header + 32);
+
+  if (supercompression != 0)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_SUPERCOMPRESSION: Store KTX2 files without supercompression\n";
+    return false;
+  }
+
+  if (height == 0 || depth > 1 || (faceCount != 1 && faceCount != 6))
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_DIMENSION: Only 2D textures, arrays and cube maps are supported\n";
+    return false;
+  }
+
+  FormatInfo info;
+  if (!vkFormatInfo(vkFormat, info))
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_FORMAT: VkFormat " << vkFormat << "\n";
+    return false;
+  }
+
+  bool array = layerCount > 0;
+  bool cube = faceCount == 6;
+
+  _internalFormat = info.internalFormat;
+  _format = info.format;
+  _type = info.type;
+  _blockBytes = info.blockBytes;
+  _pixelBytes = info.pixelBytes;
+  _width = (int)width;
+  _height = (int)height;
+
+  // A level count of 0 asks for the mips to be generated
+  _levels = (int)std::min<uint32_t>(std::max<uint32_t>(1, levelCount), 32);
+  _generateMipmaps = levelCount == 0;
+
+  if (cube)
+    _target = array ? GL_TEXTURE_CUBE_MAP_ARRAY : GL_TEXTURE_CUBE_MAP;
+  else
+    _target = array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+
+  if (!setLayers((uint64_t)std::max<uint32_t>(1, layerCount) * faceCount))
+    return false;
+
+  if (fileSize < 80 + (size_t)_levels * 24)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::TRUNCATED\n";
+    return false;
+  }
+
+  // Each level holds its layers back to back, and each layer its faces
+  _images.resize((size_t)_levels * _layers);
+  for (int level = 0; level < _levels; level++)
+  {
+    const unsigned char* entry = data + 80 + level * 24;
+    uint64_t offset = read64(entry);
+    uint64_t length = read64(entry + 8);
+    size_t size = imageSize(level);
+
+    if (length < (uint64_t)size * _layers || offset > fileSize || length > fileSize - offset)
+    {
+      std::cerr << "ERROR::TEXTURE_FILE::TRUNCATED\n";
+      return false;
+    }
+
+    for (int layer = 0; layer < _layers; layer++)
+      _images[level * _layers + layer] = { data + offset + (size_t)layer * size, size };
+  }
+
+  return true;
+}
+
+/**
+ * Checks the size, level count and layer count read from the header, then sets the layer count
+ * Called before anything is allocated for the images, the counts come straight from the file
+ *
+ * @param layers: The number of layers, 6 per cube for cube maps
+ *
+ * @returns: True if the layout is possible and fits in the file
+ */
+bool TextureFile::setLayers(uint64_t layers)
+{
+  if (_width <= 0 || _height <= 0 || _width > MAX_SIZE || _height > MAX_SIZE || _levels > Texture2D::mipLevels(_width, _height))
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::BAD_HEADER\n";
+    return false;
+  }
+
+  if (layers > MAX_LAYERS)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::TOO_MANY_LAYERS: " << layers << " layers, at most " << MAX_LAYERS << " are supported\n";
+    return false;
+  }
+
+  // GL only generates mips for color renderable formats
+  if (_generateMipmaps && _blockBytes)
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::UNSUPPORTED_FORMAT: Mips can't be generated for block compressed formats\n";
+    return false;
+  }
+
+  _layers = (int)layers;
+
+  // Every layer holds a whole mip chain, so a layer count the file can't hold is caught here
+  uint64_t layerBytes = 0;
+  for (int level = 0; level < _levels; level++)
+    layerBytes += imageSize(level);
+
+  if (layerBytes * layers > _file.getSize())
+  {
+    std::cerr << "ERROR::TEXTURE_FILE::TRUNCATED\n";
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Gets the size of one image of a level
+ *
+ * @param level: The mip level
+ *
+ * @returns: The size, in bytes
+ */
+size_t TextureFile::imageSize(int level) const
+{
+  size_t width = (size_t)std::max(1, _width >> level);
+  size_t height = (size_t)std::max(1, _height >> level);
+
+  if (_blockBytes)
+    return ((width + 3) / 4) * ((height + 3) / 4) * _blockBytes;
+
+  return width * height * _pixelBytes;
+}
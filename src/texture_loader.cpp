@@ -0,0 +1,227 @@
+#include <opengl-module/texture_loader.h>
+#include <opengl-module/block_compression.h>
+#include <opengl-module/memory_tracker.h>
+#include <opengl-module/thread_pool.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <iostream>
+
+/**
+ * Creates the placeholder texture
+ * Called by GL once the context exists
+ *
+ * @param pool: The pool to decode images on
+ */
+void TextureLoader::init(ThreadPool& pool)
+{
+  _pool = &pool;
+
+  // A single mid gray pixel, so unloaded textures read as neutral instead of black
+  const unsigned char gray[4] = { 128, 128, 128, 255 };
+  _placeholder.init(1, 1, GL_RGBA8, 1);
+  _placeholder.setData(0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, gray);
+}
+
+/**
+ * Deletes the placeholder and drops the uploads still queued
+ * Called by GL before the context is destroyed, once the pool has stopped
+ */
+void TextureLoader::destroy()
+{
+  // Partly uploaded textures own storage, so free it with the context still current
+  for (Pending& pending : _uploading)
+    pending.texture->_texture.destroy();
+  _uploading.clear();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _decoded.clear();
+  _placeholder.destroy();
+  _pool = nullptr;
+
+  // The workers have stopped, so the index is final
+  _imageCache.save();
+}
+
+/**
+ * Starts loading a texture
+ * Safe to call from any thread. The texture binds the placeholder until it's ready
+ *
+ * @param path: The image file to load
+ * @param srgb: Store the color channels as sRGB, for color maps
+ *
+ * @returns: The texture being loaded
+ */
+std::shared_ptr<AsyncTexture> TextureLoader::load(const std::string& path, bool srgb)
+{
+  std::shared_ptr<AsyncTexture> texture = std::make_shared<AsyncTexture>(&_placeholder);
+
+  if (!_pool)
+  {
+    std::cerr << "ERROR::TEXTURE_LOADER::NOT_RUNNING: Textures can only be loaded while GL is running\n";
+    texture->_state.store(AsyncTexture::Failed, std::memory_order_release);
+    return texture;
+  }
+
+  _loading.fetch_add(1, std::memory_order_relaxed);
+
+  // The tag is read here, the thread that uploads it has its own
+  int memoryTag = MemoryTracker::getCurrentTag();
+
+  bool cpuMipmaps = _cpuMipmaps;
+  MipFilter mipFilter = _mipFilter;
+  bool compress = _compress;
+  bool highQuality = _highQuality;
+
+  _pool->submit([this, texture, path, srgb, memoryTag, cpuMipmaps, mipFilter, compress, highQuality]() {
+    Pending pending;
+
+    // Already on a worker, and other images are decoding on the rest, so cook the whole texture here
+    // A cache hit skips decoding, so the cooker reads the file itself
+    if (compress)
+    {
+      if (!_cooker.cook(path, srgb, highQuality, pending.cooked))
+      {
+        texture->_state.store(AsyncTexture::Failed, std::memory_order_release);
+        _loading.fetch_sub(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    else
+    {
+      {
+        GL_TRACE_ZONE("TextureLoader::decode");
+
+        // Image::load sets stb_image's flip flag for this worker only, a cache hit maps the pixels instead
+        if (!_imageCache.load(path, pending.image))
+        {
+          texture->_state.store(AsyncTexture::Failed, std::memory_order_release);
+          _loading.fetch_sub(1, std::memory_order_relaxed);
+          return;
+        }
+      }
+
+      if (cpuMipmaps)
+        pending.mips = MipGenerator::generate(pending.image, srgb && pending.image.getChannels() >= 3, mipFilter);
+    }
+
+    pending.texture = texture;
+    pending.srgb = srgb;
+    pending.memoryTag = memoryTag;
+    pending.level = 0;
+    pending.rowsUploaded = 0;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _decoded.push_back(std::move(pending));
+  });
+
+  return texture;
+}
+
+/**
+ * Uploads decoded images until the frame's budget is spent
+ * Called by GL every frame on the thread that owns the context
+ * At least one row is uploaded per frame, so images larger than the budget still finish
+ */
+void TextureLoader::update()
+{
+  _uploadedLastFrame = 0;
+
+  // Take the newly decoded images, so the workers aren't blocked while this thread uploads
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (Pending& pending : _decoded)
+      _uploading.push_back(std::move(pending));
+    _decoded.clear();
+  }
+
+  if (_uploading.empty())
+    return;
+
+  GL_TRACE_ZONE("TextureLoader::upload");
+
+  while (!_uploading.empty() && (_uploadedLastFrame < _budget || _uploadedLastFrame == 0))
+  {
+    Pending& pending = _uploading.front();
+    const Image& image = pending.image;
+    const std::vector<CompressedLevel>& compressed = pending.cooked.levels;
+    Texture2D& texture = pending.texture->_texture;
+    GLenum format = Texture2D::formatFor(image.getChannels());
+
+    // Allocate the whole mip chain before the first slice, counted under the tag of whoever asked for it
+    if (pending.level == 0 && pending.rowsUploaded == 0)
+    {
+      int previousTag = MemoryTracker::getCurrentTag();
+      MemoryTracker::setCurrentTag(pending.memoryTag);
+      if (!compressed.empty())
+        texture.init(compressed[0].width, compressed[0].height, pending.cooked.internalFormat, (int)compressed.size());
+      else
+        texture.init(image.getWidth(), image.getHeight(), Texture2D::internalFormatFor(image.getChannels(), pending.srgb));
+      MemoryTracker::setCurrentTag(previousTag);
+    }
+
+    // The top level comes from the image, the rest from the mips built on the worker
+    // Compressed levels are uploaded a row of blocks, 4 rows of pixels, at a time
+    int width = image.getWidth();
+    int height = image.getHeight();
+    const unsigned char* data = image.getPixels();
+    size_t rowBytes = (size_t)width * image.getChannels();
+    int rowHeight = 1;
+    int levels = 1 + (int)pending.mips.size();
+
+    if (!compressed.empty())
+    {
+      const CompressedLevel& level = compressed[pending.level];
+      width = level.width;
+      height = level.height;
+      data = level.blocks.data();
+      rowBytes = BlockCompressor::compressedSize(pending.cooked.format, width, 1);
+      rowHeight = 4;
+      levels = (int)compressed.size();
+    }
+    else if (pending.level > 0)
+    {
+      const MipLevel& mip = pending.mips[pending.level - 1];
+      width = mip.width;
+      height = mip.height;
+      data = mip.pixels.data();
+      rowBytes = (size_t)width * image.getChannels();
+    }
+
+    // Upload as many whole rows as the rest of the budget allows
+    int totalRows = (height + rowHeight - 1) / rowHeight;
+    size_t remaining = _budget > _uploadedLastFrame ? _budget - _uploadedLastFrame : 0;
+    int rows = (int)std::max<size_t>(1, remaining / rowBytes);
+    rows = std::min(rows, totalRows - pending.rowsUploaded);
+
+    int y = pending.rowsUploaded * rowHeight;
+    int sliceHeight = std::min(rows * rowHeight, height - y);
+    const unsigned char* slice = data + pending.rowsUploaded * rowBytes;
+
+    if (!compressed.empty())
+      texture.setCompressedData(pending.level, 0, y, width, sliceHeight, rows * rowBytes, slice);
+    else
+      texture.setData(pending.level, 0, y, width, sliceHeight, format, GL_UNSIGNED_BYTE, slice);
+
+    pending.rowsUploaded += rows;
+    _uploadedLastFrame += rows * rowBytes;
+
+    if (pending.rowsUploaded < totalRows)
+      continue;
+
+    // Move on to the next level built on the worker, if there is one
+    if (pending.level + 1 < levels)
+    {
+      pending.level++;
+      pending.rowsUploaded = 0;
+      continue;
+    }
+
+    // Without CPU mips, they are only generated once, from the complete top level
+    if (compressed.empty() && pending.mips.empty())
+      texture.generateMipmaps();
+
+    pending.texture->_state.store(AsyncTexture::Ready, std::memory_order_release);
+    _loading.fetch_sub(1, std::memory_order_relaxed);
+    _uploading.pop_front();
+  }
+}
@@ -0,0 +1,189 @@
+#include <opengl-module/texture_stream.h>
+#include <opengl-module/state_cache.h>
+#include <opengl-module/texture.h>
+#include <opengl-module/trace.h>
+#include <cstring>
+#include <iostream>
+
+/**
+ * Creates and maps the ring
+ * Must be called with a current context
+ *
+ * @param sliceSize: The bytes that can be uploaded per frame
+ * @param slices:    The number of slices, one per frame that can be in flight
+ */
+void TextureStream::init(size_t sliceSize, int slices)
+{
+  if (isInitialized())
+    destroy();
+
+  if (slices < 1)
+    slices = 1;
+
+  // Keep every slice aligned, so regions at the start of a slice are too
+  sliceSize = (sliceSize + REGION_ALIGNMENT - 1) & ~(REGION_ALIGNMENT - 1);
+
+  // Coherent, so writes through the mapping are seen by the GPU without flushing
+  GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  _buffer.init((GLsizeiptr)(sliceSize * slices), nullptr, flags);
+  _mapped = (unsigned char*)glMapNamedBufferRange(_buffer.getID(), 0, (GLsizeiptr)(sliceSize * slices), flags);
+
+  if (!_mapped)
+  {
+    std::cerr << "ERROR::TEXTURE_STREAM::MAP_FAILED\n";
+    _buffer.destroy();
+    return;
+  }
+
+  _sliceSize = sliceSize;
+  _slices = slices;
+  _current = 0;
+  _used = 0;
+  _fences.assign(slices, nullptr);
+}
+
+/**
+ * Deletes the ring and its fences
+ * Must be called with a current context
+ */
+void TextureStream::destroy()
+{
+  if (!isInitialized())
+    return;
+
+  for (GLsync fence : _fences)
+  {
+    if (fence)
+      glDeleteSync(fence);
+  }
+  _fences.clear();
+
+  glUnmapNamedBuffer(_buffer.getID());
+  _buffer.destroy();
+
+  _mapped = nullptr;
+  _sliceSize = 0;
+  _slices = 0;
+}
+
+/**
+ * Reserves space in this frame's slice
+ * Write the pixels to the region's data, then pass it to upload()
+ *
+ * @param size: The size of the pixels, in bytes
+ *
+ * @returns: The region, whose data is nullptr if the slice is full
+ */
+StreamRegion TextureStream::allocate(size_t size)
+{
+  StreamRegion region;
+
+  if (!isInitialized() || size > _sliceSize - _used)
+  {
+    _overflows++;
+    return region;
+  }
+
+  region.offset = (size_t)_current * _sliceSize + _used;
+  region.data = _mapped + region.offset;
+  region.size = size;
+
+  _used = (_used + size + REGION_ALIGNMENT - 1) & ~(REGION_ALIGNMENT - 1);
+  if (_used > _sliceSize)
+    _used = _sliceSize;
+
+  return region;
+}
+
+/**
+ * Copies pixels already written to a region into part of a texture's mip level
+ * The copy is done by the GPU, so this never waits on it
+ *
+ * @param region:  The region holding the pixels, from allocate()
+ * @param texture: The texture to update
+ * @param level:   The mip level
+ * @param x:       The left edge of the region, in pixels
+ * @param y:       The bottom edge of the region, in pixels
+ * @param width:   The width of the region, in pixels
+ * @param height:  The height of the region, in pixels
+ * @param format:  The format of the pixel data
+ * @param type:    The type of the pixel data
+ */
+void TextureStream::upload(const StreamRegion& region, Texture2D& texture, int level, int x, int y, int width, int height, GLenum format, GLenum type)
+{
+  StateCache::checkContext("TextureStream::upload");
+
+  if (!region.data)
+    return;
+
+  // Unbind afterwards, other uploads pass client pointers that would be read as offsets into the ring
+  StateCache& stateCache = StateCache::current();
+  stateCache.bindBuffer(GL_PIXEL_UNPACK_BUFFER, _buffer.getID());
+  texture.setDataFromUnpackBuffer(level, x, y, width, height, format, type, region.offset, region.data);
+  stateCache.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+/**
+ * Copies pixels into the ring and uploads them to part of a texture's mip level
+ * If they don't fit in this frame's slice, they are uploaded from client memory instead
+ *
+ * @param texture: The texture to update
+ * @param level:   The mip level
+ * @param x:       The left edge of the region, in pixels
+ * @param y:       The bottom edge of the region, in pixels
+ * @param width:   The width of the region, in pixels
+ * @param height:  The height of the region, in pixels
+ * @param format:  The format of the pixel data
+ * @param type:    The type of the pixel data
+ * @param pixels:  The pixel data, rows tightly packed
+ *
+ * @returns: True if the pixels went through the ring
+ */
+bool TextureStream::upload(Texture2D& texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels)
+{
+  size_t size = (size_t)width * height * Texture2D::pixelBytes(format, type);
+  StreamRegion region = allocate(size);
+
+  if (!region.data)
+  {
+    texture.setData(level, x, y, width, height, format, type, pixels);
+    return false;
+  }
+
+  memcpy(region.data, pixels, size);
+  upload(region, texture, level, x, y, width, height, format, type);
+  return true;
+}
+
+/**
+ * Fences this frame's slice and moves on to the next one
+ * Waits if the GPU is still using the next slice, which only happens when it's more frames behind than there are slices
+ * Called by GL every frame, after the render callback
+ */
+void TextureStream::endFrame()
+{
+  if (!isInitialized())
+    return;
+
+  // An untouched slice has nothing for the GPU to finish
+  if (_used > 0)
+    _fences[_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  _current = (_current + 1) % _slices;
+  _used = 0;
+
+  GLsync& fence = _fences[_current];
+  if (!fence)
+    return;
+
+  GLenum status = glClientWaitSync(fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+  {
+    GL_TRACE_ZONE("TextureStream::stall");
+    _stalls++;
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+  }
+
+  glDeleteSync(fence);
+  fence = nullptr;
+}
@@ -0,0 +1,188 @@
+#include <opengl-module/thread_pool.h>
+#include <opengl-module/trace.h>
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// Finishes the queued tasks and stops the workers
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+/**
+ * Queues a task, starting the workers if they aren't running yet
+ * Safe to call from any thread, including from a task
+ *
+ * @param task: The work to run on a worker
+ */
+void ThreadPool::submit(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_threads.empty())
+    {
+      int count = _threadCount;
+      if (count <= 0)
+        count = (int)std::thread::hardware_concurrency() - 1;
+      if (count < 1)
+        count = 1;
+
+      _stop = false;
+      for (int i = 0; i < count; i++)
+        _threads.push_back(std::thread(&ThreadPool::threadMain, this, i));
+    }
+
+    _tasks.push_back(std::move(task));
+  }
+
+  _wake.notify_one();
+}
+
+/**
+ * Blocks until every queued task has finished
+ * Must not be called from a task
+ */
+void ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idle.wait(lock, [this] { return _tasks.empty() && _running == 0; });
+}
+
+/**
+ * Finishes the queued tasks and stops the workers
+ * Submitting again starts new workers
+ */
+void ThreadPool::stop()
+{
+  std::vector<std::thread> threads;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+    threads.swap(_threads);
+  }
+
+  _wake.notify_all();
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+/**
+ * Runs a loop body over a range, split into bands across a pool
+ * The calling thread runs the first band itself, and returns once every band has finished
+ * Only waits on its own bands, unlike wait(). Must not be called from a task of the same pool
+ *
+ * @param pool:  The pool to run the other bands on, or nullptr to run the whole range here
+ * @param count: The size of the range
+ * @param grain: The smallest band worth giving a task
+ * @param body:  Called with the start and end of each band
+ */
+void ThreadPool::parallelFor(ThreadPool* pool, int count, int grain, const std::function<void(int, int)>& body)
+{
+  int cores = std::max(1, (int)std::thread::hardware_concurrency());
+  int bands = std::min((count + grain - 1) / grain, cores);
+
+  if (!pool || bands <= 1)
+  {
+    body(0, count);
+    return;
+  }
+
+  // Counts down the bands still running on the pool, ThreadPool::wait() would also wait on unrelated tasks
+  struct Latch
+  {
+    std::mutex mutex;
+    std::condition_variable done;
+    int remaining;
+  };
+
+  std::shared_ptr<Latch> latch = std::make_shared<Latch>();
+  latch->remaining = bands - 1;
+
+  int bandSize = (count + bands - 1) / bands;
+  for (int band = 1; band < bands; band++)
+  {
+    int start = band * bandSize;
+    int end = std::min(count, start + bandSize);
+
+    pool->submit([latch, &body, start, end]() {
+      // Count the band even if it throws, or the caller would wait forever
+      struct CountDown
+      {
+        Latch& latch;
+        ~CountDown()
+        {
+          std::lock_guard<std::mutex> lock(latch.mutex);
+          if (--latch.remaining == 0)
+            latch.done.notify_one();
+        }
+      } countDown{ *latch };
+
+      if (start < end)
+        body(start, end);
+    });
+  }
+
+  // Wait for the other bands even if this one throws, they still refer to body
+  struct Wait
+  {
+    Latch& latch;
+    ~Wait()
+    {
+      std::unique_lock<std::mutex> lock(latch.mutex);
+      latch.done.wait(lock, [this] { return latch.remaining == 0; });
+    }
+  } wait{ *latch };
+
+  body(0, std::min(count, bandSize));
+}
+
+/**
+ * Runs tasks until the pool is stopped
+ *
+ * @param index: The worker's index, used to name it in traces
+ */
+void ThreadPool::threadMain(int index)
+{
+  Trace::setThreadName("Worker " + std::to_string(index));
+
+  while (true)
+  {
+    std::function<void()> task;
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wake.wait(lock, [this] { return _stop || !_tasks.empty(); });
+
+      // Only exit once every queued task has been run
+      if (_tasks.empty())
+        break;
+
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+      _running++;
+    }
+
+    try
+    {
+      task();
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << "ERROR::THREAD_POOL::TASK_FAILED: " << e.what() << "\n";
+    }
+    catch (...)
+    {
+      std::cerr << "ERROR::THREAD_POOL::TASK_FAILED: Unknown exception\n";
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running--;
+    if (_tasks.empty() && _running == 0)
+      _idle.notify_all();
+  }
+}
@@ -0,0 +1,385 @@
+#include <opengl-module/trace.h>
+#include <glad/glad.h>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+std::atomic<bool> Trace::_enabled(false);
+
+// The trace clock starts when the program does
+static const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+// Every thread's buffer, guarded by registryMutex
+// Buffers are never freed, so zones from threads that have exited can still be exported
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<TraceBuffer>> registry;
+static thread_local TraceBuffer* threadBuffer = nullptr;
+static thread_local std::string threadName; // Used when the thread's buffer is created
+
+// What a GPU zone's queries are waiting on
+enum class GpuZoneState
+{
+  Free,    // The queries can be reused
+  Open,    // The start query was issued, the zone hasn't ended
+  Pending  // Both queries were issued, the results may not be available yet
+};
+
+// GPU zones, only touched from the thread with the main window's context
+static GLuint gpuQueries[TRACE_GPU_ZONES * 2]; // A start and end GL_TIMESTAMP query per zone
+static const char* gpuNames[TRACE_GPU_ZONES];   // The name of each zone
+static GpuZoneState gpuStates[TRACE_GPU_ZONES]; // What each zone is waiting on
+static int gpuNext = 0;                         // The next zone to hand out
+static bool gpuInit = false;                    // Tracks if the queries have been created
+static int64_t gpuToTraceOffset = 0;            // Add to a GPU time to get a trace clock time
+static uint64_t gpuLastCalibration = 0;         // When the clocks were last calibrated
+static TraceBuffer* gpuBuffer = nullptr;        // The resolved GPU zones, shown as their own thread
+
+// Time between recalibrations of the GPU clock against the trace clock, in nanoseconds
+static const uint64_t GPU_CALIBRATION_INTERVAL = 1000000000;
+
+/**
+ * Creates a buffer and adds it to the registry
+ *
+ * @param name: The name of the buffer's thread
+ */
+static TraceBuffer* createBuffer(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+
+  registry.push_back(std::unique_ptr<TraceBuffer>(new TraceBuffer((int)registry.size(), name)));
+  return registry.back().get();
+}
+
+/**
+ * Gets the calling thread's buffer, creating it the first time
+ */
+static TraceBuffer* getThreadBuffer()
+{
+  if (!threadBuffer)
+    threadBuffer = createBuffer(threadName);
+
+  return threadBuffer;
+}
+
+/**
+ * Measures the offset between the GPU clock and the trace clock
+ */
+static void calibrateGpu()
+{
+  GLint64 gpuTime;
+  glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+
+  gpuLastCalibration = Trace::now();
+  gpuToTraceOffset = (int64_t)gpuLastCalibration - gpuTime;
+}
+
+/**
+ * Writes a string as a JSON string, escaping what needs it
+ *
+ * @param file: The file to write to
+ * @param text: The string to write
+ */
+static void writeJsonString(FILE* file, const char* text)
+{
+  fputc('"', file);
+
+  for (; *text; text++)
+  {
+    if (*text == '"' || *text == '\\')
+      fputc('\\', file);
+
+    if ((unsigned char)*text >= 0x20)
+      fputc(*text, file);
+  }
+
+  fputc('"', file);
+}
+
+/**
+ * TraceBuffer Constructor
+ *
+ * @param id:   A small id, unique to the owning thread
+ * @param name: The owning thread's name, or empty
+ */
+TraceBuffer::TraceBuffer(int id, const std::string& name) : _slots(TRACE_BUFFER_ZONES), _head(0), _id(id), _name(name) {}
+
+/**
+ * Copies out the zones that ended at or after a time
+ * Zones the writer overwrote while they were being copied are left out
+ *
+ * @param since:  The earliest end time to copy
+ * @param events: The zones are appended to this
+ */
+void TraceBuffer::copy(uint64_t since, std::vector<TraceEvent>& events) const
+{
+  uint64_t head = _head.load(std::memory_order_acquire);
+  uint64_t first = head > TRACE_BUFFER_ZONES ? head - TRACE_BUFFER_ZONES : 0;
+
+  std::vector<TraceEvent> copied;
+  copied.reserve(head - first);
+
+  for (uint64_t i = first; i < head; i++)
+  {
+    const Slot& slot = _slots[i & (TRACE_BUFFER_ZONES - 1)];
+
+    TraceEvent event;
+    event.name = slot.name.load(std::memory_order_relaxed);
+    event.start = slot.start.load(std::memory_order_relaxed);
+    event.end = slot.end.load(std::memory_order_relaxed);
+    copied.push_back(event);
+  }
+
+  // The writer may have lapped the copy, anything it could have started overwriting is dropped
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint64_t newHead = _head.load(std::memory_order_relaxed);
+  uint64_t valid = newHead >= TRACE_BUFFER_ZONES ? newHead - TRACE_BUFFER_ZONES + 1 : 0;
+
+  for (uint64_t i = first; i < head; i++)
+  {
+    const TraceEvent& event = copied[i - first];
+    if (i >= valid && event.end >= since)
+      events.push_back(event);
+  }
+}
+
+/**
+ * Starts or stops recording zones
+ * Each thread keeps its last TRACE_BUFFER_ZONES zones, so nothing grows while it runs
+ *
+ * @param enabled: True to record zones
+ */
+void Trace::setEnabled(bool enabled)
+{
+  _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * Gets the current time on the trace clock
+ *
+ * @returns: Nanoseconds since the trace clock started
+ */
+uint64_t Trace::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+/**
+ * Records a zone on the calling thread
+ *
+ * @param name:  The zone's name, must outlive the trace, string literals are best
+ * @param start: When the zone started, from Trace::now()
+ * @param end:   When the zone ended, from Trace::now()
+ */
+void Trace::record(const char* name, uint64_t start, uint64_t end)
+{
+  getThreadBuffer()->write(name, start, end);
+}
+
+/**
+ * Names the calling thread in exported traces
+ *
+ * @param name: The thread's name
+ */
+void Trace::setThreadName(const std::string& name)
+{
+  // Threads that never record a zone shouldn't pay for a buffer
+  if (!threadBuffer)
+  {
+    threadName = name;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  threadBuffer->_name = name;
+}
+
+/**
+ * Starts a GPU zone with a GL_TIMESTAMP query
+ * Only call from the thread with the main window's context
+ *
+ * @param name: The zone's name, must outlive the trace
+ *
+ * @returns: A handle for gpuEnd(), or -1 if tracing is off or too many zones are pending
+ */
+int Trace::gpuBegin(const char* name)
+{
+  if (!isEnabled())
+    return -1;
+
+  if (!gpuInit)
+  {
+    glGenQueries(TRACE_GPU_ZONES * 2, gpuQueries);
+    for (GpuZoneState& state : gpuStates)
+      state = GpuZoneState::Free;
+
+    if (!gpuBuffer)
+      gpuBuffer = createBuffer("GPU");
+
+    calibrateGpu();
+    gpuInit = true;
+  }
+
+  // Zones are handed out in order, so if the next one is busy the GPU is far behind
+  int zone = gpuNext;
+  if (gpuStates[zone] != GpuZoneState::Free)
+    return -1;
+
+  glQueryCounter(gpuQueries[zone * 2], GL_TIMESTAMP);
+  gpuNames[zone] = name;
+  gpuStates[zone] = GpuZoneState::Open;
+  gpuNext = (gpuNext + 1) % TRACE_GPU_ZONES;
+  return zone;
+}
+
+/**
+ * Ends a GPU zone with a GL_TIMESTAMP query
+ *
+ * @param zone: The handle from gpuBegin(), -1 is ignored
+ */
+void Trace::gpuEnd(int zone)
+{
+  if (zone < 0 || !gpuInit || gpuStates[zone] != GpuZoneState::Open)
+    return;
+
+  glQueryCounter(gpuQueries[zone * 2 + 1], GL_TIMESTAMP);
+  gpuStates[zone] = GpuZoneState::Pending;
+}
+
+/**
+ * Reads back the GPU zones whose queries are available, without waiting for the rest
+ * GPU times are moved onto the trace clock using GL_TIMESTAMP, so they line up with CPU zones
+ * GL calls this once a frame, only call from the thread with the main window's context
+ */
+void Trace::resolveGpu()
+{
+  if (!gpuInit)
+    return;
+
+  // The clocks drift apart slowly, so keep the offset fresh
+  if (now() - gpuLastCalibration > GPU_CALIBRATION_INTERVAL)
+    calibrateGpu();
+
+  for (int zone = 0; zone < TRACE_GPU_ZONES; zone++)
+  {
+    if (gpuStates[zone] != GpuZoneState::Pending)
+      continue;
+
+    // The end query finishes last, so once it's available both are
+    GLuint available = 0;
+    glGetQueryObjectuiv(gpuQueries[zone * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      continue;
+
+    GLuint64 start, end;
+    glGetQueryObjectui64v(gpuQueries[zone * 2], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(gpuQueries[zone * 2 + 1], GL_QUERY_RESULT, &end);
+
+    int64_t traceStart = (int64_t)start + gpuToTraceOffset;
+    int64_t traceEnd = (int64_t)end + gpuToTraceOffset;
+    if (traceStart < 0)
+      traceStart = 0;
+    if (traceEnd < traceStart)
+      traceEnd = traceStart;
+
+    gpuBuffer->write(gpuNames[zone], (uint64_t)traceStart, (uint64_t)traceEnd);
+    gpuStates[zone] = GpuZoneState::Free;
+  }
+}
+
+/**
+ * Deletes the GPU queries, pending GPU zones are dropped
+ * Must be called with the main window's context current
+ */
+void Trace::destroyGpu()
+{
+  if (!gpuInit)
+    return;
+
+  glDeleteQueries(TRACE_GPU_ZONES * 2, gpuQueries);
+  gpuNext = 0;
+  gpuInit = false;
+}
+
+/**
+ * Copies out the zones of every thread
+ *
+ * @param since:   The earliest end time to copy, 0 for everything still in the rings
+ * @param threads: Filled with one entry per thread that has zones
+ */
+void Trace::snapshot(uint64_t since, std::vector<TraceThread>& threads)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+
+  threads.clear();
+  for (const std::unique_ptr<TraceBuffer>& buffer : registry)
+  {
+    TraceThread thread;
+    thread.name = buffer->_name;
+    thread.id = buffer->_id;
+    buffer->copy(since, thread.events);
+
+    if (!thread.events.empty())
+      threads.push_back(thread);
+  }
+}
+
+/**
+ * Writes zones as Chrome trace event JSON
+ *
+ * @param file:    The file to write to
+ * @param threads: The zones, from snapshot()
+ */
+void Trace::writeChrome(FILE* file, const std::vector<TraceThread>& threads)
+{
+  fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  bool first = true;
+  for (const TraceThread& thread : threads)
+  {
+    if (!thread.name.empty())
+    {
+      fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", thread.id);
+      writeJsonString(file, thread.name.c_str());
+      fprintf(file, "}}");
+      first = false;
+    }
+
+    for (const TraceEvent& event : thread.events)
+    {
+      fprintf(file, "%s{\"name\":", first ? "" : ",\n");
+      writeJsonString(file, event.name ? event.name : "");
+
+      // Chrome expects microseconds, keep the nanoseconds as decimals
+      fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", thread.id, event.start / 1000.0,
+              (event.end - event.start) / 1000.0);
+      first = false;
+    }
+  }
+
+  fprintf(file, "\n]}\n");
+}
+
+/**
+ * Writes every zone still in the rings to a Chrome trace event JSON file
+ *
+ * @param path: The file to write
+ *
+ * @returns: True if the file was written
+ */
+bool Trace::exportChrome(const std::string& path)
+{
+  std::vector<TraceThread> threads;
+  snapshot(0, threads);
+
+  FILE* file = fopen(path.c_str(), "w");
+  if (!file)
+  {
+    std::cerr << "ERROR::TRACE::FILE_NOT_OPENED: " << path << "\n";
+    return false;
+  }
+
+  writeChrome(file, threads);
+  fclose(file);
+  return true;
+}
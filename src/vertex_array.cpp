@@ -0,0 +1,161 @@
+#include <opengl-module/vertex_array.h>
+#include <opengl-module/buffer.h>
+#include <opengl-module/capture.h>
+#include <opengl-module/state_cache.h>
+
+/**
+ * Initializes the vertex array
+ */
+void VertexArray::init()
+{
+  StateCache::checkContext("VertexArray::init");
+
+  if (_init)
+    destroy();
+
+  glCreateVertexArrays(1, &_id);
+  _init = true;
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::CreateVertexArray, { _id });
+}
+
+/**
+ * Deletes the vertex array
+ */
+void VertexArray::destroy()
+{
+  StateCache::checkContext("VertexArray::destroy");
+
+  if (!_init)
+    return;
+
+  StateCache::current().forgetVertexArray(_id);
+  glDeleteVertexArrays(1, &_id);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::DeleteVertexArray, { _id });
+
+  _id = 0;
+  _init = false;
+}
+
+/**
+ * Attaches a buffer as a source of vertex data
+ *
+ * @param bindingIndex: The binding index attributes read from
+ * @param buffer:       The buffer holding the vertices
+ * @param offset:       The offset of the first vertex, in bytes
+ * @param stride:       The distance between vertices, in bytes
+ */
+void VertexArray::setVertexBuffer(GLuint bindingIndex, const Buffer& buffer, GLintptr offset, GLsizei stride)
+{
+  StateCache::checkContext("VertexArray::setVertexBuffer");
+
+  if (!_init)
+    return;
+
+  glVertexArrayVertexBuffer(_id, bindingIndex, buffer.getID(), offset, stride);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::VertexArrayVertexBuffer, { _id, bindingIndex, buffer.getID(), (uint32_t)offset, (uint32_t)stride });
+}
+
+/**
+ * Attaches a buffer as the source of indices
+ *
+ * @param buffer: The buffer holding the indices
+ */
+void VertexArray::setElementBuffer(const Buffer& buffer)
+{
+  StateCache::checkContext("VertexArray::setElementBuffer");
+
+  if (!_init)
+    return;
+
+  glVertexArrayElementBuffer(_id, buffer.getID());
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::VertexArrayElementBuffer, { _id, buffer.getID() });
+}
+
+/**
+ * Enables and describes a floating point vertex attribute
+ *
+ * @param attribute:      The attribute location
+ * @param size:           The number of components
+ * @param type:           The type of each component
+ * @param normalized:     True to normalize integer types to [0, 1] or [-1, 1]
+ * @param relativeOffset: The offset of the attribute within a vertex, in bytes
+ * @param bindingIndex:   The binding index to read the attribute from
+ */
+void VertexArray::setAttribute(GLuint attribute, GLint size, GLenum type, bool normalized, GLuint relativeOffset, GLuint bindingIndex)
+{
+  StateCache::checkContext("VertexArray::setAttribute");
+
+  if (!_init)
+    return;
+
+  glEnableVertexArrayAttrib(_id, attribute);
+  glVertexArrayAttribFormat(_id, attribute, size, type, normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+  glVertexArrayAttribBinding(_id, attribute, bindingIndex);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::VertexArrayAttribute, { _id, attribute, (uint32_t)size, type, normalized ? 1u : 0u, relativeOffset, bindingIndex });
+}
+
+/**
+ * Binds the vertex array
+ */
+void VertexArray::bind() const
+{
+  StateCache::checkContext("VertexArray::bind");
+
+  if (_init)
+    StateCache::current().bindVertexArray(_id);
+}
+
+/**
+ * Binds the vertex array and draws vertices in order
+ *
+ * @param mode:      The primitive type
+ * @param first:     The first vertex
+ * @param count:     The number of vertices
+ * @param instances: The number of instances
+ */
+void VertexArray::drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instances) const
+{
+  StateCache::checkContext("VertexArray::drawArrays");
+
+  if (!_init)
+    return;
+
+  bind();
+  glDrawArraysInstanced(mode, first, count, instances);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::DrawArrays, { mode, (uint32_t)first, (uint32_t)count, (uint32_t)instances, 0 });
+}
+
+/**
+ * Binds the vertex array and draws vertices using the element buffer
+ *
+ * @param mode:      The primitive type
+ * @param count:     The number of indices
+ * @param type:      The type of the indices
+ * @param offset:    The offset of the first index, in bytes
+ * @param instances: The number of instances
+ */
+void VertexArray::drawElements(GLenum mode, GLsizei count, GLenum type, size_t offset, GLsizei instances) const
+{
+  StateCache::checkContext("VertexArray::drawElements");
+
+  if (!_init)
+    return;
+
+  bind();
+  glDrawElementsInstanced(mode, count, type, (const void*)offset, instances);
+
+  if (Capture::isActive())
+    Capture::record(CaptureOp::DrawElements, { mode, (uint32_t)count, type, (uint32_t)offset, (uint32_t)instances, 0, 0 });
+}
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Generates src/glad_lazy.c from include/glad/glad.h
+
+gladLoadGLLoader() resolves every entry point up front. The generated
+gladLoadGLLoaderLazy() instead points each glad_gl* function pointer at a
+trampoline that resolves the real function and patches the pointer on its
+first call, so only the functions an app actually uses are ever looked up.
+
+Run it again whenever glad.h is regenerated:
+    python3 tools/gen_glad_lazy.py [glad.h] [output.c]
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# typedef <return> (APIENTRYP PFNGL<NAME>PROC)(<params>);
+TYPEDEF = re.compile(r"^typedef\s+(.+?)\s*\(APIENTRYP\s+(PFNGL\w+PROC)\)\((.*)\);\s*$")
+
+# GLAPI PFNGL<NAME>PROC glad_gl<Name>;
+POINTER = re.compile(r"^GLAPI\s+(PFNGL\w+PROC)\s+glad_(gl\w+);\s*$")
+
+# GLAPI int GLAD_GL_VERSION_<major>_<minor>;
+VERSION = re.compile(r"^GLAPI\s+int\s+GLAD_GL_VERSION_(\d+)_(\d+);\s*$")
+
+
+def parameter_names(params):
+    """Gets the names of a typedef's parameters, in order"""
+    params = params.strip()
+    if params in ("", "void"):
+        return []
+
+    names = []
+    for param in params.split(","):
+        name = re.findall(r"\w+", param)[-1]
+        names.append(name)
+    return names
+
+
+def parse(header):
+    """Gets the function typedefs, function pointers and versions declared by glad.h"""
+    typedefs = {}
+    pointers = []
+    versions = []
+
+    with open(header) as file:
+        for line in file:
+            match = TYPEDEF.match(line)
+            if match:
+                typedefs[match.group(2)] = (match.group(1), match.group(3))
+                continue
+
+            match = POINTER.match(line)
+            if match:
+                pointers.append((match.group(1), match.group(2)))
+                continue
+
+            match = VERSION.match(line)
+            if match:
+                versions.append((int(match.group(1)), int(match.group(2))))
+
+    return typedefs, pointers, versions
+
+
+def generate(typedefs, pointers, versions):
+    """Builds the source of glad_lazy.c"""
+    out = []
+    out.append("/*")
+    out.append("    Lazy OpenGL loader, generated from glad.h by tools/gen_glad_lazy.py")
+    out.append("    Do not edit, run the generator again instead")
+    out.append("")
+    out.append("    Every glad_gl* pointer starts out pointing at a trampoline that resolves the real")
+    out.append("    function and patches the pointer on the first call. Racing first calls from")
+    out.append("    several threads resolve the same address, so the patch is idempotent")
+    out.append("*/")
+    out.append("")
+    out.append("#include <stdio.h>")
+    out.append("#include <glad/glad_lazy.h>")
+    out.append("")
+    out.append("static GLADloadproc lazyLoad = NULL;")
+    out.append("")
+    out.append("/* Resolves a function, reporting the ones the driver doesn't have */")
+    out.append("static void* glad_lazy_resolve(const char* name) {")
+    out.append("    void* proc = lazyLoad ? lazyLoad(name) : NULL;")
+    out.append("    if (proc == NULL) {")
+    out.append('        fprintf(stderr, "ERROR::GLAD_LAZY::FUNCTION_NOT_FOUND: %s\\n", name);')
+    out.append("    }")
+    out.append("    return proc;")
+    out.append("}")
+    out.append("")
+
+    for pfn, name in pointers:
+        ret, params = typedefs[pfn]
+        names = parameter_names(params)
+        args = ", ".join(names)
+        signature = params if params.strip() else "void"
+
+        out.append("static %s APIENTRY glad_lazy_%s(%s) {" % (ret, name, signature))
+        out.append('    glad_%s = (%s)glad_lazy_resolve("%s");' % (name, pfn, name))
+        if ret == "void":
+            out.append("    glad_%s(%s);" % (name, args))
+        else:
+            out.append("    return glad_%s(%s);" % (name, args))
+        out.append("}")
+
+    out.append("")
+    out.append("int gladLoadGLLoaderLazy(GLADloadproc load) {")
+    out.append("    const char* version;")
+    out.append("    int major = 0, minor = 0;")
+    out.append("")
+    out.append("    lazyLoad = load;")
+    out.append("    GLVersion.major = 0; GLVersion.minor = 0;")
+    out.append("")
+    for pfn, name in pointers:
+        out.append("    glad_%s = glad_lazy_%s;" % (name, name))
+    out.append("")
+    out.append("    /* Resolve glGetString now, a missing one means there is no usable context */")
+    out.append('    glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");')
+    out.append("    if (glad_glGetString == NULL) return 0;")
+    out.append("")
+    out.append("    version = (const char*)glad_glGetString(GL_VERSION);")
+    out.append("    if (version == NULL) return 0;")
+    out.append("")
+    out.append("    /* Skip a prefix like \"OpenGL ES \" before the version number */")
+    out.append("    while (*version && (*version < '0' || *version > '9')) version++;")
+    out.append("#ifdef _MSC_VER")
+    out.append('    sscanf_s(version, "%d.%d", &major, &minor);')
+    out.append("#else")
+    out.append('    sscanf(version, "%d.%d", &major, &minor);')
+    out.append("#endif")
+    out.append("")
+    out.append("    GLVersion.major = major; GLVersion.minor = minor;")
+    for major, minor in versions:
+        out.append("    GLAD_GL_VERSION_%d_%d = (major == %d && minor >= %d) || major > %d;" % (major, minor, major, minor, major))
+    out.append("")
+    out.append("    return GLVersion.major != 0 || GLVersion.minor != 0;")
+    out.append("}")
+    out.append("")
+
+    return "\n".join(out)
+
+
+def main():
+    header = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, "include", "glad", "glad.h")
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, "src", "glad_lazy.c")
+
+    typedefs, pointers, versions = parse(header)
+
+    missing = [pfn for pfn, _ in pointers if pfn not in typedefs]
+    if missing:
+        sys.exit("No typedef found for: " + ", ".join(missing))
+
+    with open(output, "w") as file:
+        file.write(generate(typedefs, pointers, versions))
+
+    print("Wrote %d trampolines to %s" % (len(pointers), output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,316 @@
+// Drives GL::run() through synthetic scenes and reports frame times as JSON
+// Usage: gl_bench [frames per scene] [output file]
+//
+// Every scene runs for the same number of frames with vsync off in a hidden window,
+// rendering into an offscreen target. The JSON goes to stdout unless a file is given
+
+#include <opengl-module/gl.h>
+#include <opengl-module/buffer.h>
+#include <opengl-module/command_bucket.h>
+#include <opengl-module/shader.h>
+#include <opengl-module/vertex_array.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const int WARMUP_FRAMES = 10;         // Frames run before each scene is measured
+const int SCENE_DRAWS = 10000;        // Draws per frame in the draws and bucket scenes
+const int SCENE_UNIFORM_DRAWS = 2000; // Draws per frame in the uniforms scene, each sets 4 uniforms
+const int SCENE_TEXTURE_DRAWS = 2000; // Draws per frame in the textures scene, each binds a texture
+const int SCENE_TEXTURES = 64;        // Textures cycled through in the textures scene
+
+const char* VERTEX_SHADER = "#version 450 core\n"
+                            "layout(location = 0) in vec2 position;\n"
+                            "uniform float u0, u1, u2, u3;\n"
+                            "void main() { gl_Position = vec4(position * 0.01 + vec2(u0 + u2, u1 + u3), 0.0, 1.0); }\n";
+
+const char* FRAGMENT_SHADER = "#version 450 core\n"
+                              "layout(binding = 0) uniform sampler2D tex;\n"
+                              "out vec4 color;\n"
+                              "void main() { color = texture(tex, vec2(0.5)); }\n";
+
+// A synthetic workload, rendered every frame while it is measured
+struct Scene
+{
+  const char* name;     // The name reported in the results
+  void (*render)();     // Renders one frame of the scene
+  int drawsPerFrame;    // The number of draws render() makes
+
+  std::vector<FrameTiming> timings; // The timings of every measured frame
+};
+
+Shader shader;
+Buffer vertices;
+VertexArray vertexArray;
+GLuint textures[SCENE_TEXTURES];
+CommandBucket bucket(SCENE_DRAWS);
+int renderTarget;
+
+/**
+ * Many draws with no state changes between them
+ */
+void renderDraws()
+{
+  for (int i = 0; i < SCENE_DRAWS; i++)
+    vertexArray.drawArrays(GL_TRIANGLES, (i % 64) * 3, 3);
+}
+
+/**
+ * Draws that each set a few uniforms first
+ */
+void renderUniforms()
+{
+  for (int i = 0; i < SCENE_UNIFORM_DRAWS; i++)
+  {
+    float value = (i % 100) * 0.01f;
+    shader.setFloat("u0", value);
+    shader.setFloat("u1", -value);
+    shader.setFloat("u2", value * 0.5f);
+    shader.setFloat("u3", -value * 0.5f);
+    vertexArray.drawArrays(GL_TRIANGLES, 0, 3);
+  }
+
+  shader.setFloat("u0", 0.0f);
+  shader.setFloat("u1", 0.0f);
+  shader.setFloat("u2", 0.0f);
+  shader.setFloat("u3", 0.0f);
+}
+
+/**
+ * Draws that each bind a different texture
+ */
+void renderTextures()
+{
+  StateCache& cache = StateCache::current();
+
+  for (int i = 0; i < SCENE_TEXTURE_DRAWS; i++)
+  {
+    cache.bindTexture(0, textures[i % SCENE_TEXTURES]);
+    vertexArray.drawArrays(GL_TRIANGLES, 0, 3);
+  }
+
+  cache.bindTexture(0, textures[0]);
+}
+
+/**
+ * Many draws recorded in random order and sorted by a command bucket
+ */
+void renderBucket()
+{
+  bucket.clear();
+
+  for (int i = 0; i < SCENE_DRAWS; i++)
+  {
+    int material = rand() % SCENE_TEXTURES;
+
+    DrawCommand command;
+    command.program = shader.getID();
+    command.vertexArray = vertexArray.getID();
+    command.textures[0] = textures[material];
+    command.first = (i % 64) * 3;
+    command.count = 3;
+    bucket.add(makeSortKey(0, 0, material, depthKey((float)rand() / RAND_MAX)), command);
+  }
+
+  bucket.submit();
+}
+
+Scene scenes[] = {
+  { "draws", renderDraws, SCENE_DRAWS, {} },
+  { "uniforms", renderUniforms, SCENE_UNIFORM_DRAWS, {} },
+  { "textures", renderTextures, SCENE_TEXTURE_DRAWS, {} },
+  { "bucket", renderBucket, SCENE_DRAWS, {} },
+};
+const int SCENE_COUNT = sizeof(scenes) / sizeof(scenes[0]);
+
+int framesPerScene = 300; // Measured frames per scene
+int frame = 0;            // Frames rendered so far, including warm up
+
+/**
+ * Gets the scene a frame belongs to, and whether the frame is measured
+ *
+ * @param index:    The frame
+ * @param measured: Set to true if the frame is past the scene's warm up
+ *
+ * @returns The scene's index, SCENE_COUNT once every scene has run
+ */
+int sceneOf(int index, bool& measured)
+{
+  int framesPerSlot = WARMUP_FRAMES + framesPerScene;
+  measured = index % framesPerSlot >= WARMUP_FRAMES;
+  return index / framesPerSlot;
+}
+
+/**
+ * Creates the objects every scene shares
+ */
+void init()
+{
+  shader.initFromSource(VERTEX_SHADER, FRAGMENT_SHADER);
+
+  // 64 small triangles spread over the target
+  std::vector<float> data;
+  for (int i = 0; i < 64; i++)
+  {
+    float x = (i % 8) * 25.0f - 87.5f;
+    float y = (i / 8) * 25.0f - 87.5f;
+    float triangle[] = { x, y, x + 10.0f, y, x, y + 10.0f };
+    data.insert(data.end(), triangle, triangle + 6);
+  }
+
+  vertices.init(data.size() * sizeof(float), data.data(), 0);
+  vertexArray.init();
+  vertexArray.setVertexBuffer(0, vertices, 0, 2 * sizeof(float));
+  vertexArray.setAttribute(0, 2, GL_FLOAT, false, 0);
+
+  glCreateTextures(GL_TEXTURE_2D, SCENE_TEXTURES, textures);
+  for (int i = 0; i < SCENE_TEXTURES; i++)
+  {
+    unsigned char texel[4] = { (unsigned char)(i * 4), 128, 255, 255 };
+    glTextureStorage2D(textures[i], 1, GL_RGBA8, 1, 1);
+    glTextureSubImage2D(textures[i], 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+  }
+
+  RenderTargetDesc desc;
+  desc.depthFormat = 0;
+  renderTarget = GL::getInstance().getRenderTargets().add("bench", desc);
+}
+
+/**
+ * Stores the timing of the last frame and moves through the scenes
+ */
+void update()
+{
+  // GL has just finished the previous frame, so its timing belongs to that frame
+  if (frame > 0)
+  {
+    bool measured;
+    int scene = sceneOf(frame - 1, measured);
+    if (measured)
+      scenes[scene].timings.push_back(GL::getInstance().getFrameTiming());
+  }
+
+  bool measured;
+  if (sceneOf(frame, measured) >= SCENE_COUNT)
+    glfwSetWindowShouldClose(GL::getInstance().getWindow(), GLFW_TRUE);
+}
+
+/**
+ * Renders the current scene into the offscreen target
+ */
+void render()
+{
+  bool measured;
+  int scene = sceneOf(frame++, measured);
+  if (scene >= SCENE_COUNT)
+    return;
+
+  StateCache& cache = StateCache::current();
+  const RenderTarget& target = GL::getInstance().getRenderTargets().get(renderTarget);
+  cache.bindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+  cache.viewport(0, 0, target.width, target.height);
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  shader.use();
+  cache.bindTexture(0, textures[0]);
+  scenes[scene].render();
+
+  cache.bindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**
+ * Gets a percentile of sorted values, using the nearest rank
+ *
+ * @param sorted:     The values, in ascending order
+ * @param percentile: The percentile, from 0 to 100
+ */
+double percentile(const std::vector<double>& sorted, double percentile)
+{
+  if (sorted.empty())
+    return 0.0;
+
+  size_t rank = (size_t)(percentile / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[rank];
+}
+
+/**
+ * Writes the results of every scene
+ *
+ * @param out: The file to write the JSON to
+ */
+void writeResults(FILE* out)
+{
+  fprintf(out, "{\n  \"frames_per_scene\": %d,\n  \"scenes\": [\n", framesPerScene);
+
+  for (int i = 0; i < SCENE_COUNT; i++)
+  {
+    const Scene& scene = scenes[i];
+
+    std::vector<double> frameTimes;
+    FrameTiming mean;
+    double total = 0.0;
+
+    for (size_t j = 0; j < scene.timings.size(); j++)
+    {
+      const FrameTiming& timing = scene.timings[j];
+      double frameTime = timing.poll + timing.update + timing.render + timing.present;
+      frameTimes.push_back(frameTime);
+      total += frameTime;
+
+      mean.poll += timing.poll;
+      mean.update += timing.update;
+      mean.render += timing.render;
+      mean.present += timing.present;
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+
+    double count = frameTimes.empty() ? 1.0 : (double)frameTimes.size();
+    double drawsPerSecond = total > 0.0 ? scene.drawsPerFrame * frameTimes.size() / (total / 1000.0) : 0.0;
+
+    fprintf(out, "    {\n");
+    fprintf(out, "      \"name\": \"%s\",\n", scene.name);
+    fprintf(out, "      \"frames\": %zu,\n", frameTimes.size());
+    fprintf(out, "      \"draws_per_frame\": %d,\n", scene.drawsPerFrame);
+    fprintf(out, "      \"draws_per_second\": %.0f,\n", drawsPerSecond);
+    fprintf(out, "      \"frame_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n", total / count,
+            percentile(frameTimes, 50), percentile(frameTimes, 90), percentile(frameTimes, 99), frameTimes.empty() ? 0.0 : frameTimes.back());
+    fprintf(out, "      \"phase_ms\": { \"poll\": %.4f, \"update\": %.4f, \"render\": %.4f, \"present\": %.4f }\n", mean.poll / count,
+            mean.update / count, mean.render / count, mean.present / count);
+    fprintf(out, "    }%s\n", i + 1 < SCENE_COUNT ? "," : "");
+  }
+
+  fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+  if (argc >= 2)
+    framesPerScene = std::max(1, atoi(argv[1]));
+
+  GL& gl = GL::getInstance();
+  gl.setWindowVisible(false);
+  gl.setSwapInterval(0);
+
+  if (gl.run(update, render, init, "gl_bench", 256, 256) != 0)
+    return -1;
+
+  FILE* out = stdout;
+  if (argc >= 3)
+  {
+    out = fopen(argv[2], "w");
+    if (!out)
+    {
+      fprintf(stderr, "ERROR::BENCH::FILE_NOT_OPENED: %s\n", argv[2]);
+      return -1;
+    }
+  }
+
+  writeResults(out);
+
+  if (out != stdout)
+    fclose(out);
+
+  return 0;
+}
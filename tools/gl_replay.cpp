@@ -0,0 +1,638 @@
+// Replays a capture written by GL::setCapture() and reports how long each frame and each call took
+// Usage: gl_replay <capture file> [width height]
+//
+// The capture is replayed in a hidden window, so timings reflect the recorded GL work alone,
+// without the app's own CPU work in between calls
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <opengl-module/capture.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A call read from the capture
+struct Record
+{
+  CaptureOp op;            // The call
+  const uint8_t* args;     // The call's arguments, not necessarily aligned
+  uint16_t argCount;       // The number of arguments
+  const uint8_t* payload;  // Data the call reads, or nullptr
+  uint32_t payloadSize;    // The size of the payload, in bytes
+};
+
+// Time spent on one kind of call
+struct OpStats
+{
+  uint64_t count = 0;      // The number of times the call was replayed
+  double cpuSeconds = 0.0; // The total CPU time spent issuing it
+};
+
+// Time spent on one frame
+struct FrameStats
+{
+  size_t calls = 0;        // The number of calls replayed
+  double cpuSeconds = 0.0; // The CPU time spent issuing the frame's calls
+  GLuint query = 0;        // A GL_TIME_ELAPSED query around the frame
+};
+
+// Maps object names at capture time to the names created during replay
+// Name 0 always maps to 0, so the default framebuffer and unbinding work unchanged
+typedef std::unordered_map<uint32_t, GLuint> NameMap;
+
+static NameMap programs;
+static NameMap buffers;
+static NameMap vertexArrays;
+static NameMap textures;
+static NameMap framebuffers;
+static NameMap renderbuffers;
+
+/**
+ * Looks up the replay name of a captured object
+ *
+ * @param names: The map for the object's type
+ * @param name:  The name at capture time
+ *
+ * @returns The name during replay, 0 if the object was never created
+ */
+static GLuint lookup(const NameMap& names, uint32_t name)
+{
+  NameMap::const_iterator it = names.find(name);
+  return it == names.end() ? 0 : it->second;
+}
+
+/**
+ * Gets a readable name for a call
+ *
+ * @param op: The call
+ */
+static const char* opName(CaptureOp op)
+{
+  static const char* names[] = { "",
+                                 "FrameEnd",
+                                 "CreateProgram",
+                                 "Uniform1i",
+                                 "Uniform1f",
+                                 "UseProgram",
+                                 "CreateBuffer",
+                                 "BufferSubData",
+                                 "DeleteBuffer",
+                                 "BindBuffer",
+                                 "BindBufferBase",
+                                 "CreateVertexArray",
+                                 "DeleteVertexArray",
+                                 "VertexArrayVertexBuffer",
+                                 "VertexArrayElementBuffer",
+                                 "VertexArrayAttribute",
+                                 "BindVertexArray",
+                                 "CreateTexture2D",
+                                 "TextureSubImage2D",
+                                 "GenerateMipmap",
+                                 "DeleteTexture",
+                                 "BindTexture",
+                                 "BindSampler",
+                                 "CreateRenderTarget",
+                                 "DeleteRenderTarget",
+                                 "BindFramebuffer",
+                                 "Enable",
+                                 "Disable",
+                                 "BlendFunc",
+                                 "DepthFunc",
+                                 "DepthMask",
+                                 "CullFace",
+                                 "Viewport",
+                                 "DrawArrays",
+                                 "DrawElements",
+                                 "TextureParameter",
+                                 "CompressedTextureSubImage2D",
+                                 "CreateTexture",
+                                 "TextureSubImage3D",
+                                 "CompressedTextureSubImage3D" };
+  static_assert(sizeof(names) / sizeof(names[0]) == (size_t)CaptureOp::Count, "A CaptureOp is missing a name");
+
+  size_t index = (size_t)op;
+  return index < (size_t)CaptureOp::Count ? names[index] : "Unknown";
+}
+
+/**
+ * Splits a capture into its records
+ *
+ * @param data:    The contents of the capture file
+ * @param records: Filled with the records, in order
+ *
+ * @returns True if the capture was well formed
+ */
+static bool parse(const std::vector<uint8_t>& data, std::vector<Record>& records)
+{
+  if (data.size() < sizeof(CAPTURE_MAGIC) || memcmp(data.data(), CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0)
+  {
+    std::cerr << "ERROR::REPLAY::NOT_A_CAPTURE\n";
+    return false;
+  }
+
+  const size_t headerSize = 2 * sizeof(uint16_t) + sizeof(uint32_t);
+  size_t offset = sizeof(CAPTURE_MAGIC);
+
+  while (offset + headerSize <= data.size())
+  {
+    uint16_t header[2];
+    uint32_t payloadSize;
+    memcpy(header, &data[offset], sizeof(header));
+    memcpy(&payloadSize, &data[offset + sizeof(header)], sizeof(payloadSize));
+    offset += headerSize;
+
+    size_t argBytes = header[1] * sizeof(uint32_t);
+    if (offset + argBytes + payloadSize > data.size())
+    {
+      std::cerr << "ERROR::REPLAY::TRUNCATED_CAPTURE: " << records.size() << " calls read\n";
+      return false;
+    }
+
+    Record record;
+    record.op = (CaptureOp)header[0];
+    record.argCount = header[1];
+    record.args = &data[offset];
+    record.payload = payloadSize ? &data[offset + argBytes] : nullptr;
+    record.payloadSize = payloadSize;
+    records.push_back(record);
+
+    offset += argBytes + payloadSize;
+  }
+
+  return true;
+}
+
+/**
+ * Compiles one stage of a captured program
+ *
+ * @param type:   The shader stage
+ * @param source: The shader's source
+ *
+ * @returns The shader, or 0 if it failed to compile
+ */
+static GLuint compileStage(GLenum type, const std::string& source)
+{
+  GLuint shader = glCreateShader(type);
+  const char* code = source.c_str();
+  glShaderSource(shader, 1, &code, nullptr);
+  glCompileShader(shader);
+
+  GLint success;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+  if (!success)
+  {
+    char infoLog[512];
+    glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+    std::cerr << "ERROR::REPLAY::SHADER_COMPILATION_FAILED\n" << infoLog << "\n";
+    glDeleteShader(shader);
+    return 0;
+  }
+
+  return shader;
+}
+
+/**
+ * Issues a captured call
+ *
+ * @param record: The call to issue
+ * @param a:      The call's arguments, copied to aligned storage
+ */
+static void execute(const Record& record, const uint32_t* a)
+{
+  switch (record.op)
+  {
+    case CaptureOp::FrameEnd:
+      break;
+
+    case CaptureOp::CreateProgram:
+    {
+      const char* sources = reinterpret_cast<const char*>(record.payload);
+      std::string vertexCode(sources, a[1]);
+      std::string fragmentCode(sources + a[1], record.payloadSize - a[1]);
+
+      GLuint program = glCreateProgram();
+      GLuint vShader = compileStage(GL_VERTEX_SHADER, vertexCode);
+      GLuint fShader = compileStage(GL_FRAGMENT_SHADER, fragmentCode);
+      glAttachShader(program, vShader);
+      glAttachShader(program, fShader);
+      glLinkProgram(program);
+      glDeleteShader(vShader);
+      glDeleteShader(fShader);
+
+      programs[a[0]] = program;
+      break;
+    }
+
+    case CaptureOp::Uniform1i:
+    case CaptureOp::Uniform1f:
+    {
+      GLuint program = lookup(programs, a[0]);
+      std::string name(reinterpret_cast<const char*>(record.payload), record.payloadSize);
+      GLint location = glGetUniformLocation(program, name.c_str());
+
+      if (record.op == CaptureOp::Uniform1i)
+      {
+        glProgramUniform1i(program, location, (GLint)a[1]);
+      }
+      else
+      {
+        float value;
+        memcpy(&value, &a[1], sizeof(value));
+        glProgramUniform1f(program, location, value);
+      }
+      break;
+    }
+
+    case CaptureOp::UseProgram:
+      glUseProgram(lookup(programs, a[0]));
+      break;
+
+    case CaptureOp::CreateBuffer:
+    {
+      GLuint buffer;
+      glCreateBuffers(1, &buffer);
+      glNamedBufferStorage(buffer, a[1], record.payload, a[2]);
+      buffers[a[0]] = buffer;
+      break;
+    }
+
+    case CaptureOp::BufferSubData:
+      glNamedBufferSubData(lookup(buffers, a[0]), a[1], record.payloadSize, record.payload);
+      break;
+
+    case CaptureOp::DeleteBuffer:
+    {
+      GLuint buffer = lookup(buffers, a[0]);
+      glDeleteBuffers(1, &buffer);
+      buffers.erase(a[0]);
+      break;
+    }
+
+    case CaptureOp::BindBuffer:
+      glBindBuffer(a[0], lookup(buffers, a[1]));
+      break;
+
+    case CaptureOp::BindBufferBase:
+      glBindBufferBase(a[0], a[1], lookup(buffers, a[2]));
+      break;
+
+    case CaptureOp::CreateVertexArray:
+    {
+      GLuint vertexArray;
+      glCreateVertexArrays(1, &vertexArray);
+      vertexArrays[a[0]] = vertexArray;
+      break;
+    }
+
+    case CaptureOp::DeleteVertexArray:
+    {
+      GLuint vertexArray = lookup(vertexArrays, a[0]);
+      glDeleteVertexArrays(1, &vertexArray);
+      vertexArrays.erase(a[0]);
+      break;
+    }
+
+    case CaptureOp::VertexArrayVertexBuffer:
+      glVertexArrayVertexBuffer(lookup(vertexArrays, a[0]), a[1], lookup(buffers, a[2]), a[3], a[4]);
+      break;
+
+    case CaptureOp::VertexArrayElementBuffer:
+      glVertexArrayElementBuffer(lookup(vertexArrays, a[0]), lookup(buffers, a[1]));
+      break;
+
+    case CaptureOp::VertexArrayAttribute:
+    {
+      GLuint vertexArray = lookup(vertexArrays, a[0]);
+      glEnableVertexArrayAttrib(vertexArray, a[1]);
+      glVertexArrayAttribFormat(vertexArray, a[1], a[2], a[3], a[4] ? GL_TRUE : GL_FALSE, a[5]);
+      glVertexArrayAttribBinding(vertexArray, a[1], a[6]);
+      break;
+    }
+
+    case CaptureOp::BindVertexArray:
+      glBindVertexArray(lookup(vertexArrays, a[0]));
+      break;
+
+    case CaptureOp::CreateTexture2D:
+    {
+      GLuint texture;
+      glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+      glTextureStorage2D(texture, a[1], a[2], a[3], a[4]);
+      textures[a[0]] = texture;
+      break;
+    }
+
+    case CaptureOp::TextureSubImage2D:
+    {
+      // The pixels are in the payload even if they were streamed through an unpack buffer
+      GLint unpackBuffer = 0;
+      glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+      if (unpackBuffer)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+      glTextureSubImage2D(lookup(textures, a[0]), a[1], a[2], a[3], a[4], a[5], a[6], a[7], record.payload);
+
+      if (unpackBuffer)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+      break;
+    }
+
+    case CaptureOp::CompressedTextureSubImage2D:
+      glCompressedTextureSubImage2D(lookup(textures, a[0]), a[1], a[2], a[3], a[4], a[5], a[6], (GLsizei)record.payloadSize, record.payload);
+      break;
+
+    case CaptureOp::CreateTexture:
+    {
+      GLuint texture;
+      glCreateTextures(a[1], 1, &texture);
+      if (a[1] == GL_TEXTURE_2D || a[1] == GL_TEXTURE_CUBE_MAP)
+        glTextureStorage2D(texture, a[2], a[3], a[4], a[5]);
+      else
+        glTextureStorage3D(texture, a[2], a[3], a[4], a[5], a[6]);
+      textures[a[0]] = texture;
+      break;
+    }
+
+    case CaptureOp::TextureSubImage3D:
+    {
+      GLint unpackBuffer = 0;
+      glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+      if (unpackBuffer)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+      glTextureSubImage3D(lookup(textures, a[0]), a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], record.payload);
+
+      if (unpackBuffer)
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+      break;
+    }
+
+    case CaptureOp::CompressedTextureSubImage3D:
+      glCompressedTextureSubImage3D(lookup(textures, a[0]), a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], (GLsizei)record.payloadSize,
+                                    record.payload);
+      break;
+
+    case CaptureOp::GenerateMipmap:
+      glGenerateTextureMipmap(lookup(textures, a[0]));
+      break;
+
+    case CaptureOp::DeleteTexture:
+    {
+      GLuint texture = lookup(textures, a[0]);
+      glDeleteTextures(1, &texture);
+      textures.erase(a[0]);
+      break;
+    }
+
+    case CaptureOp::BindTexture:
+      glBindTextureUnit(a[0], lookup(textures, a[1]));
+      break;
+
+    case CaptureOp::BindSampler:
+      // Samplers aren't created through the wrappers, so only unbinding can be replayed
+      if (a[1] == 0)
+        glBindSampler(a[0], 0);
+      break;
+
+    case CaptureOp::TextureParameter:
+      glTextureParameteri(lookup(textures, a[0]), a[1], (GLint)a[2]);
+      break;
+
+    case CaptureOp::CreateRenderTarget:
+    {
+      GLuint framebuffer, color = 0, depth = 0;
+      glCreateFramebuffers(1, &framebuffer);
+
+      if (a[5])
+      {
+        glCreateTextures(GL_TEXTURE_2D, 1, &color);
+        glTextureStorage2D(color, 1, a[5], a[3], a[4]);
+        glTextureParameteri(color, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(color, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, color, 0);
+        textures[a[1]] = color;
+      }
+      else
+      {
+        glNamedFramebufferDrawBuffer(framebuffer, GL_NONE);
+        glNamedFramebufferReadBuffer(framebuffer, GL_NONE);
+      }
+
+      if (a[6])
+      {
+        GLenum attachment = GL_DEPTH_ATTACHMENT;
+        if (a[6] == GL_DEPTH24_STENCIL8 || a[6] == GL_DEPTH32F_STENCIL8)
+          attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+        else if (a[6] == GL_STENCIL_INDEX8)
+          attachment = GL_STENCIL_ATTACHMENT;
+
+        glCreateRenderbuffers(1, &depth);
+        glNamedRenderbufferStorage(depth, a[6], a[3], a[4]);
+        glNamedFramebufferRenderbuffer(framebuffer, attachment, GL_RENDERBUFFER, depth);
+        renderbuffers[a[2]] = depth;
+      }
+
+      framebuffers[a[0]] = framebuffer;
+      break;
+    }
+
+    case CaptureOp::DeleteRenderTarget:
+    {
+      GLuint framebuffer = lookup(framebuffers, a[0]);
+      GLuint color = lookup(textures, a[1]);
+      GLuint depth = lookup(renderbuffers, a[2]);
+      glDeleteFramebuffers(1, &framebuffer);
+      glDeleteTextures(1, &color);
+      glDeleteRenderbuffers(1, &depth);
+      framebuffers.erase(a[0]);
+      textures.erase(a[1]);
+      renderbuffers.erase(a[2]);
+      break;
+    }
+
+    case CaptureOp::BindFramebuffer:
+      glBindFramebuffer(a[0], lookup(framebuffers, a[1]));
+      break;
+
+    case CaptureOp::Enable:
+      glEnable(a[0]);
+      break;
+
+    case CaptureOp::Disable:
+      glDisable(a[0]);
+      break;
+
+    case CaptureOp::BlendFunc:
+      glBlendFunc(a[0], a[1]);
+      break;
+
+    case CaptureOp::DepthFunc:
+      glDepthFunc(a[0]);
+      break;
+
+    case CaptureOp::DepthMask:
+      glDepthMask(a[0] ? GL_TRUE : GL_FALSE);
+      break;
+
+    case CaptureOp::CullFace:
+      glCullFace(a[0]);
+      break;
+
+    case CaptureOp::Viewport:
+      glViewport((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]);
+      break;
+
+    case CaptureOp::DrawArrays:
+      glDrawArraysInstancedBaseInstance(a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3], a[4]);
+      break;
+
+    case CaptureOp::DrawElements:
+      glDrawElementsInstancedBaseVertexBaseInstance(a[0], (GLsizei)a[1], a[2], (const void*)(uintptr_t)a[3], (GLsizei)a[4], (GLint)a[5], a[6]);
+      break;
+
+    default:
+      std::cerr << "ERROR::REPLAY::UNKNOWN_CALL: " << (int)record.op << "\n";
+      break;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: gl_replay <capture file> [width height]\n";
+    return -1;
+  }
+
+  int width = argc >= 4 ? atoi(argv[2]) : 800;
+  int height = argc >= 4 ? atoi(argv[3]) : 600;
+
+  // Read the whole capture up front, so file reads don't show up in the timings
+  std::ifstream file(argv[1], std::ios::binary);
+  if (!file)
+  {
+    std::cerr << "ERROR::REPLAY::FILE_NOT_OPENED: " << argv[1] << "\n";
+    return -1;
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  std::vector<Record> records;
+  if (!parse(data, records))
+    return -1;
+
+  if (!glfwInit())
+  {
+    std::cerr << "Could not init glfw\n";
+    return -1;
+  }
+
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+  GLFWwindow* window = glfwCreateWindow(width, height, "gl_replay", nullptr, nullptr);
+  if (!window)
+  {
+    std::cerr << "Could not create window\n";
+    glfwTerminate();
+    return -1;
+  }
+
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cerr << "Could not load glad\n";
+    glfwTerminate();
+    return -1;
+  }
+
+  // Texture payloads are tightly packed
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  std::vector<OpStats> ops((size_t)CaptureOp::Count);
+  std::vector<FrameStats> frames(1);
+  glCreateQueries(GL_TIME_ELAPSED, 1, &frames.back().query);
+  glBeginQuery(GL_TIME_ELAPSED, frames.back().query);
+
+  std::vector<uint32_t> args;
+  typedef std::chrono::steady_clock Clock;
+
+  for (size_t i = 0; i < records.size(); i++)
+  {
+    const Record& record = records[i];
+    // Records are packed back to back, so copy the arguments somewhere aligned
+    // Missing arguments read as 0 rather than past the end
+    args.assign(record.argCount > 8 ? record.argCount : 8, 0);
+    memcpy(args.data(), record.args, record.argCount * sizeof(uint32_t));
+
+    Clock::time_point start = Clock::now();
+    execute(record, args.data());
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    FrameStats& frame = frames.back();
+    frame.calls++;
+    frame.cpuSeconds += seconds;
+
+    if ((size_t)record.op < ops.size())
+    {
+      ops[(size_t)record.op].count++;
+      ops[(size_t)record.op].cpuSeconds += seconds;
+    }
+
+    if (record.op == CaptureOp::FrameEnd)
+    {
+      glEndQuery(GL_TIME_ELAPSED);
+      glfwSwapBuffers(window);
+
+      frames.push_back(FrameStats());
+      glCreateQueries(GL_TIME_ELAPSED, 1, &frames.back().query);
+      glBeginQuery(GL_TIME_ELAPSED, frames.back().query);
+    }
+  }
+
+  glEndQuery(GL_TIME_ELAPSED);
+  glFinish();
+
+  // Drop the trailing frame if the capture ended right after a FrameEnd
+  if (frames.back().calls == 0)
+  {
+    glDeleteQueries(1, &frames.back().query);
+    frames.pop_back();
+  }
+
+  printf("%zu calls in %zu frames\n\n", records.size(), frames.size());
+  printf("%-8s %10s %12s %12s\n", "frame", "calls", "cpu ms", "gpu ms");
+
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    GLuint64 gpuTime = 0;
+    glGetQueryObjectui64v(frames[i].query, GL_QUERY_RESULT, &gpuTime);
+    glDeleteQueries(1, &frames[i].query);
+
+    printf("%-8zu %10zu %12.3f %12.3f\n", i, frames[i].calls, frames[i].cpuSeconds * 1e3, gpuTime / 1e6);
+  }
+
+  printf("\n%-26s %10s %12s %12s\n", "call", "count", "cpu ms", "avg us");
+
+  for (size_t i = 1; i < ops.size(); i++)
+  {
+    if (!ops[i].count)
+      continue;
+
+    printf("%-26s %10llu %12.3f %12.3f\n", opName((CaptureOp)i), (unsigned long long)ops[i].count, ops[i].cpuSeconds * 1e3,
+           ops[i].cpuSeconds * 1e6 / ops[i].count);
+  }
+
+  glfwDestroyWindow(window);
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,804 @@
+// Compares stb_image's PNG and zlib decoding with and without STBI_FAST_INFLATE
+// Usage: inflate_bench [file.png ...]
+//
+// Every image is decoded by both builds, which must return the same pixels, and its zlib
+// stream is inflated by both. Damaged copies of every stream must fail or succeed the same
+// way in both builds. Without files, synthetic images are encoded here and used instead
+
+// A static build leaves the parts of stb_image the benchmark doesn't call unused
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <string>
+#include <vector>
+
+// The fast build, from inflate_bench_fast.cpp
+unsigned char* fastLoad(const unsigned char* data, int size, int* width, int* height, int* channels);
+char* fastInflate(const char* data, int size, int* outSize);
+void fastFree(void* data);
+
+const int RUNS = 20;          // Decodes timed per image and build, the fastest is reported
+const int DAMAGED_COPIES = 64; // Truncated and bit flipped copies of each stream checked for parity
+
+// An image to decode, and the zlib stream of its pixel rows
+struct Sample
+{
+  std::string name;              // The file, or the synthetic image's name
+  std::vector<unsigned char> png; // The encoded file
+  std::vector<unsigned char> zlib; // Its IDAT chunks joined, empty if it isn't a PNG
+};
+
+// Writes bits least significant first, the order deflate packs them in
+struct BitWriter
+{
+  std::vector<unsigned char> bytes; // The bytes written so far
+  uint32_t buffer = 0;              // Bits not yet written
+  int count = 0;                    // The number of bits in the buffer
+
+  void put(uint32_t value, int bits)
+  {
+    buffer |= value << count;
+    count += bits;
+    while (count >= 8)
+    {
+      bytes.push_back((unsigned char)buffer);
+      buffer >>= 8;
+      count -= 8;
+    }
+  }
+
+  void flush()
+  {
+    if (count > 0)
+      bytes.push_back((unsigned char)buffer);
+
+    buffer = 0;
+    count = 0;
+  }
+};
+
+// A Huffman code, with the codes bit reversed for the writer
+struct HuffmanCode
+{
+  std::vector<int> lengths; // The code length of every symbol, 0 if unused
+  std::vector<int> codes;   // The code of every symbol
+};
+
+const int LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const int LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const int DIST_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const int DIST_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+const int CODE_LENGTH_ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/**
+ * Builds a length limited Huffman code, halving the frequencies until no code is too long
+ *
+ * @param frequencies: How often each symbol is used
+ * @param maxBits:     The longest code allowed
+ */
+HuffmanCode buildCode(std::vector<uint32_t> frequencies, int maxBits)
+{
+  size_t count = frequencies.size();
+
+  // Inflaters expect at least two codes
+  int used = 0;
+  for (uint32_t frequency : frequencies)
+    used += frequency > 0;
+
+  for (size_t i = 0; used < 2 && i < count; i++)
+  {
+    if (frequencies[i] == 0)
+    {
+      frequencies[i] = 1;
+      used++;
+    }
+  }
+
+  HuffmanCode code;
+  code.lengths.assign(count, 0);
+  code.codes.assign(count, 0);
+
+  for (;;)
+  {
+    // Leaves first, then the merged nodes, each with its parent
+    std::vector<uint64_t> weights;
+    std::vector<int> parents;
+    std::priority_queue<std::pair<uint64_t, int>, std::vector<std::pair<uint64_t, int>>, std::greater<std::pair<uint64_t, int>>> queue;
+
+    std::vector<int> leaves;
+    for (size_t i = 0; i < count; i++)
+    {
+      if (frequencies[i] > 0)
+      {
+        queue.push(std::make_pair((uint64_t)frequencies[i], (int)weights.size()));
+        weights.push_back(frequencies[i]);
+        parents.push_back(-1);
+        leaves.push_back((int)i);
+      }
+    }
+
+    while (queue.size() > 1)
+    {
+      std::pair<uint64_t, int> a = queue.top();
+      queue.pop();
+      std::pair<uint64_t, int> b = queue.top();
+      queue.pop();
+
+      int node = (int)weights.size();
+      weights.push_back(a.first + b.first);
+      parents.push_back(-1);
+      parents[a.second] = node;
+      parents[b.second] = node;
+      queue.push(std::make_pair(a.first + b.first, node));
+    }
+
+    int longest = 0;
+    for (size_t i = 0; i < leaves.size(); i++)
+    {
+      int depth = 0;
+      for (int node = (int)i; parents[node] >= 0; node = parents[node])
+        depth++;
+
+      code.lengths[leaves[i]] = depth;
+      longest = std::max(longest, depth);
+    }
+
+    if (longest <= maxBits)
+      break;
+
+    for (uint32_t& frequency : frequencies)
+      if (frequency > 0)
+        frequency = (frequency >> 1) | 1;
+  }
+
+  // Canonical codes, as the inflater rebuilds them from the lengths
+  int lengthCounts[16] = {};
+  for (int length : code.lengths)
+    lengthCounts[length]++;
+
+  lengthCounts[0] = 0;
+  int nextCode[16] = {};
+  for (int bits = 1, value = 0; bits < 16; bits++)
+  {
+    value = (value + lengthCounts[bits - 1]) << 1;
+    nextCode[bits] = value;
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    int length = code.lengths[i];
+    if (length == 0)
+      continue;
+
+    int value = nextCode[length]++;
+    int reversed = 0;
+    for (int bit = 0; bit < length; bit++)
+      reversed |= ((value >> bit) & 1) << (length - 1 - bit);
+
+    code.codes[i] = reversed;
+  }
+
+  return code;
+}
+
+// A literal, or a match when length is not 0
+struct Token
+{
+  uint16_t literalOrLength; // The literal byte, or the match length
+  uint16_t distance;        // The match distance, 0 for a literal
+};
+
+/**
+ * Writes one dynamic Huffman block
+ *
+ * @param writer: Where to write it
+ * @param tokens: The literals and matches in the block
+ * @param last:   Marks it as the stream's last block
+ */
+void writeBlock(BitWriter& writer, const std::vector<Token>& tokens, bool last)
+{
+  std::vector<uint32_t> literalFrequencies(286, 0);
+  std::vector<uint32_t> distanceFrequencies(30, 0);
+  std::vector<int> lengthSymbols(tokens.size()), distanceSymbols(tokens.size());
+
+  for (size_t i = 0; i < tokens.size(); i++)
+  {
+    if (tokens[i].distance == 0)
+    {
+      literalFrequencies[tokens[i].literalOrLength]++;
+      continue;
+    }
+
+    int length = 28;
+    while (LENGTH_BASE[length] > tokens[i].literalOrLength)
+      length--;
+
+    int distance = 29;
+    while (DIST_BASE[distance] > tokens[i].distance)
+      distance--;
+
+    lengthSymbols[i] = length;
+    distanceSymbols[i] = distance;
+    literalFrequencies[257 + length]++;
+    distanceFrequencies[distance]++;
+  }
+
+  literalFrequencies[256] = 1;
+
+  HuffmanCode literals = buildCode(literalFrequencies, 15);
+  HuffmanCode distances = buildCode(distanceFrequencies, 15);
+
+  // The code lengths of both codes, run length encoded with symbols 16 to 18
+  std::vector<int> lengths(literals.lengths);
+  lengths.insert(lengths.end(), distances.lengths.begin(), distances.lengths.end());
+
+  std::vector<std::pair<int, int>> runs; // Symbol and extra bits
+  std::vector<uint32_t> runFrequencies(19, 0);
+  for (size_t i = 0; i < lengths.size();)
+  {
+    size_t run = 1;
+    while (i + run < lengths.size() && lengths[i + run] == lengths[i])
+      run++;
+
+    if (lengths[i] == 0 && run >= 11)
+    {
+      run = std::min(run, (size_t)138);
+      runs.push_back(std::make_pair(18, (int)run - 11));
+    }
+    else if (lengths[i] == 0 && run >= 3)
+      runs.push_back(std::make_pair(17, (int)run - 3));
+    else if (run >= 4)
+    {
+      run = std::min(run, (size_t)7);
+      runs.push_back(std::make_pair(lengths[i], 0));
+      runs.push_back(std::make_pair(16, (int)run - 4));
+    }
+    else
+    {
+      run = 1;
+      runs.push_back(std::make_pair(lengths[i], 0));
+    }
+
+    i += run;
+  }
+
+  for (const std::pair<int, int>& run : runs)
+    runFrequencies[run.first]++;
+
+  HuffmanCode codeLengths = buildCode(runFrequencies, 7);
+
+  int codeLengthCount = 19;
+  while (codeLengthCount > 4 && codeLengths.lengths[CODE_LENGTH_ORDER[codeLengthCount - 1]] == 0)
+    codeLengthCount--;
+
+  writer.put(last ? 1 : 0, 1);
+  writer.put(2, 2);
+  writer.put(286 - 257, 5);
+  writer.put(30 - 1, 5);
+  writer.put(codeLengthCount - 4, 4);
+
+  for (int i = 0; i < codeLengthCount; i++)
+    writer.put(codeLengths.lengths[CODE_LENGTH_ORDER[i]], 3);
+
+  for (const std::pair<int, int>& run : runs)
+  {
+    writer.put(codeLengths.codes[run.first], codeLengths.lengths[run.first]);
+    if (run.first == 16)
+      writer.put(run.second, 2);
+    else if (run.first == 17)
+      writer.put(run.second, 3);
+    else if (run.first == 18)
+      writer.put(run.second, 7);
+  }
+
+  for (size_t i = 0; i < tokens.size(); i++)
+  {
+    const Token& token = tokens[i];
+    if (token.distance == 0)
+    {
+      writer.put(literals.codes[token.literalOrLength], literals.lengths[token.literalOrLength]);
+      continue;
+    }
+
+    int length = lengthSymbols[i];
+    int distance = distanceSymbols[i];
+    writer.put(literals.codes[257 + length], literals.lengths[257 + length]);
+    writer.put(token.literalOrLength - LENGTH_BASE[length], LENGTH_EXTRA[length]);
+    writer.put(distances.codes[distance], distances.lengths[distance]);
+    writer.put(token.distance - DIST_BASE[distance], DIST_EXTRA[distance]);
+  }
+
+  writer.put(literals.codes[256], literals.lengths[256]);
+}
+
+/**
+ * Compresses data into a zlib stream, with greedy hash chain matching and dynamic Huffman blocks
+ *
+ * @param data: The data
+ */
+std::vector<unsigned char> deflate(const std::vector<unsigned char>& data)
+{
+  const int WINDOW = 32768;
+  const int HASH_BITS = 15;
+  const int MAX_CHAIN = 32;
+  const size_t BLOCK_TOKENS = 1 << 16;
+
+  BitWriter writer;
+  writer.put(0x78, 8);
+  writer.put(0x9c, 8);
+
+  std::vector<int> head(1 << HASH_BITS, -1);
+  std::vector<int> previous(data.size(), -1);
+  std::vector<Token> tokens;
+
+  size_t size = data.size();
+  for (size_t i = 0; i < size;)
+  {
+    int bestLength = 0;
+    int bestDistance = 0;
+
+    if (i + 3 <= size)
+    {
+      uint32_t hash = ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> (32 - HASH_BITS);
+      int limit = (int)std::min(size - i, (size_t)258);
+
+      int candidate = head[hash];
+      for (int chain = 0; candidate >= 0 && (int)i - candidate <= WINDOW && chain < MAX_CHAIN; chain++)
+      {
+        int length = 0;
+        while (length < limit && data[candidate + length] == data[i + length])
+          length++;
+
+        if (length > bestLength)
+        {
+          bestLength = length;
+          bestDistance = (int)i - candidate;
+          if (length == limit)
+            break;
+        }
+
+        candidate = previous[candidate];
+      }
+    }
+
+    int step = bestLength >= 3 ? bestLength : 1;
+    if (bestLength >= 3)
+    {
+      Token token = { (uint16_t)bestLength, (uint16_t)bestDistance };
+      tokens.push_back(token);
+    }
+    else
+    {
+      Token token = { data[i], 0 };
+      tokens.push_back(token);
+    }
+
+    for (int j = 0; j < step; j++, i++)
+    {
+      if (i + 3 > size)
+        continue;
+
+      uint32_t hash = ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> (32 - HASH_BITS);
+      previous[i] = head[hash];
+      head[hash] = (int)i;
+    }
+
+    if (tokens.size() == BLOCK_TOKENS)
+    {
+      writeBlock(writer, tokens, false);
+      tokens.clear();
+    }
+  }
+
+  writeBlock(writer, tokens, true);
+  writer.flush();
+
+  uint32_t a = 1, b = 0;
+  for (unsigned char byte : data)
+  {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+
+  uint32_t adler = b << 16 | a;
+  for (int shift = 24; shift >= 0; shift -= 8)
+    writer.bytes.push_back((unsigned char)(adler >> shift));
+
+  return writer.bytes;
+}
+
+/**
+ * Computes a PNG chunk's CRC
+ *
+ * @param data: The chunk type followed by its data
+ * @param size: The size, in bytes
+ */
+uint32_t crc32(const unsigned char* data, size_t size)
+{
+  static uint32_t table[256];
+  if (table[1] == 0)
+  {
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t value = i;
+      for (int bit = 0; bit < 8; bit++)
+        value = value & 1 ? 0xedb88320u ^ (value >> 1) : value >> 1;
+
+      table[i] = value;
+    }
+  }
+
+  uint32_t crc = 0xffffffffu;
+  for (size_t i = 0; i < size; i++)
+    crc = table[(crc ^ data[i]) & 255] ^ (crc >> 8);
+
+  return crc ^ 0xffffffffu;
+}
+
+// Appends a big endian 32 bit value
+void put32(std::vector<unsigned char>& out, uint32_t value)
+{
+  for (int shift = 24; shift >= 0; shift -= 8)
+    out.push_back((unsigned char)(value >> shift));
+}
+
+// Appends a PNG chunk
+void putChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+{
+  put32(png, (uint32_t)data.size());
+  size_t start = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data.begin(), data.end());
+  put32(png, crc32(&png[start], png.size() - start));
+}
+
+// Predicts a pixel from its neighbours, as PNG's Paeth filter does
+int paeth(int left, int up, int upLeft)
+{
+  int p = left + up - upLeft;
+  int pa = abs(p - left), pb = abs(p - up), pc = abs(p - upLeft);
+  return pa <= pb && pa <= pc ? left : pb <= pc ? up : upLeft;
+}
+
+/**
+ * Encodes pixels as a PNG, picking each row's filter like libpng does
+ *
+ * @param pixels:   The pixels, 8 bits per channel
+ * @param width:    The width, in pixels
+ * @param height:   The height, in pixels
+ * @param channels: The channels per pixel, 1 to 4
+ * @param zlib:     Filled with the compressed rows
+ */
+std::vector<unsigned char> encodePng(const std::vector<unsigned char>& pixels, int width, int height, int channels, std::vector<unsigned char>& zlib)
+{
+  size_t stride = (size_t)width * channels;
+  std::vector<unsigned char> filtered;
+  filtered.reserve((stride + 1) * height);
+
+  std::vector<unsigned char> best(stride), candidate(stride);
+  for (int y = 0; y < height; y++)
+  {
+    const unsigned char* row = &pixels[y * stride];
+    const unsigned char* above = y > 0 ? row - stride : nullptr;
+
+    // The filter whose output has the smallest sum of absolute values usually compresses best
+    int bestFilter = 0;
+    uint64_t bestSum = UINT64_MAX;
+    for (int filter = 0; filter < 5; filter++)
+    {
+      uint64_t sum = 0;
+      for (size_t x = 0; x < stride; x++)
+      {
+        int left = x >= (size_t)channels ? row[x - channels] : 0;
+        int up = above ? above[x] : 0;
+        int upLeft = above && x >= (size_t)channels ? above[x - channels] : 0;
+        int predicted = filter == 1 ? left : filter == 2 ? up : filter == 3 ? (left + up) / 2 : filter == 4 ? paeth(left, up, upLeft) : 0;
+
+        candidate[x] = (unsigned char)(row[x] - predicted);
+        sum += candidate[x] < 128 ? candidate[x] : 256 - candidate[x];
+      }
+
+      if (sum < bestSum)
+      {
+        bestSum = sum;
+        bestFilter = filter;
+        best.swap(candidate);
+      }
+    }
+
+    filtered.push_back((unsigned char)bestFilter);
+    filtered.insert(filtered.end(), best.begin(), best.end());
+  }
+
+  zlib = deflate(filtered);
+
+  static const int COLOR_TYPES[5] = { 0, 0, 4, 2, 6 };
+  std::vector<unsigned char> header;
+  put32(header, (uint32_t)width);
+  put32(header, (uint32_t)height);
+  header.push_back(8);
+  header.push_back((unsigned char)COLOR_TYPES[channels]);
+  header.push_back(0);
+  header.push_back(0);
+  header.push_back(0);
+
+  static const unsigned char SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  std::vector<unsigned char> png(SIGNATURE, SIGNATURE + 8);
+  putChunk(png, "IHDR", header);
+  putChunk(png, "IDAT", zlib);
+  putChunk(png, "IEND", std::vector<unsigned char>());
+  return png;
+}
+
+/**
+ * Joins a PNG's IDAT chunks into its zlib stream
+ *
+ * @param png: The file
+ *
+ * @returns: The stream, empty if the file isn't a PNG
+ */
+std::vector<unsigned char> extractZlib(const std::vector<unsigned char>& png)
+{
+  std::vector<unsigned char> zlib;
+  if (png.size() < 8 || png[0] != 137 || png[1] != 'P')
+    return zlib;
+
+  for (size_t offset = 8; offset + 12 <= png.size();)
+  {
+    uint32_t length = (uint32_t)png[offset] << 24 | png[offset + 1] << 16 | png[offset + 2] << 8 | png[offset + 3];
+    if (length > png.size() - offset - 12)
+      break;
+
+    if (memcmp(&png[offset + 4], "IDAT", 4) == 0)
+      zlib.insert(zlib.end(), png.begin() + offset + 8, png.begin() + offset + 8 + length);
+
+    offset += 12 + length;
+  }
+
+  return zlib;
+}
+
+// A cheap, repeatable random number generator
+uint32_t nextRandom(uint32_t& state)
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/**
+ * Generates images like the ones games ship: smooth color, noisy detail, repeated tiles and flat masks
+ */
+std::vector<Sample> syntheticSamples()
+{
+  std::vector<Sample> samples;
+  uint32_t seed = 12345;
+
+  struct Kind
+  {
+    const char* name;
+    int width, height, channels;
+  };
+
+  const Kind KINDS[4] = { { "gradient_rgb_1024", 1024, 1024, 3 },
+                          { "noisy_rgba_1024", 1024, 1024, 4 },
+                          { "tiles_rgba_1024", 1024, 1024, 4 },
+                          { "mask_gray_2048", 2048, 2048, 1 } };
+
+  for (int kind = 0; kind < 4; kind++)
+  {
+    const Kind& k = KINDS[kind];
+    std::vector<unsigned char> pixels((size_t)k.width * k.height * k.channels);
+
+    for (int y = 0; y < k.height; y++)
+    {
+      for (int x = 0; x < k.width; x++)
+      {
+        unsigned char* pixel = &pixels[((size_t)y * k.width + x) * k.channels];
+        for (int c = 0; c < k.channels; c++)
+        {
+          int value;
+          if (kind == 0)
+            value = (x * (c + 1) + y * (3 - c)) / 8;
+          else if (kind == 1)
+            value = (x + y * c) / 8 + (int)(nextRandom(seed) % 24);
+          else if (kind == 2)
+            value = ((x / 16 + y / 16) & 1) ? 40 * c + ((x * 7) % 16) * ((y * 3) % 16) : 200 - c * 30;
+          else
+            value = ((x - 1024) * (x - 1024) + (y - 1024) * (y - 1024) < 700 * 700) ? 255 : 0;
+
+          pixel[c] = (unsigned char)value;
+        }
+      }
+    }
+
+    Sample sample;
+    sample.name = k.name;
+    sample.png = encodePng(pixels, k.width, k.height, k.channels, sample.zlib);
+    samples.push_back(sample);
+  }
+
+  return samples;
+}
+
+/**
+ * Reads a file
+ *
+ * @param path: The file
+ * @param data: Filled with its bytes
+ *
+ * @returns: True if the file was read
+ */
+bool readFile(const char* path, std::vector<unsigned char>& data)
+{
+  FILE* file = fopen(path, "rb");
+  if (!file)
+    return false;
+
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  data.resize(size > 0 ? (size_t)size : 0);
+  bool read = data.empty() || fread(data.data(), 1, data.size(), file) == data.size();
+  fclose(file);
+  return read;
+}
+
+// Times a decode in both builds, taking turns so neither gains from running right after itself
+// Gives the fastest of RUNS for each, in milliseconds
+template <typename Reference, typename Fast>
+void timeDecodes(Reference reference, Fast fast, double& referenceMs, double& fastMs)
+{
+  referenceMs = fastMs = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    reference();
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    fast();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    referenceMs = std::min(referenceMs, std::chrono::duration<double, std::milli>(middle - start).count());
+    fastMs = std::min(fastMs, std::chrono::duration<double, std::milli>(end - middle).count());
+  }
+}
+
+/**
+ * Inflates a stream with both builds and checks they agree
+ *
+ * @param stream: The zlib stream
+ *
+ * @returns: True if both failed, or both returned the same bytes
+ */
+bool inflateMatches(const std::vector<unsigned char>& stream)
+{
+  int referenceSize = 0, fastSize = 0;
+  char* reference = stbi_zlib_decode_malloc((const char*)stream.data(), (int)stream.size(), &referenceSize);
+  char* fast = fastInflate((const char*)stream.data(), (int)stream.size(), &fastSize);
+
+  bool matches = (!reference && !fast) ||
+                 (reference && fast && referenceSize == fastSize && memcmp(reference, fast, referenceSize) == 0);
+
+  stbi_image_free(reference);
+  fastFree(fast);
+  return matches;
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<Sample> samples;
+  if (argc > 1)
+  {
+    for (int i = 1; i < argc; i++)
+    {
+      Sample sample;
+      sample.name = argv[i];
+      if (!readFile(argv[i], sample.png))
+      {
+        fprintf(stderr, "ERROR::INFLATE_BENCH::READ_FAILED: %s\n", argv[i]);
+        return 1;
+      }
+
+      sample.zlib = extractZlib(sample.png);
+      samples.push_back(sample);
+    }
+  }
+  else
+    samples = syntheticSamples();
+
+  bool allMatch = true;
+  double referenceTotal = 0, fastTotal = 0, referenceInflateTotal = 0, fastInflateTotal = 0;
+
+  // Loading includes PNG's unfiltering, which both builds share, inflating is the zlib stream alone
+  printf("%-24s %9s %11s %11s %8s %11s %11s %8s %7s\n", "image", "pixels MB", "load stb", "load fast", "speedup", "inflate stb",
+         "inflate fast", "speedup", "parity");
+
+  for (const Sample& sample : samples)
+  {
+    const unsigned char* png = sample.png.data();
+    int size = (int)sample.png.size();
+
+    int width = 0, height = 0, channels = 0, fastWidth = 0, fastHeight = 0, fastChannels = 0;
+    unsigned char* reference = stbi_load_from_memory(png, size, &width, &height, &channels, 0);
+    unsigned char* fast = fastLoad(png, size, &fastWidth, &fastHeight, &fastChannels);
+
+    bool matches = (!reference && !fast) ||
+                   (reference && fast && width == fastWidth && height == fastHeight && channels == fastChannels &&
+                    memcmp(reference, fast, (size_t)width * height * channels) == 0);
+
+    stbi_image_free(reference);
+    fastFree(fast);
+
+    if (!sample.zlib.empty())
+    {
+      matches = matches && inflateMatches(sample.zlib);
+
+      // Damaged streams must fail, or decode to the same bytes, in both builds
+      uint32_t seed = 2463534242u;
+      std::vector<unsigned char> damaged;
+      for (int copy = 0; copy < DAMAGED_COPIES; copy++)
+      {
+        damaged = sample.zlib;
+        if (copy % 2 == 0)
+          damaged.resize(nextRandom(seed) % damaged.size());
+        else
+          damaged[2 + nextRandom(seed) % (damaged.size() - 2)] ^= (unsigned char)(1 << (nextRandom(seed) % 8));
+
+        matches = matches && inflateMatches(damaged);
+      }
+    }
+
+    double referenceMs, fastMs;
+    timeDecodes([&]() {
+      int w, h, c;
+      stbi_image_free(stbi_load_from_memory(png, size, &w, &h, &c, 0));
+    },
+    [&]() {
+      int w, h, c;
+      fastFree(fastLoad(png, size, &w, &h, &c));
+    },
+    referenceMs, fastMs);
+
+    const char* stream = (const char*)sample.zlib.data();
+    int streamSize = (int)sample.zlib.size();
+
+    double referenceInflateMs, fastInflateMs;
+    timeDecodes([&]() {
+      int outSize;
+      stbi_image_free(stbi_zlib_decode_malloc(stream, streamSize, &outSize));
+    },
+    [&]() {
+      int outSize;
+      fastFree(fastInflate(stream, streamSize, &outSize));
+    },
+    referenceInflateMs, fastInflateMs);
+
+    referenceTotal += referenceMs;
+    fastTotal += fastMs;
+    referenceInflateTotal += referenceInflateMs;
+    fastInflateTotal += fastInflateMs;
+    allMatch = allMatch && matches;
+
+    printf("%-24s %9.2f %11.3f %11.3f %7.2fx %11.3f %11.3f %7.2fx %7s\n", sample.name.c_str(),
+           (double)width * height * channels / (1 << 20), referenceMs, fastMs, referenceMs / fastMs, referenceInflateMs, fastInflateMs,
+           referenceInflateMs / fastInflateMs, matches ? "ok" : "FAILED");
+  }
+
+  printf("%-24s %9s %11.3f %11.3f %7.2fx %11.3f %11.3f %7.2fx %7s\n", "total", "", referenceTotal, fastTotal, referenceTotal / fastTotal,
+         referenceInflateTotal, fastInflateTotal, referenceInflateTotal / fastInflateTotal, allMatch ? "ok" : "FAILED");
+
+  return allMatch ? 0 : 1;
+}
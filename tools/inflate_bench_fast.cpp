@@ -0,0 +1,32 @@
+// The stb_image build with STBI_FAST_INFLATE, which inflate_bench compares against the reference build
+// Both are private to their files, so the two can be linked into one program
+
+// A static build leaves the parts of stb_image the benchmark doesn't call unused
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STB_IMAGE_STATIC
+#ifndef STBI_FAST_INFLATE
+#define STBI_FAST_INFLATE
+#endif
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+
+// Decodes a PNG, or any format stb_image supports, with the fast inflate
+unsigned char* fastLoad(const unsigned char* data, int size, int* width, int* height, int* channels)
+{
+  return stbi_load_from_memory(data, size, width, height, channels, 0);
+}
+
+// Inflates a zlib stream with the fast inflate
+char* fastInflate(const char* data, int size, int* outSize)
+{
+  return stbi_zlib_decode_malloc(data, size, outSize);
+}
+
+// Frees what fastLoad() and fastInflate() return
+void fastFree(void* data)
+{
+  stbi_image_free(data);
+}